@@ -81,6 +81,11 @@ void regmodule_properties(py::module m) {
     wrap_property_RW(m_intel_cpu,
                      ov::intel_cpu::sparse_weights_decompression_rate,
                      "sparse_weights_decompression_rate");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::shared_weights_size, "shared_weights_size");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::private_weights_size, "private_weights_size");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::runtime_cache_statistics, "runtime_cache_statistics");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::memory_plan_statistics, "memory_plan_statistics");
+    wrap_property_RO(m_intel_cpu, ov::intel_cpu::weights_size_per_numa_node, "weights_size_per_numa_node");
 
     // Submodule intel_gpu
     py::module m_intel_gpu =
@@ -146,6 +146,11 @@ def test_conflicting_enum(proxy_enums, expected_values):
         (properties.device.thermal, "DEVICE_THERMAL"),
         (properties.device.uuid, "DEVICE_UUID"),
         (properties.device.capabilities, "OPTIMIZATION_CAPABILITIES"),
+        (properties.intel_cpu.shared_weights_size, "CPU_SHARED_WEIGHTS_SIZE"),
+        (properties.intel_cpu.private_weights_size, "CPU_PRIVATE_WEIGHTS_SIZE"),
+        (properties.intel_cpu.runtime_cache_statistics, "CPU_RUNTIME_CACHE_STATISTICS"),
+        (properties.intel_cpu.memory_plan_statistics, "CPU_MEMORY_PLAN_STATISTICS"),
+        (properties.intel_cpu.weights_size_per_numa_node, "CPU_WEIGHTS_SIZE_PER_NUMA_NODE"),
         (properties.intel_gpu.device_total_mem_size, "GPU_DEVICE_TOTAL_MEM_SIZE"),
         (properties.intel_gpu.uarch_version, "GPU_UARCH_VERSION"),
         (properties.intel_gpu.execution_units_count, "GPU_EXECUTION_UNITS_COUNT"),
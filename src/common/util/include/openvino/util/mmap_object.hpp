@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/util/util.hpp"
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Read only view of a file mapped into the memory of the process. The file is unmapped when the object is
+ * destroyed.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    /**
+     * @brief Returns the pointer to the beginning of the mapped file, nullptr for an empty file
+     */
+    virtual char* data() noexcept = 0;
+
+    /**
+     * @brief Returns the size of the mapped file in bytes
+     */
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file into the memory of the process
+ * @param path Path to the file
+ * @return Mapped file
+ * @throws std::runtime_error if the file can't be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+/**
+ * @brief Maps the whole file with the wide char name into the memory of the process
+ * @param path Path to the file
+ * @return Mapped file
+ * @throws std::runtime_error if the file can't be opened or mapped
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
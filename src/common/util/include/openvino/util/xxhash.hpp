@@ -0,0 +1,29 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the xxHash64 hash function
+ * @file xxhash.hpp
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Computes the xxHash64 of the data. The main loop processes 32 bytes per iteration in 4 independent lanes,
+ * so it is not bound by the latency of a single multiplication chain.
+ * @param data Pointer to the data
+ * @param size Size of the data in bytes
+ * @param seed Seed of the hash
+ * @return 64-bit hash
+ */
+uint64_t xxhash64(const void* data, size_t size, uint64_t seed = 0);
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,88 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/xxhash.hpp"
+
+#include <cstring>
+
+namespace {
+
+constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t xxh_rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read_u64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read_u32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t xxh_round(uint64_t acc, uint64_t v) {
+    acc += v * prime2;
+    acc = xxh_rotl(acc, 31);
+    return acc * prime1;
+}
+
+inline uint64_t xxh_merge_round(uint64_t acc, uint64_t v) {
+    acc ^= xxh_round(0, v);
+    return acc * prime1 + prime4;
+}
+
+}  // namespace
+
+uint64_t ov::util::xxhash64(const void* data, size_t size, uint64_t seed) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    const uint8_t* const end = p + size;
+    uint64_t h;
+    if (size >= 32) {
+        uint64_t lanes[4] = {seed + prime1 + prime2, seed + prime2, seed, seed - prime1};
+        const uint8_t* const limit = end - 32;
+        do {
+            for (size_t l = 0; l < 4; l++) {
+                lanes[l] = xxh_round(lanes[l], read_u64(p + l * 8));
+            }
+            p += 32;
+        } while (p <= limit);
+        h = xxh_rotl(lanes[0], 1) + xxh_rotl(lanes[1], 7) + xxh_rotl(lanes[2], 12) + xxh_rotl(lanes[3], 18);
+        for (auto lane : lanes) {
+            h = xxh_merge_round(h, lane);
+        }
+    } else {
+        h = seed + prime5;
+    }
+    h += static_cast<uint64_t>(size);
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= xxh_round(0, read_u64(p));
+        h = xxh_rotl(h, 27) * prime1 + prime4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read_u32(p)) * prime1;
+        h = xxh_rotl(h, 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= static_cast<uint64_t>(*p) * prime5;
+        h = xxh_rotl(h, 11) * prime1;
+    }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
@@ -14,18 +14,37 @@ namespace pass {
  * @brief Constant folding iterates over the function and tries to evaluate nodes
  *        with constant inputs. Such nodes are then replaced with new Constants containing
  *        the result of a folded operation.
+ *
+ *        Independent nodes are folded in parallel. The memory budget limits the total size in bytes of the
+ *        constants folded in parallel at once, so the peak memory exceeds the one of the serial folding by
+ *        the budget at most. A node with larger outputs is still folded, but alone. 0 means no limit.
  * @ingroup ov_pass_cpp_api
  */
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_RTTI("ConstantFolding");
+    explicit ConstantFolding(size_t memory_budget = 64 * 1024 * 1024) : m_memory_budget(memory_budget) {}
+
     bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
 
+    void set_memory_budget(size_t memory_budget) {
+        m_memory_budget = memory_budget;
+    }
+    size_t get_memory_budget() const {
+        return m_memory_budget;
+    }
+
 protected:
     void copy_runtime_info_from_input_values(const std::shared_ptr<Node>& node);
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+
+private:
+    /// \brief Replaces the outputs of the folded node with the constants.
+    bool replace_with_folded(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+
+    size_t m_memory_budget;
 };
 
 /**
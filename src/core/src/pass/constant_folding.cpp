@@ -4,8 +4,12 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <algorithm>
 #include <openvino/cc/pass/itt.hpp>
+#include <unordered_map>
+#include <unordered_set>
 
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/constant.hpp"
@@ -51,56 +55,191 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+namespace {
+/**
+ * \brief Splits the topologically sorted nodes by levels. The level of a node is the length of the longest path to it
+ * from the nodes without inputs, so there are no dependencies between the nodes of one level.
+ */
+std::vector<ov::NodeVector> split_by_levels(ov::NodeVector&& ordered_ops) {
+    std::unordered_map<const ov::Node*, size_t> node_level;
+    std::vector<ov::NodeVector> levels;
+    for (auto& node : ordered_ops) {
+        size_t level = 0;
+        for (const auto& input : node->input_values()) {
+            level = std::max(level, node_level.at(input.get_node()) + 1);
+        }
+        for (const auto& dependency : node->get_control_dependencies()) {
+            level = std::max(level, node_level.at(dependency.get()) + 1);
+        }
+        node_level[node.get()] = level;
+        if (levels.size() <= level)
+            levels.resize(level + 1);
+        levels[level].push_back(std::move(node));
+    }
+    return levels;
+}
+
+/**
+ * \brief Estimates the size of the constants the node is folded to.
+ */
+size_t get_outputs_size(const ov::Node& node) {
+    size_t size = 0;
+    for (const auto& output : node.outputs()) {
+        const auto& shape = output.get_partial_shape();
+        if (shape.is_static())
+            size += (ov::shape_size(shape.to_shape()) * output.get_element_type().bitwidth() + 7) >> 3;
+    }
+    return size;
+}
+
+// The nodes are folded in parallel if the total size of their outputs is at least this size,
+// otherwise scheduling the tasks costs more than the folding
+constexpr size_t min_parallel_folding_size = 1 << 20;
+
+/**
+ * \brief Runs func for the indices [0, count) in parallel. The first exception thrown by func in the index order is
+ * rethrown once all the indices are processed.
+ */
+template <typename F>
+void parallel_for_each(size_t count, const F& func) {
+    std::vector<std::exception_ptr> errors(count);
+    ov::parallel_for(count, [&](size_t i) {
+        try {
+            func(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
 
-    for (const auto& node : model->get_ordered_ops()) {
+    // The nodes of one level are independent, so the nodes with constant inputs are evaluated in parallel, the
+    // replacements are applied in the topological order. Each node is released as soon as it's processed, so the
+    // replaced nodes and the intermediate constants are freed when their last consumer is folded.
+    auto levels = split_by_levels(model->get_ordered_ops());
+    for (auto& level : levels) {
         if (rewritten) {
-            node->validate_and_infer_types();
+            for (const auto& node : level) {
+                node->validate_and_infer_types();
+            }
         }
 
-        OutputVector replacements(node->get_output_size());
-
-        if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(node, replacement.get_node_shared_ptr());
+        std::vector<OutputVector> replacements(level.size());
+        std::vector<char> folded(level.size(), false);
+        std::vector<char> evaluated(level.size(), false);
 
-                    rewritten = true;
-                }
+        auto apply = [&](size_t idx) {
+            auto& node = level[idx];
+            if (!evaluated[idx]) {
+                replacements[idx].resize(node->get_output_size());
+                folded[idx] = node->constant_fold(replacements[idx], node->input_values());
             }
-        } else {
-            // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
-            if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+            if (folded[idx]) {
+                rewritten |= replace_with_folded(node, replacements[idx]);
+            } else if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
+                // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
                 size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
                 for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
                     rewritten |= run_on_model(sub_graph_node->get_function(static_cast<int>(sub_graph_ind)));
                 }
             }
+            replacements[idx].clear();
+            node.reset();
+        };
+
+        // The nodes with constant inputs are split into the batches which outputs fit the memory budget. The nodes of
+        // a batch don't share inputs: constant_fold may modify the input nodes (e.g. get_name() assigns the unique
+        // name lazily), so the nodes with a common input are folded in different batches.
+        std::vector<size_t> batch;
+        std::unordered_set<const Node*> batch_inputs;
+        size_t batch_size = 0;
+        auto fold_batch = [&]() {
+            if (batch_size >= min_parallel_folding_size) {
+                parallel_for_each(batch.size(), [&](size_t i) {
+                    const auto idx = batch[i];
+                    const auto& node = level[idx];
+                    replacements[idx].resize(node->get_output_size());
+                    folded[idx] = node->constant_fold(replacements[idx], node->input_values());
+                    evaluated[idx] = true;
+                });
+            }
+            for (const auto idx : batch) {
+                apply(idx);
+            }
+            batch.clear();
+            batch_inputs.clear();
+            batch_size = 0;
+        };
+        for (size_t idx = 0; idx < level.size(); ++idx) {
+            const auto& node = level[idx];
+            const auto& inputs = node->input_values();
+            const bool constant_inputs =
+                !inputs.empty() && std::all_of(inputs.begin(), inputs.end(), [](const Output<Node>& input) {
+                    return ov::is_type<ov::op::v0::Constant>(input.get_node());
+                });
+            if (!constant_inputs || ov::is_type<ov::op::util::MultiSubGraphOp>(node))
+                continue;
+            const auto size = get_outputs_size(*node);
+            const bool shared_inputs = std::any_of(inputs.begin(), inputs.end(), [&](const Output<Node>& input) {
+                return batch_inputs.count(input.get_node());
+            });
+            if (shared_inputs || (m_memory_budget && !batch.empty() && batch_size + size > m_memory_budget))
+                fold_batch();
+            batch.push_back(idx);
+            for (const auto& input : inputs)
+                batch_inputs.insert(input.get_node());
+            batch_size += size;
+        }
+        fold_batch();
+
+        for (size_t idx = 0; idx < level.size(); ++idx) {
+            if (level[idx])
+                apply(idx);
         }
+        level.clear();
     }
 
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::replace_with_folded(const std::shared_ptr<Node>& node,
+                                                    const OutputVector& replacements) {
+    OPENVINO_ASSERT(!constant_folding_is_disabled(node),
+                    "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                    node);
+    OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                    "constant_fold_default returned incorrect number of replacements for ",
+                    node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+            replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
+
+            node_output.replace(replacement);
+            // Copy runtime info from source nodes
+            // when it was not propogated during pre-calculation
+            copy_runtime_info_from_input_values(node);
+            // Propagate runtime info attributes to replacement
+            copy_runtime_info(node, replacement.get_node_shared_ptr());
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
 void ov::pass::ConstantFolding::copy_runtime_info_from_input_values(const std::shared_ptr<Node>& node) {
     if (is_type<op::util::ShapeOfBase>(node)) {
         // Don't propogate names of ShapeOf source node since it is not fused itself
@@ -4,6 +4,9 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <algorithm>
+#include <mutex>
+
 #include <transformations/utils/utils.hpp>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
@@ -3584,3 +3587,149 @@ TEST(constant_folding, evaluate_on_tensor_vector) {
     ASSERT_EQ(data_shape, result_node->get_output_shape(0));
     ASSERT_EQ(add_expected, result_node->cast_vector<int>());
 }
+
+TEST(constant_folding, intermediate_constants_released_after_last_consumer) {
+    auto weights = make_shared<op::Constant>(element::i32, Shape{2, 2}, vector<int>{1, 2, 3, 4});
+    auto convert = make_shared<op::v0::Convert>(weights, element::i64);
+    auto negative = make_shared<op::v0::Negative>(convert);
+    auto b = make_shared<op::Constant>(element::i64, Shape{2, 2}, vector<int64_t>{1, 2, 3, 4});
+    auto mock = std::make_shared<::testing::StrictMock<MockAddOp>>(negative, b);
+
+    std::weak_ptr<Node> weak_weights = weights, weak_convert = convert, weak_negative = negative;
+    weights.reset();
+    convert.reset();
+    negative.reset();
+    // the original weights and the folded Convert are not used anymore when the Add is folded
+    EXPECT_CALL(*mock, evaluate).Times(1).WillOnce([&](ov::TensorVector& outputs, const ov::TensorVector& inputs) {
+        EXPECT_TRUE(weak_weights.expired());
+        EXPECT_TRUE(weak_convert.expired());
+        EXPECT_TRUE(weak_negative.expired());
+        return mock->ov::Node::evaluate(outputs, inputs);
+    });
+
+    auto model = std::make_shared<ov::Model>(NodeVector{mock}, ParameterVector{});
+    run_constant_folding(model);
+
+    auto result_node = get_result_constant(model);
+    ASSERT_TRUE(result_node);
+    ASSERT_EQ((vector<int64_t>{0, 0, 0, 0}), result_node->cast_vector<int64_t>());
+}
+
+static std::shared_ptr<ov::Model> create_weights_decompression_model(size_t count, size_t size) {
+    // count independent "dequantization" subgraphs: Convert -> Subtract -> Multiply -> Transpose
+    NodeVector results;
+    for (size_t i = 0; i < count; ++i) {
+        vector<int8_t> values(size * size);
+        for (size_t j = 0; j < values.size(); ++j)
+            values[j] = static_cast<int8_t>((i + j) % 255 - 127);
+        auto weights = make_shared<op::Constant>(element::i8, Shape{size, size}, values);
+        auto convert = make_shared<op::v0::Convert>(weights, element::f32);
+        auto zero_point = op::Constant::create(element::f32, Shape{size, 1}, vector<float>(size, 1.f));
+        auto subtract = make_shared<op::v1::Subtract>(convert, zero_point);
+        auto scale = op::Constant::create(element::f32, Shape{size, 1}, vector<float>(size, 0.5f));
+        auto multiply = make_shared<op::v1::Multiply>(subtract, scale);
+        auto order = op::Constant::create(element::i64, Shape{2}, vector<int64_t>{1, 0});
+        auto transpose = make_shared<op::v1::Transpose>(multiply, order);
+        transpose->set_friendly_name("weights_" + std::to_string(i));
+        results.push_back(transpose);
+    }
+    return std::make_shared<ov::Model>(results, ParameterVector{});
+}
+
+static void check_weights_decompression_model(const std::shared_ptr<ov::Model>& model, size_t count, size_t size) {
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Transpose>(model), 0);
+    for (size_t i = 0; i < count; ++i) {
+        auto result_node = get_result_constant(model, i);
+        ASSERT_TRUE(result_node);
+        ASSERT_EQ(result_node->get_friendly_name(), "weights_" + std::to_string(i));
+        const auto values = result_node->cast_vector<float>();
+        for (size_t row = 0; row < size; ++row) {
+            for (size_t col = 0; col < size; ++col) {
+                const auto value = static_cast<int8_t>((i + col * size + row) % 255 - 127);
+                ASSERT_EQ((value - 1.f) * 0.5f, values[row * size + col]) << "at " << i << ", " << row << ", " << col;
+            }
+        }
+    }
+}
+
+TEST(constant_folding, independent_subgraphs) {
+    // the folded constants are large enough to be folded in parallel
+    const size_t count = 8, size = 256;
+    auto model = create_weights_decompression_model(count, size);
+    run_constant_folding(model);
+    check_weights_decompression_model(model, count, size);
+}
+
+static void run_constant_folding(std::shared_ptr<ov::Model>& model, size_t memory_budget) {
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ov::pass::InitNodeInfo>();
+    pass_manager.register_pass<pass::ConstantFolding>(memory_budget);
+    pass_manager.run_passes(model);
+}
+
+// Folds count independent Adds of [size, size] f32 constants, b is shared by all the Adds if it's given. Returns the
+// number of the Adds already replaced with constants when each Add is evaluated, in ascending order.
+static std::vector<size_t> get_folded_before_evaluation(size_t count,
+                                                        size_t size,
+                                                        size_t memory_budget,
+                                                        const std::shared_ptr<Node>& b = nullptr) {
+    std::vector<std::shared_ptr<::testing::StrictMock<MockAddOp>>> adds;
+    for (size_t i = 0; i < count; ++i) {
+        auto a =
+            op::Constant::create(element::f32, Shape{size, size}, vector<float>(size * size, static_cast<float>(i)));
+        auto add_b = b ? b : op::Constant::create(element::f32, Shape{size, size}, vector<float>(size * size, 1.f));
+        adds.push_back(std::make_shared<::testing::StrictMock<MockAddOp>>(a, add_b));
+    }
+    auto model = std::make_shared<ov::Model>(NodeVector(adds.begin(), adds.end()), ParameterVector{});
+
+    std::mutex mutex;
+    std::vector<size_t> folded_before;
+    for (const auto& add : adds) {
+        auto add_ptr = add.get();
+        EXPECT_CALL(*add, evaluate).WillOnce([&, add_ptr](ov::TensorVector& outputs, const ov::TensorVector& inputs) {
+            const auto& results = model->get_results();
+            const auto folded = std::count_if(results.begin(), results.end(), [](const std::shared_ptr<op::Result>& r) {
+                return ov::is_type<op::Constant>(r->get_input_node_ptr(0));
+            });
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                folded_before.push_back(static_cast<size_t>(folded));
+            }
+            return add_ptr->ov::Node::evaluate(outputs, inputs);
+        });
+    }
+    adds.clear();
+
+    run_constant_folding(model, memory_budget);
+
+    for (size_t i = 0; i < count; ++i) {
+        auto result_node = get_result_constant(model, i);
+        EXPECT_TRUE(result_node);
+        if (result_node)
+            EXPECT_EQ(vector<float>(size * size, i + 1.f), result_node->cast_vector<float>());
+    }
+    std::sort(folded_before.begin(), folded_before.end());
+    return folded_before;
+}
+
+TEST(constant_folding, independent_subgraphs_with_memory_budget) {
+    const size_t count = 8, size = 256;
+    auto model = create_weights_decompression_model(count, size);
+    run_constant_folding(model, 4 * size * size * sizeof(float));
+    check_weights_decompression_model(model, count, size);
+
+    // four 256 KB Adds fit the budget, so they are folded at once, in parallel. The next four are folded when the
+    // replacements of the first batch are applied.
+    ASSERT_EQ((std::vector<size_t>{0, 0, 0, 0, 4, 4, 4, 4}),
+              get_folded_before_evaluation(count, size, 4 * size * size * sizeof(float)));
+    // a node larger than the budget is folded alone
+    ASSERT_EQ((std::vector<size_t>{0, 1, 2, 3, 4, 5, 6, 7}), get_folded_before_evaluation(count, size, 1024));
+}
+
+TEST(constant_folding, independent_subgraphs_with_shared_input) {
+    const size_t count = 8, size = 256;
+    auto b = op::Constant::create(element::f32, Shape{size, size}, vector<float>(size * size, 1.f));
+    // the Adds sharing an input are never folded at once
+    ASSERT_EQ((std::vector<size_t>{0, 1, 2, 3, 4, 5, 6, 7}), get_folded_before_evaluation(count, size, 0, b));
+}
@@ -8,13 +8,14 @@
 #include <vector>
 
 #include "input_model.hpp"
-#include "mmap_object.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/util/file_util.hpp"
 #include "so_extension.hpp"
+#include "utils.hpp"
 #include "xml_parse_utils.h"
+#include "xml_stream_reader.hpp"
 
 using namespace ov;
 
@@ -129,9 +130,10 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
         if (provided_model_stream) {
             return std::make_shared<InputModel>(*provided_model_stream, weights, create_extensions_map());
         } else if (local_model_stream.is_open()) {
-            auto input_model = std::make_shared<InputModel>(local_model_stream, weights, create_extensions_map());
+            // the model file is read by the layers, the reader doesn't need the file after it's scanned
+            std::unique_ptr<ov::XmlStreamReader> reader(new ov::XmlStreamReader(local_model_stream));
             local_model_stream.close();
-            return input_model;
+            return std::make_shared<InputModel>(std::move(reader), weights, create_extensions_map());
         }
         return nullptr;
     };
@@ -198,27 +200,38 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
         }
     }
     if (!weights_path.empty()) {
-        std::ifstream bin_stream;
-        bin_stream.open(weights_path, std::ios::binary);
-        if (!bin_stream.is_open())
+        // The weights file is mapped, so the constants are views on the page cache of the file, which is shared by the
+        // processes reading the same model and isn't copied to the heap. A file which can't be mapped is read.
+        std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+        try {
+            mapped_memory = ov::util::load_mmap_object(weights_path);
+        } catch (const std::runtime_error&) {
+        }
+        if (mapped_memory) {
+            weights = std::make_shared<MappedWeightsBuffer>(mapped_memory);
+        } else {
+            std::ifstream bin_stream;
+            bin_stream.open(weights_path, std::ios::binary);
+            if (!bin_stream.is_open())
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
-            IE_THROW() << "Weights file " + ov::util::wstring_to_string(weights_path) + " cannot be opened!";
+                IE_THROW() << "Weights file " + ov::util::wstring_to_string(weights_path) + " cannot be opened!";
 #else
-            IE_THROW() << "Weights file " + weights_path + " cannot be opened!";
+                IE_THROW() << "Weights file " + weights_path + " cannot be opened!";
 #endif
 
-        bin_stream.seekg(0, std::ios::end);
-        size_t file_size = bin_stream.tellg();
-        bin_stream.seekg(0, std::ios::beg);
+            bin_stream.seekg(0, std::ios::end);
+            size_t file_size = bin_stream.tellg();
+            bin_stream.seekg(0, std::ios::beg);
 
-        auto aligned_weights_buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(file_size);
-        bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
-        bin_stream.close();
+            auto aligned_weights_buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(file_size);
+            bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
+            bin_stream.close();
 
-        weights = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
-            aligned_weights_buffer->get_ptr<char>(),
-            aligned_weights_buffer->size(),
-            aligned_weights_buffer);
+            weights = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                aligned_weights_buffer->get_ptr<char>(),
+                aligned_weights_buffer->size(),
+                aligned_weights_buffer);
+        }
     }
 
     return create_input_model();
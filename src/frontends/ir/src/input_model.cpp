@@ -13,6 +13,7 @@
 
 #include "openvino/core/validation_util.hpp"
 #include "openvino/opsets/opset.hpp"
+#include "xml_stream_reader.hpp"
 
 using namespace ngraph;
 using namespace InferenceEngine;
@@ -195,6 +196,13 @@ class InputModel::InputModelIRImpl {
     std::unordered_map<std::string, ov::OpSet> m_opsets;
     pugi::xml_node m_root;
     pugi::xml_document m_xml_doc;
+    std::unique_ptr<ov::XmlStreamReader> m_layers_reader;
+
+    void load_opsets() {
+        for (const auto& it : ov::get_available_opsets()) {
+            m_opsets[it.first] = it.second();
+        }
+    }
 
 public:
     InputModelIRImpl(std::istream& stream,
@@ -207,9 +215,17 @@ public:
             IE_THROW() << res.description() << " at offset " << res.offset;
         }
         m_root = m_xml_doc.document_element();
-        for (const auto& it : ov::get_available_opsets()) {
-            m_opsets[it.first] = it.second();
-        }
+        load_opsets();
+    }
+
+    InputModelIRImpl(std::unique_ptr<ov::XmlStreamReader> reader,
+                     const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
+                     const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
+        : m_weights(weights),
+          m_extensions(extensions),
+          m_layers_reader(std::move(reader)) {
+        m_root = m_layers_reader->root();
+        load_opsets();
     }
 
     std::shared_ptr<Function> convert();
@@ -221,6 +237,12 @@ InputModel::InputModel(std::istream& stream,
     _impl = std::make_shared<InputModelIRImpl>(stream, weights, extensions);
 }
 
+InputModel::InputModel(std::unique_ptr<ov::XmlStreamReader> reader,
+                       const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
+                       const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions) {
+    _impl = std::make_shared<InputModelIRImpl>(std::move(reader), weights, extensions);
+}
+
 std::shared_ptr<Function> InputModel::convert() {
     return _impl->convert();
 }
@@ -230,7 +252,7 @@ std::shared_ptr<Function> InputModel::InputModelIRImpl::convert() {
 
     // Load default opsets
     size_t version = XMLParseUtils::GetUIntAttr(m_root, "version", 0);
-    ov::XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version);
+    ov::XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version, m_layers_reader.get());
     std::shared_ptr<ngraph::Function> function;
     visitor.on_attribute("net", function);
     function->get_rt_info()["version"] = int64_t(version);
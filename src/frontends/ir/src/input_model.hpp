@@ -12,6 +12,8 @@
 #include "openvino/frontend/visibility.hpp"
 
 namespace ov {
+class XmlStreamReader;
+
 namespace frontend {
 namespace ir {
 
@@ -24,6 +26,12 @@ public:
                const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
                const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
 
+    /// \brief Creates the model from the IR read by the layers instead of loading the DOM of the whole document.
+    /// The layers are parsed on conversion, so the model can be converted only once.
+    InputModel(std::unique_ptr<ov::XmlStreamReader> reader,
+               const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
+               const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions);
+
     std::shared_ptr<Model> convert();
 };
 
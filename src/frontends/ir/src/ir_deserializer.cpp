@@ -12,13 +12,35 @@
 #include "ngraph/op/util/framework_node.hpp"
 #include "ngraph/opsets/opset1.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "rt_info_deserializer.hpp"
 #include "transformations/rt_info/attributes.hpp"
 #include "utils.hpp"
 #include "xml_parse_utils.h"
+#include "xml_stream_reader.hpp"
 
 using namespace ov;
 
+namespace {
+/// \brief Runs func for the indices [0, count) in parallel. The exceptions thrown by func are collected and the one
+/// of the smallest index is rethrown, so the error reported for an invalid IR doesn't depend on the scheduling.
+template <typename F>
+void parallel_for_rethrow(size_t count, const F& func) {
+    std::vector<std::exception_ptr> errors(count);
+    ov::parallel_for(count, [&](size_t i) {
+        try {
+            func(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+}  // namespace
+
 XmlDeserializer::IoMap XmlDeserializer::updated_io_map(const pugi::xml_node& node, const pugi::xml_node& body_node) {
     if (body_node.empty()) {
         IE_THROW() << "Missing body part.";
@@ -349,11 +371,19 @@ void XmlDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<
                 IE_THROW() << "Attribute and shape size are inconsistent for " << type << " op!";
 
             char* data = m_weights->get_ptr<char>() + offset;
-            auto buffer =
-                std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+            std::shared_ptr<ngraph::runtime::AlignedBuffer> buffer;
+            if (auto mapped_weights = std::dynamic_pointer_cast<MappedWeightsBuffer>(m_weights)) {
+                buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
                     data,
                     size,
-                    m_weights);
+                    mapped_weights->get_mapped_memory());
+            } else {
+                buffer =
+                    std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+                        data,
+                        size,
+                        m_weights);
+            }
             a->set(buffer);
         }
     } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::FrameworkNodeAttrs>>(&adapter)) {
@@ -395,7 +425,7 @@ void XmlDeserializer::on_adapter(const std::string& name,
         }
         ngraph_function = parse_function(m_node.child(name.c_str()), m_weights);
     } else if (!name.compare("net")) {
-        ngraph_function = parse_function(m_node, m_weights);
+        ngraph_function = parse_function(m_node, m_weights, m_layers_reader);
     } else {
         IE_THROW() << "Error: not recognized adapter name: " << name << ".";
     }
@@ -404,7 +434,8 @@ void XmlDeserializer::on_adapter(const std::string& name,
 
 std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     const pugi::xml_node& root,
-    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights) {
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
+    XmlStreamReader* layers_reader) {
     // OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::V10Reader_RT, "V10Parser", "Parse");
 
     struct FunctionNodes {
@@ -418,7 +449,7 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
         size_t fromLayerId, fromPortId, toPortId;
     };
     struct node_params {
-        pugi::xml_node xml;
+        size_t index;  // index of the layer in document order
         GenericLayerParams params;
     };
 
@@ -430,13 +461,40 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::vector<size_t> order;
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<edge>> edges;
+    // The layers are either the children of the <layers> node or are parsed from the sources stored by the reader,
+    // in the latter case the layer is valid while its document is alive
+    std::vector<pugi::xml_node> layers;
+    if (!layers_reader) {
+        FOREACH_CHILD (node, root.child("layers"), "layer") { layers.push_back(node); }
+    }
+    const size_t layers_count = layers_reader ? layers_reader->layers_count() : layers.size();
+    std::vector<std::shared_ptr<pugi::xml_document>> documents(layers_count);
+    auto get_layer = [&](size_t index) -> pugi::xml_node {
+        return layers_reader ? documents[index]->document_element() : layers[index];
+    };
+
+    // Parse the layers in parallel. Constants make up the most of the layers of large models and have no inputs,
+    // so they are created right away and their documents are released. The documents of the other layers are kept
+    // until their nodes are created.
+    std::vector<GenericLayerParams> layers_params(layers_count);
+    std::vector<std::shared_ptr<ngraph::Node>> constant_nodes(layers_count);
+    parallel_for_rethrow(layers_count, [&](size_t i) {
+        if (layers_reader)
+            documents[i] = layers_reader->load_layer(i);
+        const auto& p = layers_params[i] = parseGenericParams(get_layer(i));
+        if (p.type == "Const" && !m_extensions.count(ov::DiscreteTypeInfo("Constant", 0, p.version.c_str()))) {
+            constant_nodes[i] = createNode({}, get_layer(i), weights, p);
+            documents[i].reset();
+        }
+    });
+
     // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+    for (size_t i = 0; i < layers_count; i++) {
+        const auto& node_param = layers_params[i];
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
+        params[node_param.layerId] = {i, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -450,12 +508,18 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     }
 
     // Read all edges and store them for further usage
-    FOREACH_CHILD (_ec, root.child("edges"), "edge") {
-        size_t fromLayer = XMLParseUtils::GetUIntAttr(_ec, "from-layer");
-        size_t fromPort = XMLParseUtils::GetUIntAttr(_ec, "from-port");
-        size_t toLayer = XMLParseUtils::GetUIntAttr(_ec, "to-layer");
-        size_t toPort = XMLParseUtils::GetUIntAttr(_ec, "to-port");
-        edges[toLayer].push_back({fromLayer, fromPort, toPort});
+    if (layers_reader) {
+        for (const auto& e : layers_reader->edges()) {
+            edges[e.to_layer].push_back({e.from_layer, e.from_port, e.to_port});
+        }
+    } else {
+        FOREACH_CHILD (_ec, root.child("edges"), "edge") {
+            size_t fromLayer = XMLParseUtils::GetUIntAttr(_ec, "from-layer");
+            size_t fromPort = XMLParseUtils::GetUIntAttr(_ec, "from-port");
+            size_t toLayer = XMLParseUtils::GetUIntAttr(_ec, "to-layer");
+            size_t toPort = XMLParseUtils::GetUIntAttr(_ec, "to-port");
+            edges[toLayer].push_back({fromLayer, fromPort, toPort});
+        }
     }
 
     // Run DFS starting from outputs to get nodes topological order
@@ -472,16 +536,25 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
 
     // OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "ConstructNgraphNodes");
 
+    // The layers are created one by one in topological order: connecting a node to its inputs modifies the
+    // output descriptors of the producers and the shape inference may read their values, which is not thread safe.
     FunctionNodes func_nodes;
     std::map<size_t, std::shared_ptr<ngraph::Node>> id_to_node;
+    for (size_t i = 0; i < layers_count; i++) {
+        if (constant_nodes[i])
+            id_to_node[layers_params[i].layerId] = std::move(constant_nodes[i]);
+    }
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
     //  Following topological order create nGraph operations
     for (auto& layer_id : order) {
-        auto& p = params[layer_id];
         const auto& edgeIt = edges.find(layer_id);
         if (edgeIt == edges.end())
             continue;
+        const auto paramsIt = params.find(layer_id);
+        if (paramsIt == params.end())
+            IE_THROW() << "Invalid IR! The layer with id " << layer_id << " is referenced by an edge, but not defined";
+        auto& p = paramsIt->second;
         ngraph::OutputVector inputs(edgeIt->second.size());
         for (auto& e : edgeIt->second) {
             auto input_node = id_to_node[e.fromLayerId];
@@ -496,8 +569,14 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             inputs[realInputPortId] = input_node->output(p_output.getRealOutputPortId(e.fromPortId));
         }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
-        id_to_node[layer_id] = node;
+        auto& node = id_to_node[layer_id];
+        if (!node) {
+            node = createNode(inputs, get_layer(p.index), weights, p.params);
+            documents[p.index].reset();
+        } else if (!inputs.empty()) {
+            IE_THROW() << "Invalid IR! " << p.params.type << " layer " << p.params.name << " with id: " << layer_id
+                       << " can't have inputs";
+        }
 
         // Check that output shape after OpenVINO node validation the same as in IR
         // because IR always right!
@@ -21,6 +21,8 @@
 
 namespace ov {
 
+class XmlStreamReader;
+
 struct GenericLayerParams {
     struct LayerPortData {
         size_t portId;
@@ -65,12 +67,14 @@ public:
                              const std::unordered_map<std::string, ov::OpSet>& opsets,
                              const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                              std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables,
-                             size_t version)
+                             size_t version,
+                             XmlStreamReader* layers_reader = nullptr)
         : m_node(node),
           m_weights(weights),
           m_opsets(opsets),
           m_extensions(extensions),
           m_variables(variables),
+          m_layers_reader(layers_reader),
           m_version(version) {}
 
     void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& value) override {
@@ -165,9 +169,11 @@ private:
     /// \brief Traverses xml node representation in order to create ov function for it.
     /// \param node xml node representation
     /// \param weights weights attached to current node
+    /// \param layers_reader reader of the layers if they are not the children of the xml node
     /// \return shared pointer to function representing input node
     std::shared_ptr<ov::Model> parse_function(const pugi::xml_node& root,
-                                              const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights);
+                                              const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
+                                              XmlStreamReader* layers_reader = nullptr);
     /// \brief Traverses xml node representation in order to get the purpose attribute of
     /// inputs/outputs in the body of Loop op. \param node xml node representation \return struct
     /// with value of purpuse attribute
@@ -192,6 +198,8 @@ private:
     const std::unordered_map<std::string, ov::OpSet>& m_opsets;
     const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& m_extensions;
     std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& m_variables;
+    /// reader of the layers of the "net" if the IR is read from the stream layer by layer
+    XmlStreamReader* m_layers_reader;
 
     ///
     /// store information about parameters/results order during a model creation
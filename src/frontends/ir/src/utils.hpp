@@ -7,10 +7,32 @@
 #include <memory>
 #include <openvino/core/partial_shape.hpp>
 
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "xml_parse_utils.h"
 
 namespace ov {
+/**
+ * @brief Weights of the IR mapped into the memory. The constants are created as views on the same mapping, so they
+ * are known to be read only, e.g. their hashes for the model cache can be memoized.
+ */
+class MappedWeightsBuffer : public ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>> {
+public:
+    explicit MappedWeightsBuffer(const std::shared_ptr<ov::util::MappedMemory>& mapped_memory)
+        : ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>(mapped_memory->data(),
+                                                                                  mapped_memory->size(),
+                                                                                  mapped_memory),
+          m_mapped_memory(mapped_memory) {}
+
+    const std::shared_ptr<ov::util::MappedMemory>& get_mapped_memory() const {
+        return m_mapped_memory;
+    }
+
+private:
+    std::shared_ptr<ov::util::MappedMemory> m_mapped_memory;
+};
+
 void operator>>(const std::stringstream& in, ov::element::Type& type);
 
 bool getStrAttribute(const pugi::xml_node& node, const std::string& name, std::string& value);
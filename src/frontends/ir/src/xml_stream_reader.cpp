@@ -0,0 +1,247 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "xml_stream_reader.hpp"
+
+#include <cctype>
+#include <string>
+
+#include "ie_common.h"
+
+using namespace ov;
+
+namespace {
+
+/// \brief Incrementally recognizes the markup of the XML document: tags, comments, processing instructions,
+/// CDATA sections and declarations. The content is not validated, it's done by pugixml when the parts of the
+/// document are parsed.
+class MarkupScanner {
+public:
+    enum class Kind { None, Tag, Comment, Instruction, CData, Declaration };
+
+    /// \brief Consumes the next character of the document
+    /// \return true if the character completes the markup
+    bool next(char c) {
+        if (m_kind == Kind::None) {
+            if (c == '<') {
+                m_kind = Kind::Tag;
+                m_markup.assign(1, c);
+                m_quote = 0;
+            }
+            return false;
+        }
+
+        m_markup.push_back(c);
+        switch (m_kind) {
+        case Kind::Tag:
+            if (m_markup.size() == 2 && c == '?') {
+                m_kind = Kind::Instruction;
+            } else if (m_markup[1] == '!') {
+                static const std::string comment = "<!--", cdata = "<![CDATA[";
+                if (m_markup == comment) {
+                    m_kind = Kind::Comment;
+                } else if (m_markup == cdata) {
+                    m_kind = Kind::CData;
+                } else if (comment.compare(0, m_markup.size(), m_markup) != 0 &&
+                           cdata.compare(0, m_markup.size(), m_markup) != 0) {
+                    m_kind = Kind::Declaration;
+                    return complete(c == '>');
+                }
+            } else if (m_quote) {
+                if (c == m_quote)
+                    m_quote = 0;
+            } else if (c == '"' || c == '\'') {
+                m_quote = c;
+            } else if (c == '>') {
+                return complete(true);
+            }
+            return false;
+        case Kind::Comment:
+            return complete(m_markup.size() >= 7 && ends_with("-->"));
+        case Kind::Instruction:
+            return complete(m_markup.size() >= 4 && ends_with("?>"));
+        case Kind::CData:
+            return complete(m_markup.size() >= 12 && ends_with("]]>"));
+        case Kind::Declaration:
+            return complete(c == '>');
+        default:
+            return false;
+        }
+    }
+
+    bool in_markup() const {
+        return m_kind != Kind::None;
+    }
+
+    /// \brief The completed markup
+    const std::string& markup() const {
+        return m_markup;
+    }
+
+    bool is_tag() const {
+        return m_completed == Kind::Tag;
+    }
+
+    bool is_end_tag() const {
+        return is_tag() && m_markup[1] == '/';
+    }
+
+    bool is_empty_element_tag() const {
+        return is_tag() && m_markup[m_markup.size() - 2] == '/';
+    }
+
+    std::string tag_name() const {
+        const size_t begin = is_end_tag() ? 2 : 1;
+        const size_t end = m_markup.find_first_of(" \t\r\n/>", begin);
+        return m_markup.substr(begin, end - begin);
+    }
+
+private:
+    bool ends_with(const char* suffix) const {
+        const std::string s(suffix);
+        return m_markup.compare(m_markup.size() - s.size(), s.size(), s) == 0;
+    }
+
+    bool complete(bool completed) {
+        if (completed) {
+            m_completed = m_kind;
+            m_kind = Kind::None;
+        }
+        return completed;
+    }
+
+    Kind m_kind = Kind::None;
+    Kind m_completed = Kind::None;
+    std::string m_markup;
+    char m_quote = 0;
+};
+
+/// \brief Finds the value of the attribute in the start tag markup
+bool get_attribute(const std::string& tag, const std::string& name, std::string& value) {
+    static const char* spaces = " \t\r\n";
+    size_t pos = tag.find_first_of(spaces);
+    while (pos != std::string::npos) {
+        pos = tag.find_first_not_of(spaces, pos);
+        if (pos == std::string::npos || tag[pos] == '/' || tag[pos] == '>')
+            return false;
+        const size_t name_end = tag.find_first_of("= \t\r\n", pos);
+        const size_t quote = tag.find_first_of("\"'", name_end);
+        if (quote == std::string::npos)
+            return false;
+        const size_t value_end = tag.find(tag[quote], quote + 1);
+        if (value_end == std::string::npos)
+            return false;
+        if (tag.compare(pos, name_end - pos, name) == 0) {
+            value = tag.substr(quote + 1, value_end - quote - 1);
+            return true;
+        }
+        pos = value_end + 1;
+    }
+    return false;
+}
+
+size_t get_uint_attribute(const std::string& tag, const std::string& name) {
+    std::string value;
+    if (!get_attribute(tag, name, value))
+        IE_THROW() << "Invalid IR! The attribute " << name << " is missed in " << tag;
+    size_t pos = 0;
+    unsigned long long result = 0;
+    try {
+        result = std::stoull(value, &pos);
+    } catch (const std::exception&) {
+        pos = 0;
+    }
+    if (value.empty() || !std::isdigit(static_cast<unsigned char>(value[0])) || pos != value.size())
+        IE_THROW() << "Invalid IR! The attribute " << name << " of " << tag << " is not an unsigned integer";
+    return static_cast<size_t>(result);
+}
+
+}  // namespace
+
+XmlStreamReader::XmlStreamReader(std::istream& stream) {
+    // the document without the top-level layers and edges
+    std::string document;
+    MarkupScanner scanner;
+    // names of the open elements, the names of the elements nested into the layers are not stored
+    std::vector<std::string> path;
+    // the top-level element being skipped: a layer, which source is stored aside, or an edge
+    enum class Skipped { None, Layer, Edge } skipped = Skipped::None;
+    std::string layer;
+    std::streamoff offset = 0;
+
+    auto skipped_end = [&]() {
+        if (skipped == Skipped::Layer) {
+            m_layers.push_back(std::move(layer));
+            layer.clear();
+        }
+        skipped = Skipped::None;
+    };
+
+    std::vector<char> chunk(1 << 20);
+    while (stream.read(chunk.data(), chunk.size()) || stream.gcount() > 0) {
+        const auto count = stream.gcount();
+        for (std::streamsize i = 0; i < count; i++, offset++) {
+            const char c = chunk[i];
+            bool skip = skipped != Skipped::None;
+            if (skipped == Skipped::Layer)
+                layer.push_back(c);
+            if (scanner.next(c) && scanner.is_tag()) {
+                const auto& markup = scanner.markup();
+                if (scanner.is_end_tag()) {
+                    if (path.empty())
+                        IE_THROW() << "Invalid IR! Unexpected closing tag " << markup << " at offset " << offset;
+                    path.pop_back();
+                    if (skipped != Skipped::None && path.size() == 2)
+                        skipped_end();
+                } else {
+                    if (skipped == Skipped::None && path.size() == 2) {
+                        const auto name = scanner.tag_name();
+                        if (path[1] == "layers" && name == "layer") {
+                            skipped = Skipped::Layer;
+                            layer = markup;
+                        } else if (path[1] == "edges" && name == "edge") {
+                            skipped = Skipped::Edge;
+                            m_edges.push_back({get_uint_attribute(markup, "from-layer"),
+                                               get_uint_attribute(markup, "from-port"),
+                                               get_uint_attribute(markup, "to-layer"),
+                                               get_uint_attribute(markup, "to-port")});
+                        }
+                        if (skipped != Skipped::None) {
+                            // the beginning of the tag is already copied to the document
+                            document.resize(document.size() - (markup.size() - 1));
+                            skip = true;
+                            if (scanner.is_empty_element_tag())
+                                skipped_end();
+                        }
+                    }
+                    if (!scanner.is_empty_element_tag())
+                        path.push_back(path.size() < 2 ? scanner.tag_name() : std::string());
+                }
+            }
+            if (!skip)
+                document.push_back(c);
+        }
+    }
+    if (skipped != Skipped::None || scanner.in_markup())
+        IE_THROW() << "Invalid IR! Unexpected end of the XML document at offset " << offset;
+
+    pugi::xml_parse_result res = m_document.load_buffer(document.data(), document.size());
+    if (res.status != pugi::status_ok) {
+        IE_THROW() << res.description() << " at offset " << res.offset << " of the IR without the layers and edges";
+    }
+}
+
+std::shared_ptr<pugi::xml_document> XmlStreamReader::load_layer(size_t index) {
+    auto& layer = m_layers.at(index);
+    if (layer.empty())
+        IE_THROW() << "The layer " << index << " of the IR has already been parsed";
+    auto document = std::make_shared<pugi::xml_document>();
+    pugi::xml_parse_result res = document->load_buffer(layer.data(), layer.size());
+    if (res.status != pugi::status_ok) {
+        IE_THROW() << res.description() << " at offset " << res.offset << " of the layer " << index << " of the IR";
+    }
+    // the document keeps its own copy of the source
+    std::string().swap(layer);
+    return document;
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <istream>
+#include <memory>
+#include <pugixml.hpp>
+#include <string>
+#include <vector>
+
+namespace ov {
+
+/// \brief Reads the IR XML from a stream without building the DOM of the whole document.
+///
+/// The stream is scanned once and isn't used after the reader is created. The sources of the <layer> elements of
+/// the top-level <layers> section are stored aside, the <edge> elements of the top-level <edges> section are
+/// decoded on the fly, and the rest of the document (rt_info, pre-process) is small and is parsed into a DOM.
+/// Every layer is parsed once on demand, its source is released as soon as it's parsed.
+class XmlStreamReader {
+public:
+    struct Edge {
+        size_t from_layer;
+        size_t from_port;
+        size_t to_layer;
+        size_t to_port;
+    };
+
+    explicit XmlStreamReader(std::istream& stream);
+
+    /// \brief Returns the root of the document with the empty top-level <layers> and <edges> sections
+    pugi::xml_node root() const {
+        return m_document.document_element();
+    }
+
+    /// \brief Returns the number of the layers in the top-level <layers> section
+    size_t layers_count() const {
+        return m_layers.size();
+    }
+
+    /// \brief Parses the layer with the given index in document order. Can be called only once for every layer,
+    /// the layers with different indices can be parsed concurrently.
+    /// \return document which element is the layer
+    std::shared_ptr<pugi::xml_document> load_layer(size_t index);
+
+    /// \brief Returns the edges of the top-level <edges> section in document order
+    const std::vector<Edge>& edges() const {
+        return m_edges;
+    }
+
+private:
+    pugi::xml_document m_document;
+    std::vector<std::string> m_layers;
+    std::vector<Edge> m_edges;
+};
+
+}  // namespace ov
@@ -3,9 +3,11 @@
 //
 
 #include "frontend_test.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset3.hpp"
 #include "openvino/opsets/opset6.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 class IRFrontendTests : public ::testing::Test, public IRFrontendTestsImpl {
 protected:
@@ -343,6 +345,130 @@ TEST_F(IRFrontendTests, model_with_weights_reading_from_disk) {
     EXPECT_TRUE(res.valid) << res.message;
 }
 
+namespace {
+// Takes the buffer of the constant data, which isn't exposed by the Constant API
+class ConstantBufferVisitor : public ov::AttributeVisitor {
+public:
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        if (auto a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            buffer = a->get();
+        }
+    }
+
+    std::shared_ptr<ngraph::runtime::AlignedBuffer> buffer;
+};
+}  // namespace
+
+TEST_F(IRFrontendTests, model_weights_are_mapped) {
+    std::string xmlModel = R"V0G0N(
+<?xml version="1.0" ?>
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="i64" shape="4"/>
+            <output>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="value1" type="Const" version="opset1">
+            <data element_type="i64" shape="4" offset="0" size="32" />
+            <output>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="value2" type="Const" version="opset1">
+            <data element_type="i64" shape="4" offset="32" size="32" />
+            <output>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="3" name="add1" type="Add" version="opset1">
+            <input>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+                <port id="1" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="4" name="add2" type="Add" version="opset1">
+            <input>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+                <port id="1" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="5" version="opset1">
+            <input>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="3" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="3" to-port="1"/>
+        <edge from-layer="3" from-port="2" to-layer="4" to-port="0"/>
+        <edge from-layer="2" from-port="0" to-layer="4" to-port="1"/>
+        <edge from-layer="4" from-port="2" to-layer="5" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::vector<unsigned char> buffer(64, 0);
+    uint64_t* uint64Buffer = reinterpret_cast<uint64_t*>(buffer.data());
+    for (size_t i = 0; i < 8; i++)
+        uint64Buffer[i] = i;
+
+    createTemporalModelFile(xmlModel, buffer);
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = core.read_model(xmlFileName, binFileName));
+    ASSERT_TRUE(!!model);
+
+    // both constants are views on the same mapping of the weights file, which they keep alive
+    std::vector<std::shared_ptr<ov::opset1::Constant>> constants;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ov::opset1::Constant>(op))
+            constants.push_back(constant);
+    }
+    ASSERT_EQ(constants.size(), 2u);
+    for (const auto& constant : constants) {
+        ConstantBufferVisitor visitor;
+        constant->visit_attributes(visitor);
+        ASSERT_NE(std::dynamic_pointer_cast<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+                      visitor.buffer),
+                  nullptr)
+            << constant->get_friendly_name();
+    }
+    const auto first = constants[0]->get_friendly_name() == "value1" ? constants[0] : constants[1];
+    const auto second = constants[0]->get_friendly_name() == "value1" ? constants[1] : constants[0];
+    EXPECT_EQ(static_cast<const char*>(second->get_data_ptr()) - static_cast<const char*>(first->get_data_ptr()), 32);
+    EXPECT_EQ(first->cast_vector<int64_t>(), std::vector<int64_t>({0, 1, 2, 3}));
+    EXPECT_EQ(second->cast_vector<int64_t>(), std::vector<int64_t>({4, 5, 6, 7}));
+}
+
 TEST_F(IRFrontendTests, model_without_weights_reading_from_disk) {
     std::string xmlModel = R"V0G0N(
 <?xml version="1.0" ?>
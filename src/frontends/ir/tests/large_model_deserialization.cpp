@@ -0,0 +1,261 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+
+#include "frontend_test.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/serialize.hpp"
+
+class IRFrontendLargeModelTests : public ::testing::Test, public IRFrontendTestsImpl {
+protected:
+    void SetUp() override {
+        auto filePrefix = CommonTestUtils::generateTestFilePrefix();
+        xmlFileName = filePrefix + "_IrFrontendLargeModel.xml";
+        binFileName = filePrefix + "_IrFrontendLargeModel.bin";
+    }
+
+    void TearDown() override {
+        RemoveTemporalFiles();
+    }
+
+    // A chain of the MatMul -> Add -> Relu blocks with the weights and biases in the separate constants,
+    // like the layers of a transformer
+    static std::shared_ptr<ov::Model> createModel(size_t blocks, size_t hidden) {
+        auto parameter = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, hidden});
+        parameter->set_friendly_name("input");
+        ov::Output<ov::Node> data = parameter;
+        for (size_t i = 0; i < blocks; i++) {
+            std::vector<float> weightsData(hidden * hidden), biasData(hidden);
+            for (size_t j = 0; j < weightsData.size(); j++)
+                weightsData[j] = static_cast<float>((i + j) % 17) / 16.f;
+            for (size_t j = 0; j < biasData.size(); j++)
+                biasData[j] = static_cast<float>((i * j) % 13);
+            auto weights = ov::opset8::Constant::create(ov::element::f32, ov::Shape{hidden, hidden}, weightsData);
+            weights->set_friendly_name("weights_" + std::to_string(i));
+            auto bias = ov::opset8::Constant::create(ov::element::f32, ov::Shape{1, hidden}, biasData);
+            bias->set_friendly_name("bias_" + std::to_string(i));
+            auto matmul = std::make_shared<ov::opset8::MatMul>(data, weights);
+            matmul->set_friendly_name("matmul_" + std::to_string(i));
+            auto add = std::make_shared<ov::opset8::Add>(matmul, bias);
+            add->set_friendly_name("add_" + std::to_string(i));
+            auto relu = std::make_shared<ov::opset8::Relu>(add);
+            relu->set_friendly_name("relu_" + std::to_string(i));
+            data = relu;
+        }
+        auto result = std::make_shared<ov::opset8::Result>(data);
+        result->set_friendly_name("output");
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{parameter});
+    }
+
+    void serialize(const std::shared_ptr<ov::Model>& model) {
+        ov::pass::Serialize(xmlFileName, binFileName).run_on_model(model);
+    }
+
+    // The model file is read layer by layer, the model string is loaded to the DOM as a whole
+    std::shared_ptr<ov::Model> readFromString() {
+        std::ifstream xmlFile(xmlFileName);
+        std::stringstream xml;
+        xml << xmlFile.rdbuf();
+        std::ifstream binFile(binFileName, std::ios::binary);
+        std::vector<char> weights((std::istreambuf_iterator<char>(binFile)), std::istreambuf_iterator<char>());
+        ov::Tensor weightsTensor(ov::element::u8, ov::Shape{weights.size()});
+        std::copy(weights.begin(), weights.end(), weightsTensor.data<char>());
+        return core.read_model(xml.str(), weightsTensor);
+    }
+};
+
+TEST_F(IRFrontendLargeModelTests, model_with_many_constants_reading) {
+    auto modelRef = createModel(200, 8);
+    serialize(modelRef);
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = core.read_model(xmlFileName, binFileName));
+    ASSERT_TRUE(!!model);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+    const auto res = fc.compare(model, modelRef);
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
+TEST_F(IRFrontendLargeModelTests, model_with_many_constants_reading_underallocated_weights) {
+    serialize(createModel(200, 8));
+
+    // cut the weights of the last blocks off
+    std::vector<char> weights;
+    {
+        std::ifstream binFile(binFileName, std::ios::binary);
+        weights.assign(std::istreambuf_iterator<char>(binFile), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream binFile(binFileName, std::ios::binary | std::ios::trunc);
+        binFile.write(weights.data(), weights.size() / 2);
+    }
+
+    ASSERT_THROW(core.read_model(xmlFileName, binFileName), ov::Exception);
+}
+
+TEST_F(IRFrontendLargeModelTests, model_reading_from_file_by_layers) {
+    std::string xmlModel = R"V0G0N(<?xml version="1.0" ?>
+<!-- <layer id="5" name="commented_out" type="Parameter" version="opset1"/> -->
+<net name="Network" version="11">
+    <layers>
+        <layer name="input>0" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3"/>
+            <output>
+                <port id="0" precision="FP32" names="input&gt;0">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="activation" id="1" type="ReLU" version="opset1">
+            <input>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="2" version="opset1">
+            <input><port id="0" precision="FP32"><dim>1</dim><dim>3</dim></port></input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer='1' from-port='2' to-port='0' to-layer='2'></edge>
+    </edges>
+    <rt_info>
+        <framework><![CDATA[<layers><layer id="6"/></layers>]]></framework>
+        <conversion_parameters>
+            <input_model value="model.onnx"/>
+        </conversion_parameters>
+    </rt_info>
+</net>
+)V0G0N";
+    createTemporalModelFile(xmlModel);
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = core.read_model(xmlFileName));
+    ASSERT_TRUE(!!model);
+    auto modelRef = getWithIRFrontend(xmlModel);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::RUNTIME_KEYS)
+                        .enable(FunctionsComparator::NAMES);
+    const auto res = fc.compare(model, modelRef);
+    EXPECT_TRUE(res.valid) << res.message;
+    ASSERT_EQ(1u, model->get_parameters().size());
+    EXPECT_EQ("input>0", model->get_parameters()[0]->get_friendly_name());
+    ov::AnyMap cli_map;
+    EXPECT_NO_THROW(cli_map = model->get_rt_info<ov::AnyMap>("conversion_parameters"));
+    auto it = cli_map.find("input_model");
+    ASSERT_NE(it, cli_map.end());
+    EXPECT_EQ(it->second.as<std::string>(), "model.onnx");
+}
+
+TEST_F(IRFrontendLargeModelTests, model_reading_from_file_by_layers_unexpected_end) {
+    createTemporalModelFile(R"V0G0N(<?xml version="1.0" ?>
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3"/>
+)V0G0N");
+
+    ASSERT_THROW(core.read_model(xmlFileName), ov::Exception);
+}
+
+TEST_F(IRFrontendLargeModelTests, model_reading_from_file_by_layers_invalid_edge) {
+    createTemporalModelFile(R"V0G0N(<?xml version="1.0" ?>
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3"/>
+            <output><port id="0" precision="FP32"><dim>1</dim><dim>3</dim></port></output>
+        </layer>
+        <layer name="output" type="Result" id="1" version="opset1">
+            <input><port id="0" precision="FP32"><dim>1</dim><dim>3</dim></port></input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="-1" to-port="0"/>
+    </edges>
+</net>
+)V0G0N");
+
+    ASSERT_THROW(core.read_model(xmlFileName), ov::Exception);
+}
+
+// Measures the time of read_model for the large synthetic IR (~20k operations)
+TEST_F(IRFrontendLargeModelTests, DISABLED_read_large_model_performance) {
+    serialize(createModel(4000, 64));
+
+    const size_t iterations = 5;
+    auto best = std::chrono::steady_clock::duration::max();
+    for (size_t i = 0; i < iterations; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        auto model = core.read_model(xmlFileName, binFileName);
+        best = std::min(best, std::chrono::steady_clock::now() - start);
+        ASSERT_EQ(4000u * 5 + 2, model->get_ops().size());
+    }
+    std::cout << "read_model: " << std::chrono::duration_cast<std::chrono::milliseconds>(best).count() << " ms"
+              << std::endl;
+}
+
+#ifdef __linux__
+namespace {
+// Resets the peak resident set size of the process, requires Linux 4.0+
+bool resetPeakRSS() {
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    clearRefs << "5";
+    return static_cast<bool>(clearRefs.flush());
+}
+
+size_t getPeakRSSInKB() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+            return std::stoul(line.substr(6));
+    }
+    return 0;
+}
+}  // namespace
+
+// Compares the peak RSS of reading the large IR file layer by layer with the one of loading the DOM of the IR
+TEST_F(IRFrontendLargeModelTests, DISABLED_read_large_model_peak_memory) {
+    serialize(createModel(4000, 64));
+
+    ASSERT_TRUE(resetPeakRSS());
+    const auto before = getPeakRSSInKB();
+    {
+        auto model = core.read_model(xmlFileName, binFileName);
+        std::cout << "read_model from file (by layers): peak RSS +" << getPeakRSSInKB() - before << " KB" << std::endl;
+    }
+
+    ASSERT_TRUE(resetPeakRSS());
+    const auto beforeString = getPeakRSSInKB();
+    {
+        auto model = readFromString();
+        std::cout << "read_model from string (DOM): peak RSS +" << getPeakRSSInKB() - beforeString << " KB"
+                  << std::endl;
+    }
+}
+#endif
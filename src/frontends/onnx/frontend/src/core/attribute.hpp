@@ -198,9 +198,12 @@ public:
     };
 
     Attribute() = delete;
-    explicit Attribute(const ONNX_NAMESPACE::AttributeProto& attribute_proto, const std::string& model_dir)
+    explicit Attribute(const ONNX_NAMESPACE::AttributeProto& attribute_proto,
+                       const std::string& model_dir,
+                       detail::MappedMemoryHandles mmap_cache = nullptr)
         : m_attribute_proto{&attribute_proto},
-          m_model_dir{model_dir} {}
+          m_model_dir{model_dir},
+          m_mmap_cache{std::move(mmap_cache)} {}
 
     Attribute(Attribute&&) noexcept = default;
     Attribute(const Attribute&) = default;
@@ -251,10 +254,10 @@ public:
         return get_type() == Type::graph_array;
     }
     Tensor get_tensor() const {
-        return Tensor{m_attribute_proto->t(), m_model_dir};
+        return Tensor{m_attribute_proto->t(), m_model_dir, m_mmap_cache};
     }
     SparseTensor get_sparse_tensor() const {
-        return SparseTensor{m_attribute_proto->sparse_tensor(), m_model_dir};
+        return SparseTensor{m_attribute_proto->sparse_tensor(), m_model_dir, m_mmap_cache};
     }
     float get_float() const {
         return m_attribute_proto->f();
@@ -272,7 +275,7 @@ public:
         const auto& tensors = m_attribute_proto->tensors();
         ret.reserve(tensors.size());
         for (const auto& tensor : tensors)
-            ret.emplace_back(tensor, m_model_dir);
+            ret.emplace_back(tensor, m_model_dir, m_mmap_cache);
         return ret;
     }
 
@@ -281,7 +284,7 @@ public:
         const auto& sparse_tensors = m_attribute_proto->sparse_tensors();
         ret.reserve(sparse_tensors.size());
         for (const auto& tensor : sparse_tensors)
-            ret.emplace_back(tensor, m_model_dir);
+            ret.emplace_back(tensor, m_model_dir, m_mmap_cache);
         return ret;
     }
 
@@ -313,7 +316,7 @@ public:
     template <typename T, typename std::enable_if<std::is_same<T, Tensor>::value, bool>::type = true>
     T get_value() const {
         if (is_tensor()) {
-            return Tensor{m_attribute_proto->t(), m_model_dir};
+            return Tensor{m_attribute_proto->t(), m_model_dir, m_mmap_cache};
         }
         throw error::attribute::InvalidData{m_attribute_proto->type()};
     }
@@ -321,7 +324,7 @@ public:
     template <typename T, typename std::enable_if<std::is_same<T, std::vector<Tensor>>::value, bool>::type = true>
     T get_value() const {
         if (is_tensor()) {
-            return {Tensor{m_attribute_proto->t(), m_model_dir}};
+            return {Tensor{m_attribute_proto->t(), m_model_dir, m_mmap_cache}};
         } else if (is_tensor_array()) {
             return get_tensor_array();
         }
@@ -331,7 +334,7 @@ public:
     template <typename T, typename std::enable_if<std::is_same<T, SparseTensor>::value, bool>::type = true>
     T get_value() const {
         if (is_sparse_tensor()) {
-            return SparseTensor{m_attribute_proto->sparse_tensor(), m_model_dir};
+            return SparseTensor{m_attribute_proto->sparse_tensor(), m_model_dir, m_mmap_cache};
         }
         throw error::attribute::InvalidData{m_attribute_proto->type()};
     }
@@ -339,7 +342,7 @@ public:
     template <typename T, typename std::enable_if<std::is_same<T, std::vector<SparseTensor>>::value, bool>::type = true>
     T get_value() const {
         if (is_sparse_tensor()) {
-            return {SparseTensor{m_attribute_proto->sparse_tensor(), m_model_dir}};
+            return {SparseTensor{m_attribute_proto->sparse_tensor(), m_model_dir, m_mmap_cache}};
         } else if (is_sparse_tensor_array()) {
             return get_sparse_tensor_array();
         }
@@ -351,6 +354,7 @@ public:
 private:
     const ONNX_NAMESPACE::AttributeProto* m_attribute_proto;
     std::string m_model_dir;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 }  // namespace onnx_import
@@ -16,6 +16,7 @@
 #include "ngraph/op/parameter.hpp"
 #include "onnx_import/core/operator_set.hpp"
 #include "openvino/frontend/extension/holder.hpp"
+#include "utils/tensor_external_data.hpp"
 
 namespace ngraph {
 namespace onnx_import {
@@ -40,6 +41,9 @@ public:
     const std::string& model_dir() const {
         return m_model_dir;
     }
+    const detail::MappedMemoryHandles& get_mmap_cache() const {
+        return m_mmap_cache;
+    }
     const ParameterVector& get_ng_parameters() const {
         return m_parameters;
     }
@@ -57,7 +61,8 @@ protected:
     Graph(const std::string& model_dir,
           const std::shared_ptr<ONNX_NAMESPACE::ModelProto>& model,
           std::unique_ptr<GraphCache>&& cache,
-          ov::frontend::ExtensionHolder extensions = {});
+          ov::frontend::ExtensionHolder extensions = {},
+          detail::MappedMemoryHandles mmap_cache = nullptr);
 
     void set_friendly_names(const Node& onnx_node, const OutputVector& ng_subgraph_outputs) const;
 
@@ -77,6 +82,8 @@ protected:
 private:
     std::vector<Node> m_nodes;
     std::string m_model_dir;
+    // the files with external data, shared by the subgraphs and mapped until the model is converted
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 /// \brief      Representation of ONNX subgraph. It is used for example by ONNX Loop op.
@@ -74,10 +74,15 @@ inline std::vector<T> __get_data(const Container& container) {
 #endif
 }
 
+template <typename T>
+inline std::vector<T> __get_raw_data(const char* raw_data, size_t raw_data_size, int onnx_data_type) {
+    auto it = reinterpret_cast<const T*>(raw_data);
+    return std::vector<T>(it, it + (raw_data_size / onnx_common::get_onnx_data_size(onnx_data_type)));
+}
+
 template <typename T>
 inline std::vector<T> __get_raw_data(const std::string& raw_data, int onnx_data_type) {
-    auto it = reinterpret_cast<const T*>(raw_data.data());
-    return std::vector<T>(it, it + (raw_data.size() / onnx_common::get_onnx_data_size(onnx_data_type)));
+    return __get_raw_data<T>(raw_data.data(), raw_data.size(), onnx_data_type);
 }
 
 }  // namespace
@@ -106,10 +111,13 @@ public:
     };
 
     Tensor() = delete;
-    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor, const std::string& model_dir)
+    explicit Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
+                    const std::string& model_dir,
+                    detail::MappedMemoryHandles mmap_cache = nullptr)
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
-          m_model_dir{model_dir} {
+          m_model_dir{model_dir},
+          m_mmap_cache{std::move(mmap_cache)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -234,17 +242,12 @@ private:
                                           std::is_same<T, uint64_t>::value,
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
+        if (has_external_data()) {
+            return make_external_ng_constant(type);
+        }
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         size_t data_size = get_data_size();
-        if (has_external_data()) {
-            auto external_data = load_external_data();
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
-            if (constant->get_byte_size() != external_data.size()) {
-                throw error::invalid_external_data(
-                    "The size of the external data file does not match the byte size of an initializer '" + get_name() +
-                    "' in the model");
-            }
-        } else if (data_size == shape_size(m_shape)) {
+        if (data_size == shape_size(m_shape)) {
             constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
         } else if (data_size == 0 && m_shape.size() == 0) {
             constant = common::make_failsafe_constant(type);
@@ -264,6 +267,9 @@ private:
                                           !std::is_same<T, uint64_t>::value,
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
+        if (has_external_data()) {
+            return make_external_ng_constant(type);
+        }
         std::shared_ptr<default_opset::Constant> constant{nullptr};
         auto data = get_data<T>();
         auto data_size = data.size();
@@ -286,14 +292,44 @@ private:
                    ONNX_NAMESPACE::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL;
     }
 
-    std::string load_external_data() const {
+    // The constant is a view over the mapped file if the files are mapped for the model, otherwise it owns a copy
+    // of the data read from the file
+    std::shared_ptr<ngraph::op::Constant> make_external_ng_constant(const element::Type& type) const {
         const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
-        return tensor_external_data.load_external_data(m_model_dir);
+        std::shared_ptr<ngraph::op::Constant> constant{nullptr};
+        const auto check_size = [&](size_t external_data_size) {
+            if (shape_size(m_shape) * type.size() != external_data_size) {
+                throw error::invalid_external_data(
+                    "The size of the external data file does not match the byte size of an initializer '" + get_name() +
+                    "' in the model");
+            }
+        };
+        if (m_mmap_cache) {
+            auto external_data = tensor_external_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
+            check_size(external_data->size());
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data);
+        } else {
+            auto external_data = tensor_external_data.load_external_data(m_model_dir);
+            check_size(external_data.size());
+            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, external_data.data());
+        }
+        if (m_tensor_proto->has_name()) {
+            constant->set_friendly_name(get_name());
+        }
+        return constant;
     }
 
     template <typename T>
     std::vector<T> get_external_data() const {
-        return detail::__get_raw_data<T>(load_external_data(), m_tensor_proto->data_type());
+        const auto tensor_external_data = detail::TensorExternalData(*m_tensor_proto);
+        if (m_mmap_cache) {
+            const auto external_data = tensor_external_data.load_external_mmap_data(m_model_dir, m_mmap_cache);
+            return detail::__get_raw_data<T>(external_data->get_ptr<char>(),
+                                             external_data->size(),
+                                             m_tensor_proto->data_type());
+        }
+        return detail::__get_raw_data<T>(tensor_external_data.load_external_data(m_model_dir),
+                                         m_tensor_proto->data_type());
     }
 
     const void* get_data_ptr() const {
@@ -337,6 +373,7 @@ private:
     const ONNX_NAMESPACE::TensorProto* m_tensor_proto;
     Shape m_shape;
     std::string m_model_dir;
+    detail::MappedMemoryHandles m_mmap_cache;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
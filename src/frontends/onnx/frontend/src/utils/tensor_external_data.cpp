@@ -31,18 +31,56 @@ TensorExternalData::TensorExternalData(const ONNX_NAMESPACE::TensorProto& tensor
     }
 }
 
-std::string TensorExternalData::load_external_data(const std::string& model_dir) const {
+std::string TensorExternalData::get_full_path(const std::string& model_dir) const {
     NGRAPH_SUPPRESS_DEPRECATED_START
-
     auto full_path = file_util::path_join(model_dir, m_data_location);
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     file_util::convert_path_win_style(full_path);
+#endif
+    NGRAPH_SUPPRESS_DEPRECATED_END
+    return full_path;
+}
+
+MappedBuffer TensorExternalData::load_external_mmap_data(const std::string& model_dir,
+                                                         const MappedMemoryHandles& cache) const {
+    const auto full_path = get_full_path(model_dir);
+    auto& mapped_memory = (*cache)[full_path];
+    if (!mapped_memory) {
+        try {
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+            mapped_memory = ov::util::load_mmap_object(ov::util::string_to_wstring(full_path));
+#else
+            mapped_memory = ov::util::load_mmap_object(full_path);
+#endif
+        } catch (const std::runtime_error&) {
+            cache->erase(full_path);
+            throw error::invalid_external_data{*this};
+        }
+    }
+    const uint64_t file_size = mapped_memory->size();
+    if (m_offset + m_data_length > file_size) {
+        throw error::invalid_external_data{*this};
+    }
+    const uint64_t read_data_length = m_data_length > 0 ? m_data_length : file_size - m_offset;
+
+    if (m_sha1_digest.size() > 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+
+    return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+        mapped_memory->data() + m_offset,
+        read_data_length,
+        mapped_memory);
+}
+
+std::string TensorExternalData::load_external_data(const std::string& model_dir) const {
+    const auto full_path = get_full_path(model_dir);
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
     std::ifstream external_data_stream(ov::util::string_to_wstring(full_path),
                                        std::ios::binary | std::ios::in | std::ios::ate);
 #else
     std::ifstream external_data_stream(full_path, std::ios::binary | std::ios::in | std::ios::ate);
 #endif
-    NGRAPH_SUPPRESS_DEPRECATED_END
 
     if (external_data_stream.fail()) {
         throw error::invalid_external_data{*this};
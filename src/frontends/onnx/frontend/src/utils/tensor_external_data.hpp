@@ -6,9 +6,22 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief  Files with external data mapped while a model is loaded, the key is the full path to a file
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::util::MappedMemory>>>;
+
+/// \brief  External data of a tensor as a view over the mapped file, the view keeps the file mapped
+using MappedBuffer = std::shared_ptr<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,12 +36,25 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data(const std::string& model_dir) const;
 
+    /// \brief      Map external data from tensor passed to constructor
+    ///
+    /// \note       The file is mapped once and shared by all the tensors which refer to it.
+    ///             If mapping of the external file fails, the invalid_external_data exception is thrown.
+    ///
+    /// \param      model_dir   The directory of the model, the path of the external data is relative to it
+    /// \param      cache       The files mapped for the model being loaded
+    ///
+    /// \return     External binary data as a view over the mapped file
+    MappedBuffer load_external_mmap_data(const std::string& model_dir, const MappedMemoryHandles& cache) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
     std::string to_string() const;
 
 private:
+    std::string get_full_path(const std::string& model_dir) const;
+
     std::string m_data_location{};
     uint64_t m_offset = 0;
     uint64_t m_data_length = 0;
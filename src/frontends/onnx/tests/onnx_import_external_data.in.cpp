@@ -2,6 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <onnx/onnx_pb.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+#include "common_test_utils/common_utils.hpp"
 #include "common_test_utils/file_utils.hpp"
 #include "default_opset.hpp"
 #include "engines_util/test_case.hpp"
@@ -111,6 +119,23 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file_mapped_once) {
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                             SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"));
+
+    std::vector<const char*> data;
+    for (const auto& op : function->get_ops()) {
+        if (const auto constant = ov::as_type_ptr<default_opset::Constant>(op)) {
+            data.push_back(constant->get_data_ptr<char>());
+        }
+    }
+    // the constants are the views over the same mapping of the file, at the offsets 0 and 4096
+    ASSERT_EQ(data.size(), 2u);
+    EXPECT_EQ(std::abs(data[1] - data[0]), 4096);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
@@ -186,3 +211,107 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_in_constant_node) {
 
     test_case.run();
 }
+
+namespace {
+// Writes the chain of the Add operations with the initializers, all of them are stored in one external data file
+void write_model_with_external_data(const std::string& model_path,
+                                    const std::string& data_path,
+                                    size_t initializers,
+                                    size_t elements) {
+    ONNX_NAMESPACE::ModelProto model;
+    model.set_ir_version(7);
+    model.add_opset_import()->set_version(13);
+    auto graph = model.mutable_graph();
+    graph->set_name("external_data_benchmark");
+
+    const auto add_value_info = [&](ONNX_NAMESPACE::ValueInfoProto* info, const std::string& name) {
+        info->set_name(name);
+        auto tensor_type = info->mutable_type()->mutable_tensor_type();
+        tensor_type->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+        tensor_type->mutable_shape()->add_dim()->set_dim_value(elements);
+    };
+    add_value_info(graph->add_input(), "input");
+
+    std::ofstream data_file(data_path, std::ios::binary);
+    const std::vector<float> data(elements, 1.f);
+    std::string output = "input";
+    for (size_t i = 0; i < initializers; i++) {
+        const auto name = "initializer_" + std::to_string(i);
+        auto initializer = graph->add_initializer();
+        initializer->set_name(name);
+        initializer->set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+        initializer->add_dims(elements);
+        initializer->set_data_location(ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL);
+        const std::pair<std::string, std::string> entries[] = {
+            {"location", data_path.substr(data_path.find_last_of("/\\") + 1)},
+            {"offset", std::to_string(i * elements * sizeof(float))},
+            {"length", std::to_string(elements * sizeof(float))}};
+        for (const auto& entry : entries) {
+            auto external_data = initializer->add_external_data();
+            external_data->set_key(entry.first);
+            external_data->set_value(entry.second);
+        }
+        data_file.write(reinterpret_cast<const char*>(data.data()), elements * sizeof(float));
+
+        auto node = graph->add_node();
+        node->set_op_type("Add");
+        node->add_input(output);
+        node->add_input(name);
+        output = "add_" + std::to_string(i);
+        node->add_output(output);
+    }
+    add_value_info(graph->add_output(), output);
+
+    std::ofstream model_file(model_path, std::ios::binary);
+    model.SerializeToOstream(&model_file);
+}
+
+#ifdef __linux__
+// Resets the peak resident set size of the process, requires Linux 4.0+
+bool reset_peak_rss() {
+    std::ofstream clear_refs("/proc/self/clear_refs");
+    clear_refs << "5";
+    return static_cast<bool>(clear_refs.flush());
+}
+
+size_t get_peak_rss_in_kb() {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmHWM:") == 0)
+            return std::stoul(line.substr(6));
+    }
+    return 0;
+}
+#endif
+}  // namespace
+
+// Measures the import time and the peak RSS for the model with 1 GB of the external data in 256 initializers, the
+// constants are the views over the mapped file, so the data is not copied by the import
+NGRAPH_TEST(${BACKEND_NAME}, DISABLED_onnx_external_data_load_benchmark) {
+    const auto prefix = CommonTestUtils::generateTestFilePrefix();
+    const auto model_path = prefix + "_external_data_benchmark.onnx";
+    const auto data_path = prefix + "_external_data_benchmark.bin";
+    const size_t initializers = 256, elements = 1024 * 1024;
+    write_model_with_external_data(model_path, data_path, initializers, elements);
+
+#ifdef __linux__
+    ASSERT_TRUE(reset_peak_rss());
+    const auto before = get_peak_rss_in_kb();
+#endif
+    const auto start = std::chrono::steady_clock::now();
+    {
+        const auto function = onnx_import::import_onnx_model(model_path);
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        ASSERT_EQ(function->get_ops().size(), initializers * 2 + 2);
+        std::cout << "import of " << initializers * elements * sizeof(float) / (1024 * 1024) << " MB of external data: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << " ms";
+#ifdef __linux__
+        std::cout << ", peak RSS +" << get_peak_rss_in_kb() - before << " KB";
+#endif
+        std::cout << std::endl;
+    }
+
+    CommonTestUtils::removeFile(model_path);
+    CommonTestUtils::removeFile(data_path);
+}
@@ -14,18 +14,15 @@ GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::wstring& path)
 #endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
 GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::string& path) {
-    std::ifstream model_file;
-    model_file.open(path, std::ios::binary | std::ios::in);
-    FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
-
-    model_file.seekg(0, std::ios::end);
-    auto length = model_file.tellg();
-    model_file.seekg(0, std::ios::beg);
-    char* data = new char[length];
-    model_file.read(data, length);
-    model_file.close();
+    // the flatbuffer is used in place, the buffers of the constant tensors are not copied
+    try {
+        m_data = ov::util::load_mmap_object(path);
+    } catch (const std::runtime_error& error) {
+        FRONT_END_GENERAL_CHECK(false, "Model file can not be read: ", path, ". ", error.what());
+    }
+    FRONT_END_GENERAL_CHECK(m_data->size() > 0, "Model file is empty: ", path);
 
-    m_model = std::shared_ptr<tflite::Model>(tflite::GetMutableModel(data), [](tflite::Model* p) {});
+    m_model = tflite::GetModel(m_data->data());
     const auto subgraphs = m_model->subgraphs();
     FRONT_END_GENERAL_CHECK(subgraphs->size() == 1,
                             "Number of sub-graphs in the model is ",
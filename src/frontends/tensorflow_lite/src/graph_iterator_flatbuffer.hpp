@@ -9,6 +9,7 @@
 #include "decoder_flatbuffer.h"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "schema_generated.h"
 
 namespace ov {
@@ -25,7 +26,8 @@ struct TensorInfo {
 class GraphIteratorFlatBuffer {
     size_t node_index = 0;
     std::vector<const tflite::Operator*> m_nodes;
-    std::shared_ptr<tflite::Model> m_model;
+    std::shared_ptr<ov::util::MappedMemory> m_data;
+    const tflite::Model* m_model = nullptr;
 
 public:
     explicit GraphIteratorFlatBuffer(const std::string& path);
@@ -58,6 +60,11 @@ public:
 
     /// Return Decoder for the current node that iterator points to
     std::shared_ptr<ov::frontend::tensorflow_lite::DecoderFlatBuffer> get_decoder() const;
+
+    /// Return the mapped model file, the tensors of the decoders point to it
+    const std::shared_ptr<ov::util::MappedMemory>& get_model_data() const {
+        return m_data;
+    }
 };
 
 }  // namespace tensorflow_lite
@@ -7,6 +7,7 @@
 #include <iterator>
 #include <queue>
 
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/opsets/opset10.hpp"
 #include "openvino/util/log.hpp"
@@ -97,9 +98,15 @@ void InputModel::InputModelTFLiteImpl::loadModel() {
                     // will reorder by index later
                     m_inputs.push_back(place);
                 } else if (auto data = place->get_data()) {
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    // the constant is a view over the model file, which stays mapped while the constant exists
+                    const auto& type = place->get_element_type();
+                    const auto shape = place->get_partial_shape().to_shape();
+                    const auto size = (shape_size(shape) * type.bitwidth() + 7) / 8;
+                    using MappedBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+                    auto buffer = std::make_shared<MappedBuffer>(static_cast<char*>(const_cast<void*>(data)),
+                                                                 size,
+                                                                 m_graph_iterator->get_model_data());
+                    auto constant = std::make_shared<ov::op::v0::Constant>(type, shape, buffer);
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else if (place->get_partial_shape() == PartialShape{0}) {  // empty constant
@@ -4,7 +4,9 @@
 
 #include "convert_model.hpp"
 
+#include "openvino/op/constant.hpp"
 #include "tf_utils.hpp"
+#include "utils.hpp"
 
 using namespace ngraph;
 using namespace ov::frontend;
@@ -21,3 +23,28 @@ INSTANTIATE_TEST_SUITE_P(TFLiteConvertModelTest,
                                             ::testing::Values(std::string(TEST_TENSORFLOW_LITE_MODELS_DIRNAME)),
                                             ::testing::ValuesIn(models)),
                          FrontEndConvertModelTest::getTestCaseName);
+
+TEST(TFLiteConvertModelTest, constants_outlive_input_model) {
+    std::shared_ptr<ov::Model> model;
+    {
+        FrontEndManager fem;
+        FrontEnd::Ptr frontend;
+        InputModel::Ptr input_model;
+        std::tie(frontend, input_model) = FrontEndTestUtils::load_from_file(
+            fem,
+            TF_LITE_FE,
+            FrontEndTestUtils::make_model_path(std::string(TEST_TENSORFLOW_LITE_MODELS_DIRNAME) +
+                                               "2in_2out/2in_2out.tflite"));
+        ASSERT_NE(input_model, nullptr);
+        ASSERT_NO_THROW(model = frontend->decode(input_model));
+    }
+    // the constants are the views over the mapped model file, it stays mapped while they exist
+    std::vector<int64_t> paddings;
+    for (const auto& op : model->get_ordered_ops()) {
+        const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(op);
+        if (constant && constant->get_shape() == ov::Shape{4, 2}) {
+            paddings = constant->cast_vector<int64_t>();
+        }
+    }
+    EXPECT_EQ(paddings, (std::vector<int64_t>{0, 0, 1, 1, 2, 2, 0, 0}));
+}
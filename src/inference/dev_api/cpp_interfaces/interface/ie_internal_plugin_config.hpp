@@ -92,6 +92,63 @@ DECLARE_CONFIG_KEY(SMALL_CORE_OFFSET);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Defines whether the CPU runtime parameters cache is shared between all the streams of a compiled model
+ * (YES) or each stream owns a separate cache (NO, default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_SHARED);
+
+/**
+ * @brief Defines how many sets of the resolved output shapes (one per unique combination of the input shapes) can be
+ * retained by each dynamic CPU graph to skip shape inference for the input shapes seen before
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_SHAPES_PLAN_CACHE_CAPACITY);
+
+/**
+ * @brief Defines how the CPU plugin places the weights of a compiled model on a multi NUMA node system:
+ * REPLICATE (default) - a replica per NUMA node, the graphs of all the streams are created at compile time
+ * REPLICATE_ON_FIRST_USE - a replica per NUMA node, created by the first inference executed by a stream on that node
+ * SINGLE_NODE - a single copy of the weights shared by the streams of all the NUMA nodes
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_NUMA_POLICY);
+DECLARE_CONFIG_VALUE(REPLICATE);
+DECLARE_CONFIG_VALUE(REPLICATE_ON_FIRST_USE);
+DECLARE_CONFIG_VALUE(SINGLE_NODE);
+
+/**
+ * @brief Defines whether the CPU plugin uses the constants, which layout suits the selected primitives, in place from the
+ * model buffers when the weights are shared between the streams (YES), or copies them to the weights replica of every
+ * NUMA node (NO, default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_CONSTANTS_IN_PLACE);
+
+/**
+ * @brief Defines whether the CPU plugin adapts the number of the active streams and their core types to the contention
+ * observed at runtime (YES) or keeps all the streams of the compiled model active (NO, default). The streams can't
+ * exceed the number selected at compile time
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_ADAPTIVE_STREAMS);
+
+/**
+ * @brief Defines whether the CPU plugin fuses the color conversion of the NV12/I420 input with the following element
+ * type conversion, mean/scale normalization and layout conversion into a single node (YES, default) or executes them
+ * as separate nodes (NO)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_COLOR_CONVERT_NORMALIZE_FUSION);
+
+/**
+ * @brief Defines whether the CPU plugin overlaps the shape inference and the params preparation of the nodes of the
+ * dynamic graphs (YES, default) or prepares the nodes one by one (NO)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_PREPARATION_PIPELINE);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -109,6 +166,13 @@ DECLARE_CONFIG_KEY(CONFIG_DEVICE_ID);
  */
 DECLARE_CONFIG_KEY(ENABLE_HYPER_THREAD);
 
+/**
+ * @brief Enables the work stealing mode of the streams executor: every stream has its own task queue and takes the
+ * tasks from the queues of the other streams of the same NUMA node when its queue is empty
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(WORK_STEALING);
+
 /**
  * @brief Defines Snippets tokenization mode
  *      @param ENABLE - default pipeline
@@ -121,6 +185,13 @@ DECLARE_CONFIG_VALUE(ENABLE);
 DECLARE_CONFIG_VALUE(IGNORE_CALLBACK);
 DECLARE_CONFIG_VALUE(DISABLE);
 
+/**
+ * @brief Enables the adaptive time to collect a batch in the AUTO_BATCH plugin (YES/NO, default NO).
+ * The time is derived from the requests arrival rate and the batch execution time, the AUTO_BATCH_TIMEOUT being an upper bound.
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_ADAPTIVE_TIMEOUT);
+
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
@@ -23,7 +23,9 @@ namespace threading {
  * @ingroup ov_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from single queue. In the work stealing mode
+ *        (@ref IStreamsExecutor::Config::_work_stealing) every thread has its own queue and takes the tasks
+ *        from the queues of the other threads of the same NUMA node when its queue is empty.
  */
 class OPENVINO_RUNTIME_API CPUStreamsExecutor : public IStreamsExecutor {
 public:
@@ -100,6 +100,8 @@ public:
         int _threads_per_stream_small = 0;  //!< Threads per stream in small cores
         int _small_core_offset = 0;         //!< Calculate small core start offset when binding cpu cores
         bool _enable_hyper_thread = true;   //!< enable hyper thread
+        bool _work_stealing = false;        //!< Every stream thread takes the tasks from its own queue and steals
+                                            //!< them from the other streams of the same NUMA node when it's empty
         enum StreamMode { DEFAULT, AGGRESSIVE, LESSAGGRESSIVE };
         enum PreferredCoreType {
             ANY,
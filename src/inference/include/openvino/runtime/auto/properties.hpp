@@ -23,5 +23,46 @@ static constexpr Property<bool> device_bind_buffer{"DEVICE_BIND_BUFFER"};
  */
 static constexpr Property<bool> enable_startup_fallback{"ENABLE_STARTUP_FALLBACK"};
 
+/**
+ * @brief Enum to define the policy of scheduling the infer requests to the devices
+ */
+enum class SchedulePolicy {
+    DEVICE_PRIORITY = 0,        //!<  The request goes to the first device with an idle infer request in priority order
+    LATENCY_AWARE = 1,          //!<  The request goes to the device expected to complete it first, based on the
+                                //!<  latency measured at runtime and the number of requests the device is busy with
+    DEFAULT = DEVICE_PRIORITY,  //!<  Default schedule policy is DEVICE_PRIORITY
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const SchedulePolicy& policy) {
+    switch (policy) {
+    case SchedulePolicy::DEVICE_PRIORITY:
+        return os << "DEVICE_PRIORITY";
+    case SchedulePolicy::LATENCY_AWARE:
+        return os << "LATENCY_AWARE";
+    default:
+        throw ov::Exception{"Unsupported schedule policy"};
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, SchedulePolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "DEVICE_PRIORITY") {
+        policy = SchedulePolicy::DEVICE_PRIORITY;
+    } else if (str == "LATENCY_AWARE") {
+        policy = SchedulePolicy::LATENCY_AWARE;
+    } else {
+        throw ov::Exception{"Unsupported schedule policy: " + str};
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief multi device setting that defines how the infer requests are distributed between the devices
+ */
+static constexpr Property<SchedulePolicy> schedule_policy{"SCHEDULE_POLICY"};
+
 }  // namespace intel_auto
 }  // namespace ov
\ No newline at end of file
@@ -49,5 +49,56 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
 
 static constexpr Property<float> sparse_weights_decompression_rate{"SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief Read-only property of a compiled model: size in bytes of the constants which are used in place from the
+ * model weights buffer, so they are shared between the streams. When the weights are memory mapped by the frontend
+ * (IR weights, ONNX external data, TensorFlow Lite models read from a file), such constants are backed by the page
+ * cache of the file and also shared between the processes using the same file.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<size_t, PropertyMutability::RO> shared_weights_size{"CPU_SHARED_WEIGHTS_SIZE"};
+
+/**
+ * @brief Read-only property of a compiled model: size in bytes of the constant data held in memory owned by the
+ * plugin (copied constants and weights reordered into a layout optimal for the selected primitives).
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<size_t, PropertyMutability::RO> private_weights_size{"CPU_PRIVATE_WEIGHTS_SIZE"};
+
+/**
+ * @brief Read-only property of a compiled model: counters of the runtime parameters cache (cached primitives and
+ * kernels for dynamic shapes) accumulated over all the streams: "hits", "misses" and "evictions".
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only property of a compiled model: statistics of the intermediate tensors memory planning: "planned_bytes"
+ * (preallocated workspace shared by the static and upper bounded dynamic tensors), "naive_bytes" (size of the same tensors
+ * allocated separately), "upper_bounded_tensors" and "unbounded_tensors" (dynamic tensors allocated at runtime).
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> memory_plan_statistics{
+    "CPU_MEMORY_PLAN_STATISTICS"};
+
+/**
+ * @brief Read-only property of a compiled model: size in bytes of the weights cached for each NUMA node (the key is
+ * the NUMA node id). The weights of a model compiled for a single stream are not cached and are not counted here.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> weights_size_per_numa_node{
+    "CPU_WEIGHTS_SIZE_PER_NUMA_NODE"};
+
+/**
+ * @brief Read-only property of a compiled model: current configuration of the streams: "streams" (active now),
+ * "max_streams" (selected at compile time), "main_core_streams" and "efficient_core_streams" (active streams on the
+ * Performance-cores and Efficient-cores), "available_processors" (not occupied by the other processes) and
+ * "adaptations". The active streams change at runtime only when the adaptive streams are enabled by the
+ * CPU_ADAPTIVE_STREAMS config key.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> streams_info{"CPU_STREAMS_INFO"};
+
 }  // namespace intel_cpu
 }  // namespace ov
@@ -12,12 +12,25 @@
 #endif
 #include <xml_parse_utils.h>
 
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
 #include "ie_itt.hpp"
+#include "meta_data.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/op/loop.hpp"
+#include "openvino/op/util/framework_node.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/op/util/variable.hpp"
 #include "openvino/pass/manager.hpp"
+#include "openvino/util/mmap_object.hpp"
+#include "openvino/util/xxhash.hpp"
 #include "transformations/fix_rt_info.hpp"
 #include "transformations/hash.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
@@ -52,6 +65,425 @@ uint64_t calculate_td(const InferenceEngine::TensorDesc& td, uint64_t _seed) {
     return seed;
 }
 
+//
+// Weights hashing
+//
+
+// Large constants are split into the chunks of this size to be hashed in parallel
+constexpr size_t weights_hash_chunk_size = 1 << 20;
+// number of memoized weights hashes, which triggers the purge of the records of the released buffers
+constexpr size_t weights_hash_min_purge_threshold = 1024;
+
+using AlignedBuffer = ngraph::runtime::AlignedBuffer;
+
+/**
+ * @brief Memoizes hashes of the constants which are views on a read only file mapping (the IR weights and the ONNX
+ * external data are memory mapped by the frontends). Such data can't be modified in-place, so the same model compiled
+ * for several devices or several times does not need to hash gigabytes of weights again.
+ * A record is valid while the buffer it was calculated for is alive.
+ */
+class WeightsHashCache {
+public:
+    static WeightsHashCache& get() {
+        static WeightsHashCache cache;
+        return cache;
+    }
+
+    static bool is_cacheable(const std::shared_ptr<AlignedBuffer>& buffer) {
+        return std::dynamic_pointer_cast<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+                   buffer) != nullptr;
+    }
+
+    bool find(const std::shared_ptr<AlignedBuffer>& buffer, uint64_t& hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_records.find(buffer.get());
+        if (it == m_records.end() || it->second.buffer.lock() != buffer) {
+            return false;
+        }
+        hash = it->second.hash;
+        return true;
+    }
+
+    void put(const std::shared_ptr<AlignedBuffer>& buffer, uint64_t hash) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_records[buffer.get()] = {buffer, hash};
+        // the records of the released buffers are purged once the number of records doubles, so a put is amortized O(1)
+        if (m_records.size() >= m_purge_threshold) {
+            for (auto it = m_records.begin(); it != m_records.end();) {
+                it = it->second.buffer.expired() ? m_records.erase(it) : std::next(it);
+            }
+            m_purge_threshold = std::max(weights_hash_min_purge_threshold, 2 * m_records.size());
+        }
+    }
+
+private:
+    struct Record {
+        std::weak_ptr<AlignedBuffer> buffer;
+        uint64_t hash;
+    };
+
+    std::mutex m_mutex;
+    std::unordered_map<const AlignedBuffer*, Record> m_records;
+    size_t m_purge_threshold = weights_hash_min_purge_threshold;
+};
+
+uint64_t calculate_weights_hash(const std::vector<std::shared_ptr<AlignedBuffer>>& weights, uint64_t seed) {
+    // the same buffer may be shared by several constants
+    std::unordered_map<const AlignedBuffer*, size_t> buffer_ids;
+    std::vector<std::shared_ptr<AlignedBuffer>> buffers;
+    std::vector<size_t> order;
+    order.reserve(weights.size());
+    for (const auto& buffer : weights) {
+        auto res = buffer_ids.emplace(buffer.get(), buffers.size());
+        if (res.second) {
+            buffers.push_back(buffer);
+        }
+        order.push_back(res.first->second);
+    }
+
+    struct Chunk {
+        size_t buffer_id;
+        size_t offset;
+        size_t size;
+    };
+    std::vector<uint64_t> hashes(buffers.size(), 0);
+    std::vector<bool> cached(buffers.size(), false);
+    std::vector<Chunk> chunks;
+    auto& cache = WeightsHashCache::get();
+    for (size_t i = 0; i < buffers.size(); i++) {
+        uint64_t hash = 0;
+        if (WeightsHashCache::is_cacheable(buffers[i]) && cache.find(buffers[i], hash)) {
+            hashes[i] = hash;
+            cached[i] = true;
+            continue;
+        }
+        const size_t size = buffers[i]->size();
+        size_t offset = 0;
+        do {
+            chunks.push_back({i, offset, std::min(weights_hash_chunk_size, size - offset)});
+            offset += weights_hash_chunk_size;
+        } while (offset < size);
+    }
+
+    std::vector<uint64_t> chunk_hashes(chunks.size());
+    ov::parallel_for(chunks.size(), [&](size_t i) {
+        const auto& chunk = chunks[i];
+        const auto data = static_cast<const uint8_t*>(buffers[chunk.buffer_id]->get_ptr()) + chunk.offset;
+        chunk_hashes[i] = ov::util::xxhash64(data, chunk.size, chunk.offset);
+    });
+
+    // chunks of a buffer are contiguous and ordered by offset
+    for (size_t i = 0; i < chunks.size();) {
+        const auto buffer_id = chunks[i].buffer_id;
+        uint64_t hash = ov::hash_combine(0, buffers[buffer_id]->size());
+        for (; i < chunks.size() && chunks[i].buffer_id == buffer_id; i++) {
+            hash = ov::hash_combine(hash, chunk_hashes[i]);
+        }
+        hashes[buffer_id] = hash;
+        if (WeightsHashCache::is_cacheable(buffers[buffer_id])) {
+            cache.put(buffers[buffer_id], hash);
+        }
+    }
+
+    for (auto id : order) {
+        seed = ov::hash_combine(seed, hashes[id]);
+    }
+    return seed;
+}
+
+//
+// Model structure hashing
+//
+
+/**
+ * @brief Calculates hash of the model structure: topology, operation types and attributes, tensor names,
+ * precisions and shapes. It covers the same information as the model serialized to IR, but walks the graph
+ * directly. The constants data is not hashed by the visitor, but collected to be hashed afterwards in parallel.
+ * If the model contains an attribute which can't be hashed, `is_supported()` returns false and the caller has
+ * to fall back to the serialization based hash.
+ */
+class ModelHashVisitor : public ov::AttributeVisitor {
+public:
+    ModelHashVisitor(uint64_t& seed, std::vector<std::shared_ptr<AlignedBuffer>>& weights)
+        : m_seed(seed),
+          m_weights(weights) {}
+
+    bool is_supported() const {
+        return m_supported;
+    }
+
+    void hash_model(const ov::Model& model) {
+        if (model.get_friendly_name() != model.get_name()) {
+            combine(model.get_friendly_name());
+        }
+
+        const auto ops = model.get_ordered_ops();
+        std::unordered_map<const ov::Node*, size_t> op_ids;
+        for (const auto& op : ops) {
+            op_ids.emplace(op.get(), op_ids.size());
+        }
+
+        for (const auto& op : ops) {
+            combine(std::string(op->get_type_name()));
+            combine(op->get_type_info().get_version());
+            // auto-generated names are unique per process, so they are not a part of the hash
+            if (op->get_friendly_name() != op->get_name()) {
+                combine(op->get_friendly_name());
+            }
+            for (const auto& input : op->inputs()) {
+                const auto source = input.get_source_output();
+                combine(op_ids.at(source.get_node()));
+                combine(source.get_index());
+            }
+            for (auto output : op->outputs()) {
+                combine(output.get_element_type().get_type_name());
+                combine(output.get_partial_shape().to_string());
+                const auto& tensor_names = output.get_tensor().get_names();
+                std::vector<std::string> names(tensor_names.begin(), tensor_names.end());
+                std::sort(names.begin(), names.end());
+                for (const auto& name : names) {
+                    combine(name);
+                }
+                hash_runtime_attributes(output.get_rt_info());
+            }
+            for (auto input : op->inputs()) {
+                hash_runtime_attributes(input.get_rt_info());
+            }
+            hash_runtime_attributes(op->get_rt_info());
+            if (!op->visit_attributes(*this)) {
+                m_supported = false;
+            }
+        }
+
+        // order of inputs and outputs is a part of the compiled model interface
+        for (const auto& parameter : model.get_parameters()) {
+            combine(op_ids.at(parameter.get()));
+        }
+        for (const auto& result : model.get_results()) {
+            combine(op_ids.at(result.get()));
+        }
+        for (const auto& sink : model.get_sinks()) {
+            combine(op_ids.at(sink.get()));
+        }
+
+        for (const auto& item : model.get_rt_info()) {
+            if (item.first != "version") {
+                hash_model_rt_info(item.first, item.second);
+            }
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<void>& adapter) override {
+        combine(name);
+        if (const auto& a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<AlignedBuffer>>>(&adapter)) {
+            combine(a->get()->size());
+            m_weights.push_back(a->get());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<std::shared_ptr<ov::op::util::Variable>>>(
+                       &adapter)) {
+            const auto info = a->get()->get_info();
+            combine(info.variable_id);
+            combine(info.data_shape.to_string());
+            combine(info.data_type.get_type_name());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            combine(attrs.get_type_name());
+            combine(attrs.get_opset_name());
+            std::map<std::string, std::string> sorted_attrs(attrs.begin(), attrs.end());
+            for (const auto& attr : sorted_attrs) {
+                combine(attr.first);
+                combine(attr.second);
+            }
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::element::TypeVector>>(&adapter)) {
+            for (const auto& type : a->get()) {
+                combine(type.get_type_name());
+            }
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::PartialShape>>(&adapter)) {
+            combine(a->get().to_string());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::Dimension>>(&adapter)) {
+            std::stringstream strm;
+            strm << a->get();
+            combine(strm.str());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<
+                       std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::InputDescription>>>>(&adapter)) {
+            hash_input_descriptions(a->get());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<
+                       std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::OutputDescription>>>>(&adapter)) {
+            hash_output_descriptions(a->get());
+        } else if (const auto& a = ov::as_type<ov::AttributeAdapter<ov::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            combine(a->get().current_iteration_input_idx);
+            combine(a->get().body_condition_output_idx);
+        } else {
+            m_supported = false;
+        }
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::shared_ptr<ov::Model>>& adapter) override {
+        combine(name);
+        hash_model(*adapter.get());
+    }
+
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<bool>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int8_t>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int16_t>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int32_t>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<int64_t>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint8_t>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint16_t>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint32_t>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<uint64_t>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<float>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<double>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<float>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<double>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ov::ValueAccessor<std::vector<std::string>>& adapter) override {
+        hash_attribute(name, adapter.get());
+    }
+
+private:
+    template <typename T>
+    void combine(const T& value) {
+        m_seed = ov::hash_combine(m_seed, value);
+    }
+
+    template <typename T>
+    void hash_attribute(const std::string& name, const T& value) {
+        combine(name);
+        combine(value);
+    }
+
+    template <typename T>
+    void hash_attribute(const std::string& name, const std::vector<T>& values) {
+        combine(name);
+        combine(values.size());
+        for (const auto& value : values) {
+            combine(value);
+        }
+    }
+
+    // the same runtime attributes as serialized to IR v11
+    void hash_runtime_attributes(ov::RTMap& rt_info) {
+        for (auto& item : rt_info) {
+            if (item.second.is<ov::RuntimeAttribute>()) {
+                auto& attribute = item.second.as<ov::RuntimeAttribute>();
+                combine(std::string(attribute.get_type_info().name));
+                attribute.visit_attributes(*this);
+            }
+        }
+    }
+
+    void hash_model_rt_info(const std::string& name, const ov::Any& data) {
+        combine(name);
+        if (data.is<std::shared_ptr<ov::Meta>>()) {
+            std::shared_ptr<ov::Meta> meta = data.as<std::shared_ptr<ov::Meta>>();
+            const ov::AnyMap& map = *meta;
+            for (const auto& item : map) {
+                hash_model_rt_info(item.first, item.second);
+            }
+        } else if (data.is<ov::AnyMap>()) {
+            for (const auto& item : data.as<ov::AnyMap>()) {
+                hash_model_rt_info(item.first, item.second);
+            }
+        } else {
+            combine(data.as<std::string>());
+        }
+    }
+
+    void hash_input_descriptions(
+        const std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::InputDescription>>& descriptions) {
+        using MultiSubGraphOp = ov::op::util::MultiSubGraphOp;
+        for (const auto& description : descriptions) {
+            combine(std::string(description->get_type_info().name));
+            combine(description->m_input_index);
+            combine(description->m_body_parameter_index);
+            if (const auto& slice = ov::as_type_ptr<MultiSubGraphOp::SliceInputDescription>(description)) {
+                combine(slice->m_start);
+                combine(slice->m_stride);
+                combine(slice->m_part_size);
+                combine(slice->m_end);
+                combine(slice->m_axis);
+            } else if (const auto& merged = ov::as_type_ptr<MultiSubGraphOp::MergedInputDescription>(description)) {
+                combine(merged->m_body_value_index);
+            }
+        }
+    }
+
+    void hash_output_descriptions(
+        const std::vector<std::shared_ptr<ov::op::util::MultiSubGraphOp::OutputDescription>>& descriptions) {
+        using MultiSubGraphOp = ov::op::util::MultiSubGraphOp;
+        for (const auto& description : descriptions) {
+            combine(std::string(description->get_type_info().name));
+            combine(description->m_body_value_index);
+            combine(description->m_output_index);
+            if (const auto& concat = ov::as_type_ptr<MultiSubGraphOp::ConcatOutputDescription>(description)) {
+                combine(concat->m_start);
+                combine(concat->m_stride);
+                combine(concat->m_part_size);
+                combine(concat->m_end);
+                combine(concat->m_axis);
+            } else if (const auto& body = ov::as_type_ptr<MultiSubGraphOp::BodyOutputDescription>(description)) {
+                combine(body->m_iteration);
+            }
+        }
+    }
+
+    uint64_t& m_seed;
+    std::vector<std::shared_ptr<AlignedBuffer>>& m_weights;
+    bool m_supported = true;
+};
+
 }  // namespace
 
 namespace ov {
@@ -88,9 +520,21 @@ std::string NetworkCompilationContext::compute_hash(const std::shared_ptr<const
     // 1. Calculate hash on function
     ov::pass::Manager m;
     m.register_pass<ov::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
     m.run_passes(std::const_pointer_cast<ov::Model>(model));
 
+    std::vector<std::shared_ptr<ngraph::runtime::AlignedBuffer>> weights;
+    ModelHashVisitor visitor(seed, weights);
+    visitor.hash_model(*model);
+    if (visitor.is_supported()) {
+        seed = calculate_weights_hash(weights, seed);
+    } else {
+        // the model has attributes unknown to the visitor, use the serialization based hash
+        seed = 0;
+        ov::pass::Manager hash_manager;
+        hash_manager.register_pass<ov::pass::Hash>(seed);
+        hash_manager.run_passes(std::const_pointer_cast<ov::Model>(model));
+    }
+
     // 2. Compute hash on serialized data and options
     for (const auto& kvp : compileOptions) {
         seed = ov::hash_combine(seed, kvp.first + kvp.second.as<std::string>());
@@ -4,7 +4,11 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
+#include <deque>
+#include <iterator>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -20,6 +24,12 @@
 
 namespace ov {
 namespace threading {
+namespace {
+// In the work stealing mode: the executor, which stream thread is the current thread, and the index of its queue
+thread_local const void* current_executor = nullptr;
+thread_local int current_queue = -1;
+}  // namespace
+
 struct CPUStreamsExecutor::Impl {
     struct Stream {
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
@@ -57,7 +67,11 @@ struct CPUStreamsExecutor::Impl {
         };
 #endif
         explicit Stream(Impl* impl) : _impl(impl) {
-            {
+            if (current_executor == _impl) {
+                // the stream threads of the work stealing mode have the ids of their queues, so the stream is
+                // bound to the NUMA node of its group
+                _streamId = current_queue;
+            } else {
                 std::lock_guard<std::mutex> lock{_impl->_streamIdMutex};
                 if (_impl->_streamIdQueue.empty()) {
                     _streamId = _impl->_streamId++;
@@ -66,11 +80,7 @@ struct CPUStreamsExecutor::Impl {
                     _impl->_streamIdQueue.pop();
                 }
             }
-            _numaNodeId = _impl->_config._streams
-                              ? _impl->_usedNumaNodes.at((_streamId % _impl->_config._streams) /
-                                                         ((_impl->_config._streams + _impl->_usedNumaNodes.size() - 1) /
-                                                          _impl->_usedNumaNodes.size()))
-                              : _impl->_usedNumaNodes.at(_streamId % _impl->_usedNumaNodes.size());
+            _numaNodeId = _impl->GetNumaNodeId(_streamId);
 #if OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO
             const auto concurrency = (0 == _impl->_config._threadsPerStream) ? custom::task_arena::automatic
                                                                              : _impl->_config._threadsPerStream;
@@ -225,6 +235,29 @@ struct CPUStreamsExecutor::Impl {
 #endif
     };
 
+    // The local queue of the stream thread in the work stealing mode
+    struct StreamQueue {
+        std::mutex _mutex;
+        std::deque<Task> _tasks;
+    };
+
+    // The stream threads of the same NUMA node, they steal the tasks from the queues of each other
+    struct StreamGroup {
+        std::vector<int> _queues;
+        std::mutex _mutex;
+        std::condition_variable _condVar;
+        // the tasks in the queues of the group, incremented under _mutex after the task is pushed, so it may be
+        // negative for a moment when the task is stolen right away
+        std::atomic<int> _numTasks{0};
+    };
+
+    int GetNumaNodeId(int streamId) const {
+        return _config._streams
+                   ? _usedNumaNodes.at((streamId % _config._streams) /
+                                       ((_config._streams + _usedNumaNodes.size() - 1) / _usedNumaNodes.size()))
+                   : _usedNumaNodes.at(streamId % _usedNumaNodes.size());
+    }
+
     explicit Impl(const Config& config)
         : _config{config},
           _streams([this] {
@@ -269,6 +302,10 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        if (_config._work_stealing) {
+            StartWorkStealingStreams();
+            return;
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
@@ -292,7 +329,123 @@ struct CPUStreamsExecutor::Impl {
         }
     }
 
+    void StartWorkStealingStreams() {
+        // the ids [0, _streams) are reserved for the stream threads
+        _streamId = _config._streams;
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _queues.emplace_back(new StreamQueue);
+            const auto numaNodeId = GetNumaNodeId(streamId);
+            auto group = std::find_if(_groups.begin(), _groups.end(), [&](const std::unique_ptr<StreamGroup>& g) {
+                return GetNumaNodeId(g->_queues.front()) == numaNodeId;
+            });
+            if (group == _groups.end()) {
+                _groups.emplace_back(new StreamGroup);
+                group = std::prev(_groups.end());
+            }
+            (*group)->_queues.push_back(streamId);
+            _queueGroups.push_back(group->get());
+        }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _threads.emplace_back([this, streamId] {
+                openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
+                current_executor = this;
+                current_queue = streamId;
+                auto& group = *_queueGroups[streamId];
+                for (;;) {
+                    Task task;
+                    if (PopOrSteal(streamId, task)) {
+                        Execute(task, *(_streams.local()));
+                        continue;
+                    }
+                    std::unique_lock<std::mutex> lock(group._mutex);
+                    // the queues are drained before the executor is stopped
+                    group._condVar.wait(lock, [&] {
+                        return group._numTasks > 0 || _isStopped;
+                    });
+                    if (group._numTasks <= 0 && _isStopped)
+                        break;
+                }
+                current_executor = nullptr;
+                current_queue = -1;
+            });
+        }
+    }
+
+    bool PopOrSteal(int queueIdx, Task& task) {
+        auto& group = *_queueGroups[queueIdx];
+        // the own tasks are executed in the order of submission
+        {
+            auto& queue = *_queues[queueIdx];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            if (!queue._tasks.empty()) {
+                task = std::move(queue._tasks.front());
+                queue._tasks.pop_front();
+                group._numTasks--;
+                return true;
+            }
+        }
+        // the victims are visited starting from the next stream, so the thieves don't contend for the same queue
+        const auto& victims = group._queues;
+        const auto self =
+            static_cast<std::size_t>(std::find(victims.begin(), victims.end(), queueIdx) - victims.begin());
+        for (std::size_t i = 1; i < victims.size(); i++) {
+            auto& queue = *_queues[victims[(self + i) % victims.size()]];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            if (!queue._tasks.empty()) {
+                task = std::move(queue._tasks.back());
+                queue._tasks.pop_back();
+                group._numTasks--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void EnqueueWorkStealing(Task task) {
+        // the tasks submitted by the stream stay in its queue, while the other streams of its NUMA node can steal them
+        // if the stream waits for them. The rest, and the tasks of the stream which NUMA node has no other streams, are
+        // distributed in the round-robin fashion, skipping the queue of the submitting stream
+        const bool nested = current_executor == this;
+        const auto numQueues = _queues.size();
+        int queueIdx = 0;
+        if (nested && (_queueGroups[current_queue]->_queues.size() > 1 || numQueues == 1)) {
+            queueIdx = current_queue;
+        } else if (nested) {
+            queueIdx = static_cast<int>((current_queue + 1 + _nextQueue++ % (numQueues - 1)) % numQueues);
+        } else {
+            queueIdx = static_cast<int>(_nextQueue++ % numQueues);
+        }
+        {
+            auto& queue = *_queues[queueIdx];
+            std::lock_guard<std::mutex> lock(queue._mutex);
+            queue._tasks.emplace_back(std::move(task));
+        }
+        auto& group = *_queueGroups[queueIdx];
+        {
+            std::lock_guard<std::mutex> lock(group._mutex);
+            group._numTasks++;
+        }
+        group._condVar.notify_one();
+    }
+
+    void Stop() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isStopped = true;
+        }
+        _queueCondVar.notify_all();
+        for (auto& group : _groups) {
+            // the flag is checked by the stream threads of the group under the group mutex
+            { std::lock_guard<std::mutex> lock(group->_mutex); }
+            group->_condVar.notify_all();
+        }
+    }
+
     void Enqueue(Task task) {
+        if (_config._work_stealing) {
+            EnqueueWorkStealing(std::move(task));
+            return;
+        }
         {
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
@@ -337,8 +490,12 @@ struct CPUStreamsExecutor::Impl {
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
     std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    std::atomic<bool> _isStopped{false};
     std::vector<int> _usedNumaNodes;
+    std::vector<std::unique_ptr<StreamQueue>> _queues;
+    std::vector<std::unique_ptr<StreamGroup>> _groups;
+    std::vector<StreamGroup*> _queueGroups;
+    std::atomic<std::size_t> _nextQueue{0};
     ov::threading::ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
     // stream id mapping to the core type
@@ -366,11 +523,7 @@ CPUStreamsExecutor::CPUStreamsExecutor(const ov::threading::IStreamsExecutor::Co
     : _impl{new Impl{config}} {}
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
-    {
-        std::lock_guard<std::mutex> lock(_impl->_mutex);
-        _impl->_isStopped = true;
-    }
-    _impl->_queueCondVar.notify_all();
+    _impl->Stop();
     for (auto& thread : _impl->_threads) {
         if (thread.joinable()) {
             thread.join();
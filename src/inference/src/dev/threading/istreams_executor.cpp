@@ -207,6 +207,14 @@ void IStreamsExecutor::Config::set_property(const ov::AnyMap& property) {
             } else {
                 OPENVINO_UNREACHABLE("Unsupported enable hyper thread type");
             }
+        } else if (key == CONFIG_KEY_INTERNAL(WORK_STEALING)) {
+            if (value.as<std::string>() == CONFIG_VALUE(YES)) {
+                _work_stealing = true;
+            } else if (value.as<std::string>() == CONFIG_VALUE(NO)) {
+                _work_stealing = false;
+            } else {
+                OPENVINO_UNREACHABLE("Unsupported work stealing type");
+            }
         } else {
             IE_THROW() << "Wrong value for property key " << key;
         }
@@ -226,6 +234,7 @@ ov::Any IStreamsExecutor::Config::get_property(const std::string& key) const {
             CONFIG_KEY_INTERNAL(THREADS_PER_STREAM_SMALL),
             CONFIG_KEY_INTERNAL(SMALL_CORE_OFFSET),
             CONFIG_KEY_INTERNAL(ENABLE_HYPER_THREAD),
+            CONFIG_KEY_INTERNAL(WORK_STEALING),
             ov::num_streams.name(),
             ov::inference_num_threads.name(),
             ov::affinity.name(),
@@ -275,6 +284,8 @@ ov::Any IStreamsExecutor::Config::get_property(const std::string& key) const {
         return {std::to_string(_small_core_offset)};
     } else if (key == CONFIG_KEY_INTERNAL(ENABLE_HYPER_THREAD)) {
         return {_enable_hyper_thread ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
+    } else if (key == CONFIG_KEY_INTERNAL(WORK_STEALING)) {
+        return {_work_stealing ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)};
     } else {
         OPENVINO_UNREACHABLE("Wrong value for property key ", key);
     }
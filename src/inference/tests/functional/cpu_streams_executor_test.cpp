@@ -0,0 +1,180 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "openvino/runtime/system_conf.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+
+using namespace ov::threading;
+
+namespace {
+IStreamsExecutor::Config makeConfig(int streams, bool workStealing) {
+    IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE};
+    config._work_stealing = workStealing;
+    return config;
+}
+
+// two streams per NUMA node, so every stream has a neighbour to steal the tasks from
+int streamsWithNeighbours() {
+    return static_cast<int>(ov::get_available_numa_nodes().size()) * 2;
+}
+
+// one stream per NUMA node, so no stream can steal the tasks of another one, but at least two streams
+int streamsWithoutNeighbours() {
+    return std::max(2, static_cast<int>(ov::get_available_numa_nodes().size()));
+}
+}  // namespace
+
+TEST(CPUStreamsExecutorWorkStealingTests, runsAllTasksFromMultipleThreads) {
+    std::atomic<int> counter{0};
+    const int producers = 4, tasksPerProducer = 1000;
+    {
+        CPUStreamsExecutor executor{makeConfig(streamsWithNeighbours(), true)};
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; p++) {
+            threads.emplace_back([&] {
+                for (int i = 0; i < tasksPerProducer; i++) {
+                    executor.run([&] {
+                        counter++;
+                    });
+                }
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+        // the executor drains the queues before it's destroyed
+    }
+    ASSERT_EQ(producers * tasksPerProducer, counter.load());
+}
+
+TEST(CPUStreamsExecutorWorkStealingTests, tasksOfBusyStreamAreStolen) {
+    CPUStreamsExecutor executor{makeConfig(streamsWithNeighbours(), true)};
+    std::promise<bool> result;
+    executor.run([&] {
+        // the tasks submitted by the stream go to its own queue, while the stream is blocked by waiting for them
+        const auto streamId = executor.get_stream_id();
+        std::vector<std::future<int>> futures;
+        for (int i = 0; i < 2; i++) {
+            auto task = std::make_shared<std::packaged_task<int()>>([&] {
+                return executor.get_stream_id();
+            });
+            futures.push_back(task->get_future());
+            executor.run([task] {
+                (*task)();
+            });
+        }
+        bool stolen = true;
+        for (auto& future : futures) {
+            stolen = stolen && future.wait_for(std::chrono::seconds(10)) == std::future_status::ready &&
+                     future.get() != streamId;
+        }
+        result.set_value(stolen);
+    });
+    auto future = result.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(20)));
+    ASSERT_TRUE(future.get());
+}
+
+TEST(CPUStreamsExecutorWorkStealingTests, nestedTasksOfStreamWithoutNeighboursAreRun) {
+    CPUStreamsExecutor executor{makeConfig(streamsWithoutNeighbours(), true)};
+    std::promise<bool> result;
+    executor.run([&] {
+        // the stream is blocked by waiting for the tasks it submitted, they are run by the streams of other NUMA nodes
+        auto task = std::make_shared<std::packaged_task<void()>>([] {});
+        auto future = task->get_future();
+        executor.run([task] {
+            (*task)();
+        });
+        result.set_value(future.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    });
+    auto future = result.get_future();
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(20)));
+    ASSERT_TRUE(future.get());
+}
+
+TEST(CPUStreamsExecutorWorkStealingTests, streamIdsAreUnique) {
+    const int streams = streamsWithNeighbours();
+    CPUStreamsExecutor executor{makeConfig(streams, true)};
+    std::mutex mutex;
+    std::vector<int> ids;
+    std::vector<std::future<void>> futures;
+    std::atomic<int> started{0};
+    for (int i = 0; i < streams; i++) {
+        auto task = std::make_shared<std::packaged_task<void()>>([&] {
+            // keeps every stream busy until all of them took a task
+            started++;
+            while (started < streams)
+                std::this_thread::yield();
+            std::lock_guard<std::mutex> lock(mutex);
+            ids.push_back(executor.get_stream_id());
+        });
+        futures.push_back(task->get_future());
+        executor.run([task] {
+            (*task)();
+        });
+    }
+    for (auto& future : futures)
+        ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(20)));
+    std::sort(ids.begin(), ids.end());
+    for (int i = 0; i < streams; i++)
+        EXPECT_EQ(i, ids[i]);
+}
+
+// Compares the throughput and the latency percentiles of the shared queue and the work stealing modes on the tasks
+// of different duration, like the infer requests with dynamic shapes
+TEST(CPUStreamsExecutorWorkStealingTests, DISABLED_benchmark) {
+    using Clock = std::chrono::steady_clock;
+    const int streams = static_cast<int>(std::max(2u, std::thread::hardware_concurrency() / 2));
+    const int tasks = 20000;
+    std::mt19937 gen(42);
+    // most of the tasks are short, some are 100 times longer
+    std::vector<std::chrono::microseconds> durations(tasks);
+    for (auto& duration : durations)
+        duration = std::chrono::microseconds(gen() % 10 == 0 ? 1000 : 10);
+
+    for (const bool workStealing : {false, true}) {
+        std::vector<double> latencies(tasks);
+        std::vector<std::future<void>> futures;
+        futures.reserve(tasks);
+        const auto start = Clock::now();
+        {
+            CPUStreamsExecutor executor{makeConfig(streams, workStealing)};
+            for (int i = 0; i < tasks; i++) {
+                const auto submitted = Clock::now();
+                auto task = std::make_shared<std::packaged_task<void()>>([&, i, submitted] {
+                    const auto end = Clock::now() + durations[i];
+                    while (Clock::now() < end) {
+                    }
+                    latencies[i] = std::chrono::duration<double, std::milli>(Clock::now() - submitted).count();
+                });
+                futures.push_back(task->get_future());
+                executor.run([task] {
+                    (*task)();
+                });
+            }
+            for (auto& future : futures)
+                future.wait();
+        }
+        const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        std::sort(latencies.begin(), latencies.end());
+        auto percentile = [&](double p) {
+            return latencies[static_cast<size_t>(p * (latencies.size() - 1))];
+        };
+        std::cout << (workStealing ? "work stealing" : "shared queue") << ": " << tasks / elapsed << " tasks/s"
+                  << ", latency p50 " << percentile(0.5) << " ms, p90 " << percentile(0.9) << " ms, p99 "
+                  << percentile(0.99) << " ms" << std::endl;
+    }
+}
@@ -16,6 +16,10 @@
 #include "ngraph/function.hpp"
 #include "ngraph/ops.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/util/mmap_object.hpp"
+#include "transformations/hash.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
 
@@ -334,6 +338,175 @@ TEST(NetworkContext, HashOfSameMultiThreading) {
     ASSERT_FALSE(fail);
 }
 
+template <class T>
+static std::shared_ptr<ov::Model> create_function_with_weights(
+    const std::shared_ptr<ngraph::runtime::SharedBuffer<T>>& shared_weights) {
+    // Parameter--->MatMul--->Result
+    //   Constant---'
+    const size_t ic = 64;
+    const size_t oc = shared_weights->size() / (ic * sizeof(float));
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, ic});
+    data->set_friendly_name("Parameter");
+    auto constant =
+        std::make_shared<ngraph::opset6::Constant>(ngraph::element::f32, ngraph::Shape{ic, oc}, shared_weights);
+    constant->set_friendly_name("weights");
+    auto matmul = std::make_shared<ngraph::opset6::MatMul>(data, constant);
+    matmul->set_friendly_name("matmul");
+    auto res = std::make_shared<ngraph::opset6::Result>(matmul);
+    return std::make_shared<ov::Model>(ngraph::ResultVector{res}, ngraph::ParameterVector{data});
+}
+
+static std::shared_ptr<ov::Model> create_function_with_weights(
+    const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights) {
+    return create_function_with_weights(
+        std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+            weights->get_ptr<char>(),
+            weights->size(),
+            weights));
+}
+
+static std::shared_ptr<ngraph::runtime::AlignedBuffer> create_weights(size_t size) {
+    auto weights = std::make_shared<ngraph::runtime::AlignedBuffer>(size);
+    auto ptr = weights->get_ptr<uint8_t>();
+    for (size_t i = 0; i < size; i++)
+        ptr[i] = static_cast<uint8_t>((i * 31 + 7) ^ (i >> 8));
+    return weights;
+}
+
+TEST(NetworkContext, HashWithDifferentWeights) {
+    // the weights are larger than a single chunk hashed by a thread
+    const size_t size = 64 * 4097 * sizeof(float);
+    auto weights1 = create_weights(size);
+    auto weights2 = create_weights(size);
+    auto model1 = create_function_with_weights(weights1);
+    auto model2 = create_function_with_weights(weights2);
+    ASSERT_EQ(NetworkCompilationContext::compute_hash(model1, {}), NetworkCompilationContext::compute_hash(model2, {}));
+
+    auto weights3 = create_weights(size);
+    weights3->get_ptr<uint8_t>()[size - 1] ^= 1;
+    auto weights4 = create_weights(size);
+    weights4->get_ptr<uint8_t>()[size / 2] ^= 1;
+    ASSERT_NE(NetworkCompilationContext::compute_hash(model1, {}),
+              NetworkCompilationContext::compute_hash(create_function_with_weights(weights3), {}));
+    ASSERT_NE(NetworkCompilationContext::compute_hash(model1, {}),
+              NetworkCompilationContext::compute_hash(create_function_with_weights(weights4), {}));
+}
+
+TEST(NetworkContext, HashOfSharedWeightsIsUpdated) {
+    const size_t size = 64 * 4097 * sizeof(float);
+    auto weights = create_weights(size);
+    auto model = create_function_with_weights(weights);
+    const auto hash = NetworkCompilationContext::compute_hash(model, {});
+
+    // the weights in the heap may be changed in-place, so their hash is never reused
+    weights->get_ptr<uint8_t>()[0] ^= 1;
+    const auto updated_hash = NetworkCompilationContext::compute_hash(model, {});
+    ASSERT_NE(hash, updated_hash);
+    ASSERT_EQ(updated_hash, NetworkCompilationContext::compute_hash(create_function_with_weights(weights), {}));
+}
+
+TEST(NetworkContext, HashOfMappedWeights) {
+    const size_t size = 64 * 4097 * sizeof(float);
+    auto weights = create_weights(size);
+    const auto file_name = CommonTestUtils::generateTestFilePrefix() + "_weights.bin";
+    FileGuard guard(file_name);
+    {
+        std::ofstream os(file_name, std::ios::binary);
+        os.write(weights->get_ptr<char>(), size);
+    }
+
+    auto mapped_memory = ov::util::load_mmap_object(file_name);
+    ASSERT_EQ(size, mapped_memory->size());
+    auto mapped_weights =
+        std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(mapped_memory->data(),
+                                                                                                  size,
+                                                                                                  mapped_memory);
+    auto mapped_model = create_function_with_weights(mapped_weights);
+
+    // the memoized hash of the read only mapping is the same as the hash of the same data in the heap
+    const auto hash = NetworkCompilationContext::compute_hash(create_function_with_weights(weights), {});
+    ASSERT_EQ(hash, NetworkCompilationContext::compute_hash(mapped_model, {}));
+    ASSERT_EQ(hash, NetworkCompilationContext::compute_hash(mapped_model, {}));
+}
+
+static std::shared_ptr<ov::Model> create_tensor_iterator_function(int64_t axis) {
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{2, 4, 8});
+    data->set_friendly_name("Parameter");
+
+    auto body_data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::PartialShape::dynamic());
+    auto body_relu = std::make_shared<ngraph::opset6::Relu>(body_data);
+    auto body_res = std::make_shared<ngraph::opset6::Result>(body_relu);
+    auto body = std::make_shared<ov::Model>(ngraph::ResultVector{body_res}, ngraph::ParameterVector{body_data});
+
+    auto tensor_iterator = std::make_shared<ngraph::opset6::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(body_data, data, 0, 1, 1, -1, axis);
+    auto out = tensor_iterator->get_concatenated_slices(body_res, 0, 1, 1, -1, axis);
+    tensor_iterator->set_friendly_name("tensor_iterator");
+
+    auto res = std::make_shared<ngraph::opset6::Result>(out);
+    return std::make_shared<ov::Model>(ngraph::ResultVector{res}, ngraph::ParameterVector{data});
+}
+
+TEST(NetworkContext, HashWithTensorIterator) {
+    ASSERT_EQ(NetworkCompilationContext::compute_hash(create_tensor_iterator_function(1), {}),
+              NetworkCompilationContext::compute_hash(create_tensor_iterator_function(1), {}));
+    ASSERT_NE(NetworkCompilationContext::compute_hash(create_tensor_iterator_function(1), {}),
+              NetworkCompilationContext::compute_hash(create_tensor_iterator_function(2), {}));
+}
+
+// Compares the time to calculate the model hash on cache hit with the serialization based hash
+TEST(NetworkContext, DISABLED_HashOfLargeModelPerformance) {
+    const size_t layers = 32;
+    const size_t size = 4096 * 4096 * sizeof(float);
+    const auto file_name = CommonTestUtils::generateTestFilePrefix() + "_weights.bin";
+    FileGuard guard(file_name);
+    {
+        std::ofstream os(file_name, std::ios::binary);
+        auto weights = create_weights(size);
+        for (size_t i = 0; i < layers; i++)
+            os.write(weights->get_ptr<char>(), size);
+    }
+    // the hashes are memoized only for the weights in a read only file mapping
+    auto mapped_memory = ov::util::load_mmap_object(file_name);
+
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 4096});
+    ov::Output<ov::Node> out = data;
+    for (size_t i = 0; i < layers; i++) {
+        auto shared_weights =
+            std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+                mapped_memory->data() + i * size,
+                size,
+                mapped_memory);
+        auto constant =
+            std::make_shared<ngraph::opset6::Constant>(ngraph::element::f32, ngraph::Shape{4096, 4096}, shared_weights);
+        out = std::make_shared<ngraph::opset6::MatMul>(out, constant);
+    }
+    auto model = std::make_shared<ov::Model>(ngraph::ResultVector{std::make_shared<ngraph::opset6::Result>(out)},
+                                             ngraph::ParameterVector{data});
+
+    auto measure = [](const std::function<void()>& func) {
+        auto start = high_resolution_clock::now();
+        func();
+        return duration_cast<milliseconds>(high_resolution_clock::now() - start).count();
+    };
+    const auto serialization_time = measure([&] {
+        uint64_t hash = 0;
+        ov::pass::Manager m;
+        m.register_pass<ov::pass::Hash>(hash);
+        m.run_passes(model);
+    });
+    const auto first_time = measure([&] {
+        NetworkCompilationContext::compute_hash(model, {});
+    });
+    const auto cache_hit_time = measure([&] {
+        NetworkCompilationContext::compute_hash(model, {});
+    });
+    std::cout << "Model with " << layers * size / (1024 * 1024) << " MB of weights: serialization based hash "
+              << serialization_time << " ms, structural hash " << first_time << " ms, memoized structural hash "
+              << cache_hit_time << " ms" << std::endl;
+}
+
 ////////////////////////////////////////////
 
 TEST(NetworkContext_ModelName, HashOfSame) {
@@ -149,6 +149,9 @@ void AutoSchedule::init(const ScheduleContext::Ptr& sContext) {
             if (_autoSContext->_bindBuffer)
                 _loadContext[ACTUALDEVICE].deviceInfo.config[ov::intel_auto::device_bind_buffer.name()] =
                     InferenceEngine::PluginConfigParams::YES;
+            if (_autoSContext->_schedulePolicy != ov::intel_auto::SchedulePolicy::DEFAULT)
+                _loadContext[ACTUALDEVICE].deviceInfo.config[ov::intel_auto::schedule_policy.name()] =
+                    ov::Any(_autoSContext->_schedulePolicy).as<std::string>();
         }
     } else {
         _loadContext[ACTUALDEVICE].deviceInfo =
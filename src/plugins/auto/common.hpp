@@ -57,6 +57,7 @@ struct WorkerInferRequest {
     std::exception_ptr _exceptionPtr = nullptr;
     std::list<Time>    _startTimes;
     std::list<Time>    _endTimes;
+    Time               _scheduledTime;
     int                _index = 0;
 };
 
@@ -124,6 +125,7 @@ public:
     bool                                           _batchingDisabled = {false};
     bool                                           _bindBuffer = false;
     bool                                           _startupfallback = true;
+    ov::intel_auto::SchedulePolicy                 _schedulePolicy = ov::intel_auto::SchedulePolicy::DEFAULT;
     virtual ~MultiScheduleContext() = default;
 };
 
@@ -7,6 +7,8 @@
 #include "plugin.hpp"
 #include "multi_schedule.hpp"
 #include "multi_executable_network.hpp"
+
+#include <limits>
 // ------------------------------MultiSchedule----------------------------
 namespace MultiDevicePlugin {
 
@@ -14,10 +16,46 @@ thread_local WorkerInferRequest* MultiSchedule::_thisWorkerInferRequest = nullpt
 // TODO: revert to the plain variable (see header file), when we moved to the next CentOS 8.x in our support matrix
 thread_local const char* MultiSchedule::_thisPreferredDeviceName = "";
 
+void DeviceLatencyStats::Update(double latencyMs) {
+    // the weight of the last measurement, the average follows the changes of the device load in ~10 requests
+    constexpr double decay = 0.2;
+    latency = samples == 0 ? latencyMs : latency + decay * (latencyMs - latency);
+    samples++;
+}
+
+double DeviceLatencyStats::ExpectedCompletionTime() const {
+    // number of the requests that have to be completed before the worker is available for the next one
+    const double queued = static_cast<double>(inflight + pending + 1) - static_cast<double>(workers);
+    if (queued <= 0)
+        return latency;
+    if (samples == 0 || workers == 0)
+        return std::numeric_limits<double>::infinity();
+    // the workers complete the requests in parallel, one of them is released every latency / workers ms
+    return latency + queued * latency / workers;
+}
+
+DeviceName SelectFastestDevice(const std::vector<DeviceInformation>& devices, const DeviceMap<DeviceLatencyStats>& stats) {
+    DeviceName fastest;
+    double fastestTime = std::numeric_limits<double>::infinity();
+    // the devices without measurements are tried first, the ties are resolved by the device priorities
+    for (auto&& device : devices) {
+        auto it = stats.find(device.deviceName);
+        if (it == stats.end())
+            continue;
+        const auto time = it->second.ExpectedCompletionTime();
+        if (time < fastestTime) {
+            fastest = device.deviceName;
+            fastestTime = time;
+        }
+    }
+    return fastest;
+}
+
 void MultiSchedule::init(const ScheduleContext::Ptr& sContext) {
     _cpuHelpReleaseTime = std::chrono::steady_clock::now();
     _LogTag = sContext->_LogTag;
     _multiSContext = std::dynamic_pointer_cast<MultiScheduleContext>(sContext);
+    _latencyAware = _multiSContext->_schedulePolicy == ov::intel_auto::SchedulePolicy::LATENCY_AWARE;
     for (auto&& networkValue : _multiSContext->_networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -143,6 +181,8 @@ void MultiSchedule::GenerateWorkers(const std::string& device,
     _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<IE::ThreadSafeQueue<IE::Task>>(new IE::ThreadSafeQueue<IE::Task>);
     auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
     idleWorkerRequests.set_capacity(numRequests);
+    if (_latencyAware)
+        _latencyStats[device].workers = numRequests;
     int num = 0;
     for (auto&& workerRequest : workerRequests) {
         workerRequest._inferRequest = {executableNetwork->CreateInferRequest(), executableNetwork._so};
@@ -153,6 +193,14 @@ void MultiSchedule::GenerateWorkers(const std::string& device,
             [workerRequestPtr, this, device, idleWorkerRequestsPtr](std::exception_ptr exceptionPtr) mutable {
                 IdleGuard<NotBusyWorkerRequests> idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
                 workerRequestPtr->_exceptionPtr = exceptionPtr;
+                if (_latencyAware) {
+                    std::chrono::duration<double, std::milli> latency =
+                        std::chrono::steady_clock::now() - workerRequestPtr->_scheduledTime;
+                    std::lock_guard<std::mutex> lock(_latencyMutex);
+                    auto& stats = _latencyStats[device];
+                    stats.Update(latency.count());
+                    stats.inflight--;
+                }
                 {
                     auto capturedTask = std::move(workerRequestPtr->_task);
                     capturedTask();
@@ -165,6 +213,10 @@ void MultiSchedule::GenerateWorkers(const std::string& device,
                     if (_inferPipelineTasks.try_pop(t)) {
                         ScheduleToWorkerInferRequest(std::move(t));
                     } else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t)) {
+                        if (_latencyAware) {
+                            std::lock_guard<std::mutex> lock(_latencyMutex);
+                            _latencyStats[device].pending--;
+                        }
                         ScheduleToWorkerInferRequest(std::move(t), device);
                     }
                 }
@@ -178,16 +230,46 @@ bool MultiSchedule::ScheduleToWorkerInferRequest(IE::Task inferPipelineTask, Dev
         std::lock_guard<std::mutex> lock(_multiSContext->_mutex);
         return _multiSContext->_devicePriorities;
     }();
+    if (_latencyAware && preferred_device.empty()) {
+        // the task waits for the worker of the device expected to complete it first rather than takes any idle one
+        std::lock_guard<std::mutex> lock(_latencyMutex);
+        preferred_device = SelectFastestDevice(devices, _latencyStats);
+    }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device)) {
             continue;
         }
-        if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], preferred_device)) {
+        if (!_latencyAware) {
+            if (RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], preferred_device)) {
+                return true;
+            }
+            continue;
+        }
+        // counted before the task is started, as the request may be completed before RunPipelineTask returns
+        auto countInflight = [&](bool increment) {
+            std::lock_guard<std::mutex> lock(_latencyMutex);
+            auto& inflight = _latencyStats[device.deviceName].inflight;
+            inflight = increment ? inflight + 1 : inflight - 1;
+        };
+        countInflight(true);
+        bool started = false;
+        try {
+            started = RunPipelineTask(inferPipelineTask, _idleWorkerRequests[device.deviceName], preferred_device);
+        } catch (...) {
+            countInflight(false);
+            throw;
+        }
+        if (started) {
             return true;
         }
+        countInflight(false);
     }
     // no vacant requests this time, storing the task to the respective queue
     if (!preferred_device.empty()) {
+        if (_latencyAware) {
+            std::lock_guard<std::mutex> lock(_latencyMutex);
+            _latencyStats[preferred_device].pending++;
+        }
         _inferPipelineTasksDeviceSpecific[preferred_device]->push(std::move(
                 inferPipelineTask));
     } else {
@@ -203,6 +285,7 @@ bool MultiSchedule::RunPipelineTask(IE::Task& inferPipelineTask,
     if (idleWorkerRequests.try_pop(workerRequestPtr)) {
         IdleGuard<NotBusyWorkerRequests> idleGuard{workerRequestPtr, idleWorkerRequests};
         _thisWorkerInferRequest = workerRequestPtr;
+        workerRequestPtr->_scheduledTime = std::chrono::steady_clock::now();
         {
             auto capturedTask = std::move(inferPipelineTask);
             capturedTask();
@@ -24,6 +24,21 @@ struct ThisRequestExecutor : public IE::ITaskExecutor {
     WorkerInferRequest** _workptrptr = nullptr;
 };
 
+// Statistics of the device collected at runtime for the LATENCY_AWARE schedule policy
+struct DeviceLatencyStats {
+    double latency  = 0.0;  // moving average of the request latency in ms, from the scheduling to the completion
+    size_t samples  = 0;
+    size_t workers  = 0;    // number of the worker infer requests of the device
+    size_t inflight = 0;    // requests being executed by the workers
+    size_t pending  = 0;    // tasks waiting in the device-specific queue for a worker
+    void Update(double latencyMs);
+    // time in ms, after which the next request sent to the device is expected to be completed
+    double ExpectedCompletionTime() const;
+};
+
+// Returns the device expected to complete the next request first, or the empty name if it's unknown
+DeviceName SelectFastestDevice(const std::vector<DeviceInformation>& devices, const DeviceMap<DeviceLatencyStats>& stats);
+
 class MultiSchedule : public Schedule, public IE::ITaskExecutor {
 public:
     using Ptr = std::shared_ptr<MultiSchedule>;
@@ -62,6 +77,9 @@ protected:
     unsigned int                                              _cpuHelpInferCount = 0;
     double                                                    _cpuHelpFps = 0.0;
     std::string                                               _LogTag;
+    bool                                                      _latencyAware = false;
+    std::mutex                                                _latencyMutex;
+    DeviceMap<DeviceLatencyStats>                             _latencyStats;
 };
 
 }  // namespace MultiDevicePlugin
@@ -485,6 +485,7 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
         autoSContext->_LogTag = _LogTag;
         autoSContext->_bindBuffer = loadConfig.get_property(ov::intel_auto::device_bind_buffer);
         autoSContext->_startupfallback = loadConfig.get_property(ov::intel_auto::enable_startup_fallback);
+        autoSContext->_schedulePolicy = loadConfig.get_property(ov::intel_auto::schedule_policy);
         return std::make_shared<AutoExecutableNetwork>(autoSContext, std::make_shared<AutoSchedule>());
     }
     OV_ITT_SCOPED_TASK(itt::domains::MULTIPlugin, "MultiDeviceInferencePlugin::LoadNetworkImpl:MultiMode");
@@ -647,6 +648,8 @@ IExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadNetworkImpl(cons
         multiSContext->_bindBuffer = true;
         impl = std::make_shared<MultiExecutableNetwork>(multiSContext, std::make_shared<BinderMultiSchedule>());
     } else {
+        // the requests are bound to the devices of the buffers with DEVICE_BIND_BUFFER, so the policy applies here only
+        multiSContext->_schedulePolicy = loadConfig.get_property(ov::intel_auto::schedule_policy);
         impl = std::make_shared<MultiExecutableNetwork>(multiSContext, std::make_shared<MultiSchedule>());
     }
     if (!modelPath.empty()) {
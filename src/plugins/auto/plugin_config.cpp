@@ -26,6 +26,7 @@ void PluginConfig::set_default() {
         std::make_tuple(ov::hint::execution_mode, ov::hint::ExecutionMode::UNDEFINED),
         std::make_tuple(ov::hint::num_requests, 0, UnsignedTypeValidator()),
         std::make_tuple(ov::intel_auto::enable_startup_fallback, true),
+        std::make_tuple(ov::intel_auto::schedule_policy, ov::intel_auto::SchedulePolicy::DEFAULT),
         // TODO 1) cache_dir 2) allow_auto_batch 3) auto_batch_timeout
         std::make_tuple(ov::cache_dir, ""),
         std::make_tuple(ov::hint::allow_auto_batching, true),
@@ -5,6 +5,7 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "auto_batch.hpp"
 
+#include <cmath>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -29,7 +30,12 @@ using namespace InferenceEngine;
 
 std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
                                                  CONFIG_KEY(AUTO_BATCH_TIMEOUT),
-                                                 CONFIG_KEY(CACHE_DIR)};
+                                                 CONFIG_KEY(CACHE_DIR),
+                                                 CONFIG_KEY_INTERNAL(AUTO_BATCH_ADAPTIVE_TIMEOUT)};
+
+// the current time to collect a batch (in us) and the ratio of the requests executed as a part of the full batch
+static constexpr auto metricBatchWindow = "AUTO_BATCH_WINDOW_US";
+static constexpr auto metricBatchFillRatio = "AUTO_BATCH_FILL_RATIO";
 
 template <Precision::ePrecision precision>
 Blob::Ptr create_shared_blob_on_top_of_batched_blob(Blob::Ptr batched_blob,
@@ -386,10 +392,13 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
+            if (workerInferRequest._adaptiveTimeout)
+                workerInferRequest._batchTimeout.OnArrival(AdaptiveBatchTimeout::Clock::now());
             workerInferRequest._tasks.push(t);
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = static_cast<int>(workerInferRequest._tasks.size());
-            if (sz == workerInferRequest._batchSize) {
+            // with the adaptive timeout the first request starts the time window to collect the batch
+            if (sz == workerInferRequest._batchSize || (workerInferRequest._adaptiveTimeout && sz == 1)) {
                 workerInferRequest._cond.notify_one();
             }
         };
@@ -425,6 +434,50 @@ AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
     StopAndWait();
 }
 
+// ------------------------------AdaptiveBatchTimeout----------------------------
+void AdaptiveBatchTimeout::OnArrival(Clock::time_point time) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_hasArrivals) {
+        double interval = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::microseconds>(time - _lastArrival).count());
+        if (_maxInterval > 0.)
+            interval = std::min(interval, _maxInterval);
+        // exponentially weighted moving average and variance
+        const double diff = interval - _intervalMean;
+        _intervalMean = _samples ? _intervalMean + alpha * diff : interval;
+        _intervalVar = _samples ? (1. - alpha) * (_intervalVar + alpha * diff * diff) : 0.;
+        _samples++;
+    }
+    _hasArrivals = true;
+    _lastArrival = time;
+}
+
+void AdaptiveBatchTimeout::OnBatchExecuted(std::chrono::microseconds time) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    const double t = static_cast<double>(time.count());
+    _execTime = _execTime > 0. ? _execTime + alpha * (t - _execTime) : t;
+}
+
+std::chrono::microseconds AdaptiveBatchTimeout::GetWindow(int collected,
+                                                          int batchSize,
+                                                          std::chrono::microseconds maxTimeout) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _maxInterval = static_cast<double>(maxTimeout.count());
+    std::chrono::microseconds window = maxTimeout;
+    if (_samples >= minSamples) {
+        const int missing = batchSize - collected;
+        // the time to collect the missing requests is the sum of the missing inter-arrival intervals,
+        // its percentile is estimated from the normal approximation of the sum
+        const double fillTime = missing > 0 ? missing * _intervalMean +
+                                                  zScore * std::sqrt(static_cast<double>(missing) * _intervalVar)
+                                            : 0.;
+        const double budget = _maxInterval - _execTime;
+        window = std::chrono::microseconds(fillTime <= budget ? static_cast<int64_t>(std::ceil(fillTime)) : 0);
+    }
+    _lastWindow = window.count();
+    return window;
+}
+
 // ------------------------------AutoBatchExecutableNetwork----------------------------
 AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const InferenceEngine::SoExecutableNetworkInternal& networkWithBatch,
@@ -445,6 +498,8 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     auto time_out = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
     IE_ASSERT(time_out != config.end());
     _timeOut = ParseTimeoutValue(time_out->second.as<std::string>());
+    auto adaptive = config.find(CONFIG_KEY_INTERNAL(AUTO_BATCH_ADAPTIVE_TIMEOUT));
+    _adaptiveTimeOut = adaptive != config.end() && adaptive->second.as<std::string>() == CONFIG_VALUE(YES);
 }
 
 AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
@@ -494,6 +549,18 @@ InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateIn
                                                    _batchedOutputs);
 }
 
+std::chrono::microseconds AutoBatchExecutableNetwork::GetBatchWindow(WorkerInferRequest& workerRequest) {
+    const std::chrono::microseconds maxTimeout = std::chrono::milliseconds(_timeOut);
+    if (!_adaptiveTimeOut)
+        return maxTimeout;
+    // it is ok to call size() here as the tasks are popped only by the worker thread
+    const int sz = static_cast<int>(workerRequest._tasks.size());
+    // nothing is collected yet, so wait for the first request (which notifies the worker)
+    if (!sz)
+        return maxTimeout;
+    return workerRequest._batchTimeout.GetWindow(sz, workerRequest._batchSize, maxTimeout);
+}
+
 std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecutableNetwork::GetWorkerInferRequest() {
     auto num = _numRequestsCreated++;
     std::lock_guard<std::mutex> lock(_workerRequestsMutex);
@@ -503,11 +570,15 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
         auto workerRequestPtr = _workerRequests.back().get();
         workerRequestPtr->_inferRequestBatched = {_network->CreateInferRequest(), _network._so};
         workerRequestPtr->_batchSize = _device.batchForDevice;
+        workerRequestPtr->_adaptiveTimeout = _adaptiveTimeOut;
         workerRequestPtr->_completionTasks.resize(workerRequestPtr->_batchSize);
         workerRequestPtr->_inferRequestBatched->SetCallback(
             [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
+                workerRequestPtr->_batchTimeout.OnBatchExecuted(
+                    std::chrono::duration_cast<std::chrono::microseconds>(AdaptiveBatchTimeout::Clock::now() -
+                                                                          workerRequestPtr->_batchStartTime));
                 IE_ASSERT(workerRequestPtr->_completionTasks.size() == (size_t)workerRequestPtr->_batchSize);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batchSize; c++) {
@@ -522,7 +593,7 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                 std::cv_status status;
                 {
                     std::unique_lock<std::mutex> lock(workerRequestPtr->_mutex);
-                    status = workerRequestPtr->_cond.wait_for(lock, std::chrono::milliseconds(_timeOut));
+                    status = workerRequestPtr->_cond.wait_for(lock, GetBatchWindow(*workerRequestPtr));
                 }
                 if (_terminate) {
                     break;
@@ -539,6 +610,8 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                             t.first->_inferRequest->_wasBatchedRequestUsed =
                                 AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
                         }
+                        _numBatchedRequests += sz;
+                        workerRequestPtr->_batchStartTime = AdaptiveBatchTimeout::Clock::now();
                         workerRequestPtr->_inferRequestBatched->StartAsync();
                     } else if ((status == std::cv_status::timeout) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
@@ -547,6 +620,7 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                         std::atomic<int> arrived = {0};
                         std::promise<void> all_completed;
                         auto all_completed_future = all_completed.get_future();
+                        _numTimedOutRequests += sz;
                         for (int n = 0; n < sz; n++) {
                             IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
                             t.first->_inferRequestWithoutBatch->SetCallback(
@@ -646,12 +720,31 @@ InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::stri
                               METRIC_KEY(SUPPORTED_METRICS),
                               METRIC_KEY(NETWORK_NAME),
                               METRIC_KEY(SUPPORTED_CONFIG_KEYS),
-                              ov::execution_devices.name()});
+                              ov::execution_devices.name(),
+                              metricBatchWindow,
+                              metricBatchFillRatio});
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS,
                              {CONFIG_KEY(AUTO_BATCH_TIMEOUT)});  // only timeout can be changed on the fly
     } else if (name == ov::execution_devices) {
         return _networkWithoutBatch->GetMetric(name);
+    } else if (name == metricBatchWindow) {
+        // the average of the current windows of the batched requests
+        unsigned int window = static_cast<unsigned int>(_timeOut) * 1000;
+        if (_adaptiveTimeOut) {
+            std::lock_guard<std::mutex> lock(_workerRequestsMutex);
+            if (!_workerRequests.empty()) {
+                int64_t total = 0;
+                for (const auto& worker : _workerRequests)
+                    total += worker->_batchTimeout.GetLastWindow().count();
+                window = static_cast<unsigned int>(total / _workerRequests.size());
+            }
+        }
+        return window;
+    } else if (name == metricBatchFillRatio) {
+        const size_t batched = _numBatchedRequests;
+        const size_t total = batched + _numTimedOutRequests;
+        return total ? static_cast<float>(batched) / total : 1.f;
     } else {
         IE_THROW() << "Unsupported Network metric: " << name;
     }
@@ -773,6 +866,10 @@ void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::stri
                 IE_THROW(ParameterMismatch)
                     << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " got " << val;
             }
+        } else if (name == CONFIG_KEY_INTERNAL(AUTO_BATCH_ADAPTIVE_TIMEOUT)) {
+            if (val != CONFIG_VALUE(YES) && val != CONFIG_VALUE(NO))
+                IE_THROW(ParameterMismatch) << " Expecting YES/NO value for "
+                                            << CONFIG_KEY_INTERNAL(AUTO_BATCH_ADAPTIVE_TIMEOUT) << " got " << val;
         }
     }
 }
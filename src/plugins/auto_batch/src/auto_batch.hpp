@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <mutex>
 #include <string>
@@ -33,6 +34,42 @@ struct DeviceInformation {
     int batchForDevice;
 };
 
+/**
+ * Adaptive time to collect a batch. Tracks the inter-arrival time of the requests (exponentially weighted mean and
+ * variance) and the execution time of the batched request. The window is the time to collect the rest of the batch
+ * with ~90% probability, if it fits the latency budget (the AUTO_BATCH_TIMEOUT minus the batch execution time).
+ * Otherwise the batch is unlikely to be collected in time, so the partially collected requests are executed without
+ * waiting.
+ *
+ * Is a thread safe
+ */
+class AdaptiveBatchTimeout {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    void OnArrival(Clock::time_point time);
+    void OnBatchExecuted(std::chrono::microseconds time);
+    std::chrono::microseconds GetWindow(int collected, int batchSize, std::chrono::microseconds maxTimeout);
+    std::chrono::microseconds GetLastWindow() const {
+        return std::chrono::microseconds(_lastWindow.load());
+    }
+
+protected:
+    static constexpr double alpha = 0.1;         // weight of the new sample in the moving averages
+    static constexpr double zScore = 1.28;       // ~90th percentile of the normal distribution
+    static constexpr size_t minSamples = 8;      // the full timeout is used until the statistics are collected
+
+    mutable std::mutex _mutex;
+    bool _hasArrivals = false;
+    Clock::time_point _lastArrival;
+    size_t _samples = 0;
+    double _intervalMean = 0.;  // in us
+    double _intervalVar = 0.;
+    double _execTime = 0.;      // in us
+    double _maxInterval = 0.;   // in us, the outliers (e.g. the idle periods) are clamped to the max timeout
+    std::atomic<int64_t> _lastWindow = {0};
+};
+
 class AutoBatchAsyncInferRequest;
 class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
@@ -47,6 +84,9 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+        bool _adaptiveTimeout = false;
+        AdaptiveBatchTimeout _batchTimeout;
+        AdaptiveBatchTimeout::Clock::time_point _batchStartTime;
     };
 
     explicit AutoBatchExecutableNetwork(
@@ -79,13 +119,17 @@ protected:
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
+    std::chrono::microseconds GetBatchWindow(WorkerInferRequest& workerRequest);
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
-    std::mutex _workerRequestsMutex;
+    mutable std::mutex _workerRequestsMutex;
 
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool _needPerfCounters = false;
     std::atomic_size_t _numRequestsCreated = {0};
     std::atomic_int _timeOut = {0};  // in ms
+    bool _adaptiveTimeOut = false;
+    std::atomic_size_t _numBatchedRequests = {0};   // executed as a part of the full batch
+    std::atomic_size_t _numTimedOutRequests = {0};  // executed individually when the batch was not collected in time
 
     const std::set<std::string> _batchedInputs;
     const std::set<std::string> _batchedOutputs;
@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include "mock_auto_batch_plugin.hpp"
+
+using namespace MockAutoBatchPlugin;
+using namespace std::chrono;
+
+namespace {
+
+// Synthetic load generator: feeds the arrivals with the given inter-arrival times to the policy
+class SyntheticLoad {
+public:
+    explicit SyntheticLoad(AdaptiveBatchTimeout& policy) : _policy(policy), _time(AdaptiveBatchTimeout::Clock::now()) {}
+
+    void constantRate(microseconds interval, size_t count) {
+        for (size_t i = 0; i < count; i++)
+            arrive(interval);
+    }
+
+    void poissonRate(microseconds meanInterval, size_t count, unsigned int seed) {
+        std::mt19937 gen(seed);
+        std::exponential_distribution<double> dist(1. / meanInterval.count());
+        for (size_t i = 0; i < count; i++)
+            arrive(microseconds(static_cast<int64_t>(dist(gen))));
+    }
+
+private:
+    void arrive(microseconds interval) {
+        _time += interval;
+        _policy.OnArrival(_time);
+    }
+
+    AdaptiveBatchTimeout& _policy;
+    AdaptiveBatchTimeout::Clock::time_point _time;
+};
+
+constexpr int batchSize = 8;
+const microseconds maxTimeout = milliseconds(10);
+
+}  // namespace
+
+TEST(AdaptiveBatchTimeoutTest, FullTimeoutUntilStatisticsCollected) {
+    AdaptiveBatchTimeout policy;
+    SyntheticLoad load(policy);
+    load.constantRate(microseconds(100), 3);
+    EXPECT_EQ(maxTimeout, policy.GetWindow(1, batchSize, maxTimeout));
+    EXPECT_EQ(maxTimeout, policy.GetLastWindow());
+}
+
+TEST(AdaptiveBatchTimeoutTest, HighRateWaitsForTheRestOfBatch) {
+    AdaptiveBatchTimeout policy;
+    SyntheticLoad load(policy);
+    load.constantRate(microseconds(100), 100);
+    // 7 more requests are expected in ~700us, much less than the max timeout
+    EXPECT_EQ(microseconds(700), policy.GetWindow(1, batchSize, maxTimeout));
+    EXPECT_EQ(microseconds(300), policy.GetWindow(5, batchSize, maxTimeout));
+    EXPECT_EQ(microseconds(0), policy.GetWindow(batchSize, batchSize, maxTimeout));
+}
+
+TEST(AdaptiveBatchTimeoutTest, LowRateFlushesWithoutWaiting) {
+    AdaptiveBatchTimeout policy;
+    policy.GetWindow(1, batchSize, maxTimeout);
+    SyntheticLoad load(policy);
+    load.constantRate(milliseconds(50), 100);
+    // the batch can't be collected within the max timeout, so there is no reason to wait
+    EXPECT_EQ(microseconds(0), policy.GetWindow(1, batchSize, maxTimeout));
+}
+
+TEST(AdaptiveBatchTimeoutTest, BatchExecutionTimeReducesBudget) {
+    AdaptiveBatchTimeout policy;
+    SyntheticLoad load(policy);
+    load.constantRate(milliseconds(1), 100);
+    policy.OnBatchExecuted(milliseconds(2));
+    EXPECT_EQ(microseconds(7000), policy.GetWindow(1, batchSize, maxTimeout));
+
+    AdaptiveBatchTimeout slowPolicy;
+    SyntheticLoad slowLoad(slowPolicy);
+    slowLoad.constantRate(milliseconds(1), 100);
+    slowPolicy.OnBatchExecuted(milliseconds(5));
+    EXPECT_EQ(microseconds(0), slowPolicy.GetWindow(1, batchSize, maxTimeout));
+}
+
+TEST(AdaptiveBatchTimeoutTest, BurstyLoadAdaptsWindow) {
+    AdaptiveBatchTimeout policy;
+    policy.GetWindow(1, batchSize, maxTimeout);
+    SyntheticLoad load(policy);
+
+    // medium rate: the window covers the expected time to collect the batch plus the arrivals jitter
+    load.poissonRate(microseconds(200), 1000, 42);
+    const auto mediumRateWindow = policy.GetWindow(1, batchSize, maxTimeout);
+    EXPECT_GT(mediumRateWindow, microseconds(700));
+    EXPECT_LT(mediumRateWindow, maxTimeout);
+
+    // burst: the window shrinks following the arrival rate
+    load.poissonRate(microseconds(20), 1000, 43);
+    const auto burstWindow = policy.GetWindow(1, batchSize, maxTimeout);
+    EXPECT_LT(burstWindow, mediumRateWindow);
+    EXPECT_GT(burstWindow, microseconds(0));
+
+    // idle period: the partial batches are flushed immediately
+    load.poissonRate(milliseconds(20), 1000, 44);
+    EXPECT_EQ(microseconds(0), policy.GetWindow(1, batchSize, maxTimeout));
+}
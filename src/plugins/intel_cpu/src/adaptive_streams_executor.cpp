@@ -0,0 +1,297 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "adaptive_streams_executor.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+#include <ie_parallel.hpp>
+#include <ie_system_conf.h>
+#include <threading/ie_cpu_streams_info.hpp>
+
+#include "cpu_streams_calculation.hpp"
+
+#if defined(__linux__)
+# include <sys/resource.h>
+# include <unistd.h>
+#endif
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+// the latency of the row is taken into account when it has enough samples in the period
+constexpr size_t minSamplesPerPeriod = 4;
+
+/**
+ * CPU time (in seconds) consumed by all the processes of the system and by the current process,
+ * returns false when it is not supported by the platform
+ */
+bool getCpuTimes(double& systemTime, double& processTime) {
+#if defined(__linux__)
+    std::ifstream stat("/proc/stat");
+    std::string cpu;
+    uint64_t user = 0, nice = 0, system = 0, idle = 0, iowait = 0, irq = 0, softirq = 0, steal = 0;
+    if (!(stat >> cpu >> user >> nice >> system >> idle >> iowait >> irq >> softirq >> steal) || cpu != "cpu")
+        return false;
+    const auto ticksPerSecond = sysconf(_SC_CLK_TCK);
+    if (ticksPerSecond <= 0)
+        return false;
+    systemTime = static_cast<double>(user + nice + system + irq + softirq + steal) / ticksPerSecond;
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return false;
+    processTime = usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+                  (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1e-6;
+    return true;
+#else
+    return false;
+#endif
+}
+
+int getTotalThreads(const std::vector<std::vector<int>>& streamsTable) {
+    int threads = 0;
+    for (const auto& row : streamsTable)
+        threads += row[NUMBER_OF_STREAMS] * row[THREADS_PER_STREAM];
+    return threads;
+}
+
+std::map<std::string, uint64_t> makeStatistics(const std::vector<std::vector<int>>& streamsInfoTable,
+                                               const std::vector<std::vector<int>>& activeStreamsTable,
+                                               int availableProcessors,
+                                               uint64_t adaptations) {
+    uint64_t streams = 0, maxStreams = 0, mainCoreStreams = 0, efficientCoreStreams = 0;
+    for (size_t n = 0; n < streamsInfoTable.size(); n++) {
+        const auto active = static_cast<uint64_t>(activeStreamsTable[n][NUMBER_OF_STREAMS]);
+        streams += active;
+        maxStreams += static_cast<uint64_t>(streamsInfoTable[n][NUMBER_OF_STREAMS]);
+        (streamsInfoTable[n][PROC_TYPE] == EFFICIENT_CORE_PROC ? efficientCoreStreams : mainCoreStreams) += active;
+    }
+    return {{"streams", streams},
+            {"max_streams", maxStreams},
+            {"main_core_streams", mainCoreStreams},
+            {"efficient_core_streams", efficientCoreStreams},
+            {"available_processors", static_cast<uint64_t>(std::max(0, availableProcessors))},
+            {"adaptations", adaptations}};
+}
+}  // namespace
+
+struct AdaptiveStreamsExecutor::State {
+    struct RowStatistics {
+        double latencySum = 0;
+        size_t samples = 0;
+        double bestLatency = 0;
+    };
+
+    State(const IStreamsExecutor::Ptr& executor, const IStreamsExecutor::Config& config, Clock::duration period)
+        : _executor{executor},
+          _period{period},
+          _streamsInfoTable{getStreamsInfoTable(config)},
+          _activeStreamsTable{_streamsInfoTable},
+          _rows(_streamsInfoTable.size()),
+          _availableProcessors{getTotalThreads(_streamsInfoTable)},
+          _lastAdaptation{Clock::now()} {
+        for (const auto& row : _streamsInfoTable)
+            _totalStreams += row[NUMBER_OF_STREAMS];
+        _hasCpuTimes = getCpuTimes(_systemTime, _processTime);
+    }
+
+    // the row of the streams info table and the index of the stream in the row
+    std::pair<size_t, int> getRow(int streamId) const {
+        int index = streamId % _totalStreams;
+        size_t row = 0;
+        for (; row < _streamsInfoTable.size() - 1 && index >= _streamsInfoTable[row][NUMBER_OF_STREAMS]; row++)
+            index -= _streamsInfoTable[row][NUMBER_OF_STREAMS];
+        return {row, index};
+    }
+
+    bool isActive(int streamId) const {
+        const auto row = getRow(streamId);
+        return _stopped || row.second < _activeStreamsTable[row.first][NUMBER_OF_STREAMS];
+    }
+
+    void execute(const std::shared_ptr<State>& self, const Task& task) {
+        const int streamId = _executor->GetStreamId();
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            if (!isActive(streamId)) {
+                // the task is handed over to the active streams, while the parked stream doesn't take the next one
+                _executor->run([self, task] {
+                    self->execute(self, task);
+                });
+                _condVar.wait(lock, [&] {
+                    return isActive(streamId);
+                });
+                return;
+            }
+        }
+        const auto start = Clock::now();
+        task();
+        const auto end = Clock::now();
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto& row = _rows[getRow(streamId).first];
+            row.latencySum += std::chrono::duration<double, std::milli>(end - start).count();
+            row.samples++;
+            // a single stream adapts the configuration, the others keep on executing the tasks meanwhile
+            if (end - _lastAdaptation < _period || _adapting)
+                return;
+            _adapting = true;
+        }
+        // the load is sampled out of the lock, as reading /proc/stat may take a while
+        double systemTime = 0, processTime = 0;
+        const bool hasCpuTimes = _hasCpuTimes && getCpuTimes(systemTime, processTime);
+        const auto now = Clock::now();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        adapt(now, hasCpuTimes, systemTime, processTime);
+        _adapting = false;
+    }
+
+    void adapt(Clock::time_point now, bool hasCpuTimes, double systemTime, double processTime) {
+        std::vector<float> slowdown(_rows.size(), 0.0f);
+        for (size_t n = 0; n < _rows.size(); n++) {
+            auto& row = _rows[n];
+            if (row.samples < minSamplesPerPeriod)
+                continue;
+            const auto latency = row.latencySum / row.samples;
+            // the best latency slowly grows, so a workload which becomes heavier doesn't look contended forever
+            row.bestLatency = row.bestLatency == 0 ? latency : std::min(row.bestLatency * 1.01, latency);
+            slowdown[n] = static_cast<float>(latency / row.bestLatency);
+            row.latencySum = 0;
+            row.samples = 0;
+        }
+
+        if (hasCpuTimes) {
+            const auto elapsed = std::chrono::duration<double>(now - _lastAdaptation).count();
+            // the CPU time of the system not consumed by this process is the load of the co-located processes
+            const auto otherTime = std::max(0.0, (systemTime - _systemTime) - (processTime - _processTime));
+            const auto otherProcessors = otherTime / elapsed;
+            const auto processors = static_cast<int>(std::thread::hardware_concurrency());
+            _availableProcessors = std::min(getTotalThreads(_streamsInfoTable),
+                                            std::max(0, processors - static_cast<int>(otherProcessors + 0.5)));
+            _systemTime = systemTime;
+            _processTime = processTime;
+        }
+        _lastAdaptation = now;
+
+        auto activeStreamsTable =
+            get_adaptive_streams_info_table(_streamsInfoTable, _activeStreamsTable, slowdown, _availableProcessors);
+        if (activeStreamsTable != _activeStreamsTable) {
+            _activeStreamsTable = std::move(activeStreamsTable);
+            _adaptations++;
+            _condVar.notify_all();
+        }
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopped = true;
+        }
+        _condVar.notify_all();
+    }
+
+    IStreamsExecutor::Ptr _executor;
+    const Clock::duration _period;
+    const std::vector<std::vector<int>> _streamsInfoTable;
+    int _totalStreams = 0;
+    mutable std::mutex _mutex;
+    std::condition_variable _condVar;
+    std::vector<std::vector<int>> _activeStreamsTable;
+    std::vector<RowStatistics> _rows;
+    int _availableProcessors;
+    uint64_t _adaptations = 0;
+    bool _stopped = false;
+    bool _adapting = false;
+    Clock::time_point _lastAdaptation;
+    bool _hasCpuTimes = false;
+    double _systemTime = 0;
+    double _processTime = 0;
+};
+
+AdaptiveStreamsExecutor::AdaptiveStreamsExecutor(const IStreamsExecutor::Ptr& executor,
+                                                 const IStreamsExecutor::Config& config,
+                                                 Clock::duration period)
+    : _state{std::make_shared<State>(executor, config, period)} {}
+
+AdaptiveStreamsExecutor::~AdaptiveStreamsExecutor() {
+    // the parked streams are released, the tasks left in the queue are executed by any stream
+    _state->stop();
+}
+
+void AdaptiveStreamsExecutor::run(Task task) {
+    auto state = _state;
+    _state->_executor->run([state, task] {
+        state->execute(state, task);
+    });
+}
+
+int AdaptiveStreamsExecutor::GetStreamId() {
+    return _state->_executor->GetStreamId();
+}
+
+int AdaptiveStreamsExecutor::GetNumaNodeId() {
+    return _state->_executor->GetNumaNodeId();
+}
+
+void AdaptiveStreamsExecutor::Execute(Task task) {
+    // executed by the calling thread, which is not one of the streams, so it's neither parked nor measured
+    _state->_executor->Execute(std::move(task));
+}
+
+std::vector<std::vector<int>> AdaptiveStreamsExecutor::getStreamsInfoTable(const IStreamsExecutor::Config& config) {
+    const int streams = std::max(1, config._streams);
+    auto threadsPerStream = [&](int threads) {
+        if (threads > 0)
+            return threads;
+        const int totalThreads = config._threads > 0 ? config._threads : parallel_get_max_threads();
+        return std::max(1, totalThreads / streams);
+    };
+    std::vector<std::vector<int>> streamsInfoTable;
+    // the executor places the Performance-core streams first (see CPUStreamsExecutor)
+    if (config._threadBindingType == IStreamsExecutor::ThreadBindingType::HYBRID_AWARE &&
+        config._big_core_streams + config._small_core_streams > 0) {
+        if (config._big_core_streams > 0) {
+            streamsInfoTable.push_back(
+                {config._big_core_streams, MAIN_CORE_PROC, threadsPerStream(config._threads_per_stream_big)});
+        }
+        if (config._small_core_streams > 0) {
+            streamsInfoTable.push_back(
+                {config._small_core_streams, EFFICIENT_CORE_PROC, threadsPerStream(config._threads_per_stream_small)});
+        }
+    } else {
+        streamsInfoTable.push_back({streams, MAIN_CORE_PROC, threadsPerStream(config._threadsPerStream)});
+    }
+    return streamsInfoTable;
+}
+
+std::vector<std::vector<int>> AdaptiveStreamsExecutor::getActiveStreamsInfoTable() const {
+    std::lock_guard<std::mutex> lock(_state->_mutex);
+    return _state->_activeStreamsTable;
+}
+
+std::map<std::string, uint64_t> AdaptiveStreamsExecutor::getStatistics() const {
+    std::lock_guard<std::mutex> lock(_state->_mutex);
+    return makeStatistics(_state->_streamsInfoTable,
+                          _state->_activeStreamsTable,
+                          _state->_availableProcessors,
+                          _state->_adaptations);
+}
+
+std::map<std::string, uint64_t> AdaptiveStreamsExecutor::getStatistics(const IStreamsExecutor::Config& config) {
+    const auto streamsInfoTable = getStreamsInfoTable(config);
+    return makeStatistics(streamsInfoTable, streamsInfoTable, getTotalThreads(streamsInfoTable), 0);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
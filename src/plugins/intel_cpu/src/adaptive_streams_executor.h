@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <threading/ie_istreams_executor.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Streams executor which adapts the number of the active streams and their processor types to the contention
+ * observed at runtime (see get_adaptive_streams_info_table()). Once per period the latency of the tasks executed by
+ * the streams of every processor type is compared to the best latency observed, and the CPU time consumed by the
+ * other processes is compared to the number of processors used by the active streams.
+ *
+ * The streams of the wrapped executor which are not active are parked: the task taken by such a stream is handed back
+ * to the executor, and the stream doesn't take the next one until it's activated again. So neither the executor nor
+ * the graphs of the streams are recreated when the configuration changes.
+ *
+ * Only the tasks submitted by run() are subject to the adaptation. Execute(), used by the synchronous inference,
+ * runs the task in the calling thread, which is not one of the streams, so such tasks are neither parked nor measured.
+ */
+class AdaptiveStreamsExecutor : public InferenceEngine::IStreamsExecutor {
+public:
+    using Ptr = std::shared_ptr<AdaptiveStreamsExecutor>;
+    using Clock = std::chrono::steady_clock;
+
+    AdaptiveStreamsExecutor(const InferenceEngine::IStreamsExecutor::Ptr& executor,
+                            const InferenceEngine::IStreamsExecutor::Config& config,
+                            Clock::duration period = std::chrono::milliseconds(500));
+    ~AdaptiveStreamsExecutor() override;
+
+    void run(InferenceEngine::Task task) override;
+
+    int GetStreamId() override;
+
+    int GetNumaNodeId() override;
+
+    void Execute(InferenceEngine::Task task) override;
+
+    /**
+     * @brief Streams info table of the executor configuration, the upper limit of the active streams
+     */
+    static std::vector<std::vector<int>> getStreamsInfoTable(const InferenceEngine::IStreamsExecutor::Config& config);
+
+    std::vector<std::vector<int>> getActiveStreamsInfoTable() const;
+
+    /**
+     * @brief Current streams configuration: "streams" (active now), "max_streams", "main_core_streams",
+     * "efficient_core_streams", "available_processors" (not occupied by the other processes) and "adaptations"
+     * (number of the configuration changes)
+     */
+    std::map<std::string, uint64_t> getStatistics() const;
+
+    /**
+     * @brief Streams configuration of the executor which doesn't adapt the streams, in the same format
+     */
+    static std::map<std::string, uint64_t> getStatistics(const InferenceEngine::IStreamsExecutor::Config& config);
+
+private:
+    struct State;
+    // shared with the tasks submitted to the wrapped executor, which may outlive this one
+    std::shared_ptr<State> _state;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
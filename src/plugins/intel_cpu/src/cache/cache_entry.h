@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <functional>
 #include "lru_cache.h"
@@ -11,6 +12,17 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief Hits/misses/evictions counters of a cache. May be shared between several cache entries.
+ */
+struct CacheStatistics {
+    std::atomic<size_t> hits{0};
+    std::atomic<size_t> misses{0};
+    std::atomic<size_t> evictions{0};
+};
+
+using CacheStatisticsPtr = std::shared_ptr<CacheStatistics>;
+
 class CacheEntryBase {
 public:
     enum class LookUpStatus : int8_t {
@@ -21,25 +33,47 @@ public:
     virtual ~CacheEntryBase() = default;
 };
 
+/**
+ * @brief Interface of a cache record for a particular pair of key/value types independent of the underlying storage type
+ */
+
+template<typename KeyType, typename ValType>
+class CacheEntryT : public CacheEntryBase {
+public:
+    using ResultType = std::pair<ValType, LookUpStatus>;
+
+public:
+    virtual ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) = 0;
+};
+
 /**
  * @brief Class represents a templated record in multi cache
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
- *         interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide bool put(KeyType, ValueType) (returning whether a record was evicted)
+ *         and ValueType get(const KeyType&) interface and must have constructor of type ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
+ * @note The entry is thread safe as long as the ImplType is thread safe. The builder is called without any lock held,
+ *       so concurrent misses on the same key may build the value several times, the last put value is kept.
  */
 
 template<typename KeyType,
          typename ValType,
          typename ImplType = LruCache<KeyType, ValType>>
-class CacheEntry : public CacheEntryBase {
+class CacheEntry : public CacheEntryT<KeyType, ValType> {
 public:
-    using ResultType = std::pair<ValType, LookUpStatus>;
+    using ResultType = typename CacheEntryT<KeyType, ValType>::ResultType;
+    using LookUpStatus = CacheEntryBase::LookUpStatus;
 
 public:
-    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+    explicit CacheEntry(size_t capacity, CacheStatisticsPtr stats = nullptr)
+        : _impl(capacity),
+          _stats(stats ? std::move(stats) : std::make_shared<CacheStatistics>()) {}
+
+    const CacheStatistics& getStatistics() const {
+        return *_stats;
+    }
 
     /**
      * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the builder functor and adds it to
@@ -49,9 +83,10 @@ public:
      * @return result of the operation which is a pair of the requested object of ValType and the status of whether the cache hit or miss occurred
      */
 
-    ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
+    ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) override {
         if (0 == _impl.getCapacity()) {
             // fast track
+            _stats->misses.fetch_add(1, std::memory_order_relaxed);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
@@ -60,14 +95,20 @@ public:
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
             retVal = builder(key);
-            if (retVal != retEmpty)
-                _impl.put(key, retVal);
+            if (retVal != retEmpty && _impl.put(key, retVal))
+                _stats->evictions.fetch_add(1, std::memory_order_relaxed);
+            _stats->misses.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            _stats->hits.fetch_add(1, std::memory_order_relaxed);
         }
         return {retVal, retStatus};
     }
 
 public:
     ImplType _impl;
+
+private:
+    CacheStatisticsPtr _stats;
 };
 
 }   // namespace intel_cpu
@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe preemptive cache with LRU eviction policy.
+ * The records are distributed between several independent shards by the key hash, each shard is an LruCache
+ * protected by its own mutex, so concurrent accesses to different shards do not contend.
+ * The LRU order is maintained per shard, i.e. the evicted record is the least recently used one within its shard.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+template<typename Key, typename Value>
+class ConcurrentLruCache {
+public:
+    explicit ConcurrentLruCache(size_t capacity) : _capacity(capacity) {
+        const size_t shardsNum = capacity < maxShardsNum ? capacity : maxShardsNum;
+        if (shardsNum) {
+            const size_t shardCapacity = (capacity + shardsNum - 1) / shardsNum;
+            _shards.reserve(shardsNum);
+            for (size_t i = 0; i < shardsNum; ++i) {
+                _shards.emplace_back(new Shard(shardCapacity));
+            }
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     * @return true if a record was evicted to free space for the new one
+     */
+
+    bool put(const Key &key, const Value &val) {
+        if (0 == _capacity) {
+            return false;
+        }
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key &key) {
+        if (0 == _capacity) {
+            return Value();
+        }
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.get(key);
+    }
+
+    /**
+     * @brief Evicts n least recently used records from each shard
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            shard->cache.evict(n);
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+private:
+    struct Shard {
+        explicit Shard(size_t capacity) : cache(capacity) {}
+        std::mutex mutex;
+        LruCache<Key, Value> cache;
+    };
+
+    Shard& getShard(const Key &key) {
+        size_t hash = key.hash();
+        // mix the high bits in, as the low bits of the key hash are often poorly distributed
+        hash ^= hash >> 17;
+        hash ^= hash >> 31;
+        return *_shards[hash % _shards.size()];
+    }
+
+    static constexpr size_t maxShardsNum = 16;
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
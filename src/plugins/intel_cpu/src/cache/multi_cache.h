@@ -7,7 +7,9 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
+#include "concurrent_lru_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -15,23 +17,31 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention This implementation IS NOT THREAD SAFE unless it is created with threadSafe = true.
+ * The thread safe version uses sharded LRU storages (ConcurrentLruCache) and can be shared between several graphs
+ * (e.g. between the streams of a compiled model).
  */
 
 class MultiCache {
 public:
     template<typename KeyType, typename ValueType>
     using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    template<typename KeyType, typename ValueType>
+    using ConcurrentEntryTypeT = CacheEntry<KeyType, ValueType, ConcurrentLruCache<KeyType, ValueType>>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
-    using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
+    using EntryPtr = std::shared_ptr<CacheEntryT<KeyType, ValueType>>;
 
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param threadSafe defines whether the cache may be accessed from several threads concurrently
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false)
+        : _capacity(capacity),
+          _guard(threadSafe ? std::make_shared<std::mutex>() : nullptr),
+          _stats(std::make_shared<CacheStatistics>()) {}
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -43,12 +53,23 @@ public:
     */
 
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
-    typename CacheEntry<KeyType, ValueType>::ResultType
+    typename CacheEntryT<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
         auto entry = getEntry<KeyType, ValueType>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    bool isThreadSafe() const {
+        return _guard != nullptr;
+    }
+
+    /**
+    * @brief Returns the hits/misses/evictions counters accumulated over all the entries. Safe to call concurrently with lookups.
+    */
+    const CacheStatistics& getStatistics() const {
+        return *_stats;
+    }
+
 private:
     template<typename T>
     size_t getTypeId();
@@ -58,6 +79,8 @@ private:
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    std::shared_ptr<std::mutex> _guard;
+    CacheStatisticsPtr _stats;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -69,11 +92,19 @@ size_t MultiCache::getTypeId() {
 
 template<typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+    using EntryType = CacheEntryT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::unique_lock<std::mutex> lock;
+    if (_guard)
+        lock = std::unique_lock<std::mutex>(*_guard);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        EntryBasePtr entry;
+        if (_guard)
+            entry = std::make_shared<ConcurrentEntryTypeT<KeyType, ValueType>>(_capacity, _stats);
+        else
+            entry = std::make_shared<EntryTypeT<KeyType, ValueType>>(_capacity, _stats);
+        auto result = _storage.insert({id, entry});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
@@ -178,6 +178,74 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARED == key) {
+            if (val == PluginConfigParams::YES) {
+                rtCacheShared = true;
+            } else if (val == PluginConfigParams::NO) {
+                rtCacheShared = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARED
+                           << ". Expected only YES/NO";
+            }
+        } else if (PluginConfigInternalParams::KEY_CPU_SHAPES_PLAN_CACHE_CAPACITY == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHAPES_PLAN_CACHE_CAPACITY
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the cache
+            shapesPlanCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY == key) {
+            if (val == PluginConfigInternalParams::REPLICATE) {
+                weightsNumaPolicy = WeightsNumaPolicy::Replicate;
+            } else if (val == PluginConfigInternalParams::REPLICATE_ON_FIRST_USE) {
+                weightsNumaPolicy = WeightsNumaPolicy::ReplicateOnFirstUse;
+            } else if (val == PluginConfigInternalParams::SINGLE_NODE) {
+                weightsNumaPolicy = WeightsNumaPolicy::SingleNode;
+            } else {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY
+                           << ". Expected only " << PluginConfigInternalParams::REPLICATE << "/"
+                           << PluginConfigInternalParams::REPLICATE_ON_FIRST_USE << "/" << PluginConfigInternalParams::SINGLE_NODE;
+            }
+        } else if (PluginConfigInternalParams::KEY_CPU_ADAPTIVE_STREAMS == key) {
+            if (val == PluginConfigParams::YES) {
+                adaptiveStreams = true;
+            } else if (val == PluginConfigParams::NO) {
+                adaptiveStreams = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_ADAPTIVE_STREAMS
+                           << ". Expected only YES/NO";
+            }
+        } else if (PluginConfigInternalParams::KEY_CPU_CONSTANTS_IN_PLACE == key) {
+            if (val == PluginConfigParams::YES) {
+                constantsInPlace = true;
+            } else if (val == PluginConfigParams::NO) {
+                constantsInPlace = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_CONSTANTS_IN_PLACE
+                           << ". Expected only YES/NO";
+            }
+        } else if (PluginConfigInternalParams::KEY_CPU_COLOR_CONVERT_NORMALIZE_FUSION == key) {
+            if (val == PluginConfigParams::YES) {
+                colorConvertNormalizeFusion = true;
+            } else if (val == PluginConfigParams::NO) {
+                colorConvertNormalizeFusion = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_COLOR_CONVERT_NORMALIZE_FUSION
+                           << ". Expected only YES/NO";
+            }
+        } else if (PluginConfigInternalParams::KEY_CPU_DYNAMIC_PREPARATION_PIPELINE == key) {
+            if (val == PluginConfigParams::YES) {
+                dynamicPreparationPipeline = true;
+            } else if (val == PluginConfigParams::NO) {
+                dynamicPreparationPipeline = false;
+            } else {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DYNAMIC_PREPARATION_PIPELINE
+                           << ". Expected only YES/NO";
+            }
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
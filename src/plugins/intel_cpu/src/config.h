@@ -38,6 +38,12 @@ struct Config {
         Disable,
     };
 
+    enum WeightsNumaPolicy {
+        Replicate,
+        ReplicateOnFirstUse,
+        SingleNode,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
@@ -46,6 +52,13 @@ struct Config {
     int batchLimit = 0;
     float fcSparseWeiDecompressionRate = 1.0f;
     size_t rtCacheCapacity = 5000ul;
+    bool rtCacheShared = false;
+    size_t shapesPlanCacheCapacity = 64ul;
+    WeightsNumaPolicy weightsNumaPolicy = WeightsNumaPolicy::Replicate;
+    bool constantsInPlace = false;
+    bool adaptiveStreams = false;
+    bool colorConvertNormalizeFusion = true;
+    bool dynamicPreparationPipeline = true;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
@@ -160,5 +160,76 @@ std::vector<std::vector<int>> get_streams_info_table(const int input_streams,
         }
     }
 }
+
+std::vector<std::vector<int>> get_adaptive_streams_info_table(const std::vector<std::vector<int>>& streams_info_table,
+                                                              const std::vector<std::vector<int>>& active_streams_table,
+                                                              const std::vector<float>& stream_slowdown,
+                                                              const int available_processors) {
+    // the streams of the row are considered contended when their latency grows by half, and the streams are added
+    // back only when the latency of all the active rows is close to the best one
+    const float contended_slowdown = 1.5f;
+    const float uncontended_slowdown = 1.2f;
+    std::vector<std::vector<int>> adaptive_table = active_streams_table;
+    const int n_rows = static_cast<int>(streams_info_table.size());
+
+    int n_streams = 0;
+    int n_threads = 0;
+    for (const auto& row : active_streams_table) {
+        n_streams += row[NUMBER_OF_STREAMS];
+        n_threads += row[NUMBER_OF_STREAMS] * row[THREADS_PER_STREAM];
+    }
+    // the row to shrink: the most contended one, the later rows (Efficient-cores, hyper threading) on a tie
+    auto slowest_row = [&]() {
+        int row = -1;
+        for (int n = 0; n < n_rows; n++) {
+            if (active_streams_table[n][NUMBER_OF_STREAMS] > 0 &&
+                (row < 0 || stream_slowdown[n] >= stream_slowdown[row])) {
+                row = n;
+            }
+        }
+        return row;
+    };
+    // the row to grow: the first one (Performance-cores) that has both free streams and free processors
+    auto free_row = [&](int excluded_row, int freed_threads) {
+        for (int n = 0; n < n_rows; n++) {
+            if (n != excluded_row && stream_slowdown[n] <= uncontended_slowdown &&
+                active_streams_table[n][NUMBER_OF_STREAMS] < streams_info_table[n][NUMBER_OF_STREAMS] &&
+                n_threads - freed_threads + streams_info_table[n][THREADS_PER_STREAM] <= available_processors) {
+                return n;
+            }
+        }
+        return -1;
+    };
+
+    if (n_threads > available_processors) {
+        if (n_streams > 1) {
+            adaptive_table[slowest_row()][NUMBER_OF_STREAMS] -= 1;
+        }
+        return adaptive_table;
+    }
+
+    const int contended_row = slowest_row();
+    if (contended_row >= 0 && stream_slowdown[contended_row] > contended_slowdown) {
+        const int target_row = free_row(contended_row, active_streams_table[contended_row][THREADS_PER_STREAM]);
+        if (target_row >= 0) {
+            adaptive_table[target_row][NUMBER_OF_STREAMS] += 1;
+            adaptive_table[contended_row][NUMBER_OF_STREAMS] -= 1;
+        } else if (n_streams > 1) {
+            adaptive_table[contended_row][NUMBER_OF_STREAMS] -= 1;
+        }
+        return adaptive_table;
+    }
+
+    const bool uncontended = std::all_of(stream_slowdown.begin(), stream_slowdown.end(), [&](float slowdown) {
+        return slowdown <= uncontended_slowdown;
+    });
+    if (uncontended) {
+        const int target_row = free_row(-1, 0);
+        if (target_row >= 0) {
+            adaptive_table[target_row][NUMBER_OF_STREAMS] += 1;
+        }
+    }
+    return adaptive_table;
+}
 }  // namespace intel_cpu
 }  // namespace ov
\ No newline at end of file
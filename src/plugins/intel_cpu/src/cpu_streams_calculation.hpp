@@ -31,5 +31,21 @@ std::vector<std::vector<int>> get_streams_info_table(const int input_streams,
                                                      const int input_threads,
                                                      const int model_prefer_threads,
                                                      const std::vector<std::vector<int>> proc_type_table);
+
+/**
+ * @brief      Adapt the active streams to the contention observed at runtime, one stream is added, removed or moved
+ *             to another processor type per call, so the callers converge to the new configuration over a few periods
+ * @param[in]  streams_info_table is the table generated at compile time, it limits the streams of every row
+ * @param[in]  active_streams_table is the table of the streams active now, it has the same rows as streams_info_table
+ * @param[in]  stream_slowdown is the ratio of the current latency of the streams of every row to the best latency
+ *               observed on the same row
+ *               - "0" mean there is no measurements for the row
+ * @param[in]  available_processors is the number of processors not occupied by the other processes
+ * @return     table of the streams active for the next period
+ */
+std::vector<std::vector<int>> get_adaptive_streams_info_table(const std::vector<std::vector<int>>& streams_info_table,
+                                                              const std::vector<std::vector<int>>& active_streams_table,
+                                                              const std::vector<float>& stream_slowdown,
+                                                              const int available_processors);
 }  // namespace intel_cpu
 }  // namespace ov
@@ -116,6 +116,7 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "NV12toBGR", Type::ColorConvert },
         { "I420toRGB", Type::ColorConvert },
         { "I420toBGR", Type::ColorConvert },
+        { "ColorConvertNormalize", Type::ColorConvert },
         { "MVN", Type::MVN},
         { "NormalizeL2", Type::NormalizeL2},
         { "ScatterUpdate", Type::ScatterUpdate},
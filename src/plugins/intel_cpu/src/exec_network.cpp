@@ -7,6 +7,7 @@
 #include "exec_network.h"
 #include <low_precision/low_precision.hpp>
 
+#include "adaptive_streams_executor.h"
 #include "async_infer_request.h"
 #include "infer_request.h"
 #include "memory_state.h"
@@ -27,6 +28,7 @@
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
@@ -107,6 +109,12 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
 #else
         _taskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
 #endif
+        // the tasks of the parked streams are handed over to the other streams through the shared queue, so it's not
+        // compatible with the work stealing mode
+        if (_cfg.adaptiveStreams && streamsExecutorConfig._streams > 1 && !streamsExecutorConfig._work_stealing) {
+            _taskExecutor = std::make_shared<AdaptiveStreamsExecutor>(
+                std::dynamic_pointer_cast<InferenceEngine::IStreamsExecutor>(_taskExecutor), streamsExecutorConfig);
+        }
     }
     if (0 != cfg.streamExecutorConfig._streams) {
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -119,10 +127,28 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    if (_cfg.rtCacheShared) {
+        _sharedParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity, true);
+    }
+#if !(IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    // TBB builds overlap the shapes and the params stages with tbb::task_group on the threads of the stream. Otherwise the
+    // shapes are inferred by a dedicated thread per stream, so the parallel sections of prepareParams aren't nested.
+    if (_cfg.dynamicPreparationPipeline && function->is_dynamic()) {
+        _preparationExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"CPUPreparationExecutor", std::max(1, _cfg.streamExecutorConfig._streams), 1,
+                                     IStreamsExecutor::ThreadBindingType::NONE});
+    }
+#endif
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
-    if (_cfg.streamExecutorConfig._streams != 0) {
+    if (_cfg.streamExecutorConfig._streams != 0 && Config::WeightsNumaPolicy::ReplicateOnFirstUse == _cfg.weightsNumaPolicy) {
+        // Only one graph is created at compile time to validate the model. The graphs of the other streams, and so the weights
+        // replicas of their NUMA nodes, are created by the first inference executed by the stream (see GetGraph()).
+        _taskExecutor->runAndWait({[this] {
+            ExecNetwork::GetGraph();
+        }});
+    } else if (_cfg.streamExecutorConfig._streams != 0) {
         auto all_graphs_ready = [&] {
             return std::all_of(_graphs.begin(), _graphs.end(), [&] (Graph& graph) {
                 return graph.IsReady();
@@ -139,6 +165,10 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         ExecNetwork::GetGraph();
     }
+    // the nodes took the exported weights they use, the graphs created later reorder the weights themselves
+    for (const auto& op : function->get_ops()) {
+        op->get_rt_info().erase(EXPORTED_WEIGHTS);
+    }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -150,7 +180,6 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (!memoryNode) {
                     IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
                 }
-                auto state_store = memoryNode->getStore();
                 auto state_name = memoryNode->getId();
 
                 // Remove suffix with pair ID. Internal information.
@@ -158,7 +187,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new VariableState(state_name, state_store));
+                memoryStates.emplace_back(new VariableState(state_name, memoryNode->getStateDesc(), memoryNode->getDefaultStateDims(), memoryNode->getEngine()));
             }
         }
     }
@@ -181,14 +210,24 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                 {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
                     // disable weights caching if graph was created only once
-                    auto weightsCache =
-                        _cfg.streamExecutorConfig._streams != 1 ? _numaNodesWeights[numaNodeId] : nullptr;
+                    WeightsSharing::Ptr weightsCache;
+                    if (_cfg.streamExecutorConfig._streams != 1) {
+                        weightsCache = Config::WeightsNumaPolicy::SingleNode == _cfg.weightsNumaPolicy
+                                           ? _numaNodesWeights.front()
+                                           : _numaNodesWeights[numaNodeId];
+                    }
 
                     auto isQuantizedFlag =
                         (_cfg.lpTransformsMode == Config::On) &&
                         ngraph::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, _mutex, isQuantizedFlag);
+                    ctx = std::make_shared<GraphContext>(_cfg,
+                                                         extensionManager,
+                                                         weightsCache,
+                                                         _mutex,
+                                                         isQuantizedFlag,
+                                                         _sharedParamsCache,
+                                                         _preparationExecutor);
                 }
                 graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
@@ -309,6 +348,12 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
             RO_property(ov::execution_devices.name()),
+            RO_property(ov::intel_cpu::shared_weights_size.name()),
+            RO_property(ov::intel_cpu::private_weights_size.name()),
+            RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
+            RO_property(ov::intel_cpu::memory_plan_statistics.name()),
+            RO_property(ov::intel_cpu::weights_size_per_numa_node.name()),
+            RO_property(ov::intel_cpu::streams_info.name()),
         };
     }
 
@@ -353,6 +398,49 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
     } else if (name == ov::execution_devices) {
         return decltype(ov::execution_devices)::value_type{_plugin->GetName()};
+    } else if (name == ov::intel_cpu::runtime_cache_statistics) {
+        std::vector<MultiCachePtr> caches;
+        if (_sharedParamsCache) {
+            caches.push_back(_sharedParamsCache);
+        } else {
+            for (const auto& streamGraph : _graphs) {
+                if (const auto ctx = streamGraph.getGraphContext())
+                    caches.push_back(ctx->getParamsCache());
+            }
+        }
+        uint64_t hits = 0, misses = 0, evictions = 0;
+        for (const auto& cache : caches) {
+            const auto& stats = cache->getStatistics();
+            hits += stats.hits.load(std::memory_order_relaxed);
+            misses += stats.misses.load(std::memory_order_relaxed);
+            evictions += stats.evictions.load(std::memory_order_relaxed);
+        }
+        return decltype(ov::intel_cpu::runtime_cache_statistics)::value_type{
+            {"hits", hits}, {"misses", misses}, {"evictions", evictions}};
+    } else if (name == ov::intel_cpu::weights_size_per_numa_node) {
+        decltype(ov::intel_cpu::weights_size_per_numa_node)::value_type sizes;
+        for (const auto& item : _numaNodesWeights.getTotalSizePerNode()) {
+            sizes[std::to_string(item.first)] = item.second;
+        }
+        return sizes;
+    } else if (name == ov::intel_cpu::streams_info) {
+        if (const auto adaptiveExecutor = std::dynamic_pointer_cast<AdaptiveStreamsExecutor>(_taskExecutor)) {
+            return decltype(ov::intel_cpu::streams_info)::value_type(adaptiveExecutor->getStatistics());
+        }
+        return decltype(ov::intel_cpu::streams_info)::value_type(
+            AdaptiveStreamsExecutor::getStatistics(config.streamExecutorConfig));
+    } else if (name == ov::intel_cpu::memory_plan_statistics) {
+        const auto& stats = graph.GetMemoryPlanStatistics();
+        return decltype(ov::intel_cpu::memory_plan_statistics)::value_type{
+            {"planned_bytes", stats.plannedBytes},
+            {"naive_bytes", stats.naiveBytes},
+            {"upper_bounded_tensors", stats.upperBoundedTensors},
+            {"unbounded_tensors", stats.unboundedTensors}};
+    } else if (name == ov::intel_cpu::shared_weights_size || name == ov::intel_cpu::private_weights_size) {
+        size_t sharedBytes = 0, privateBytes = 0;
+        graph.GetConstantsMemorySize(sharedBytes, privateBytes);
+        return decltype(ov::intel_cpu::shared_weights_size)::value_type(
+            name == ov::intel_cpu::shared_weights_size ? sharedBytes : privateBytes);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -542,7 +630,27 @@ bool ExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network)
 }
 
 void ExecNetwork::Export(std::ostream& modelStream) {
-    CNNNetworkSerializer serializer(modelStream, extensionManager);
+    CompiledPrimitives primitives;
+    CompiledWeights weights;
+    {
+        const auto graphLock = GetGraph();
+        for (const auto& node : graphLock._graph.GetNodes()) {
+            auto reorderedWeights = node->getReorderedWeights();
+            if (!reorderedWeights.empty())
+                weights.emplace(node->getName(), std::move(reorderedWeights));
+
+            const auto selectedPD = node->getSelectedPrimitiveDescriptor();
+            if (!selectedPD)
+                continue;
+            const auto implType = selectedPD->getImplementationType();
+            if (implType == impl_desc_type::unknown || implType == impl_desc_type::undef)
+                continue;
+            primitives.emplace(node->getName(), impl_type_to_string(implType));
+        }
+    }
+
+    CNNNetworkSerializer serializer(modelStream, extensionManager, _plugin->GetVersion().buildNumber,
+                                    std::move(primitives), std::move(weights));
     serializer <<_network;
 }
 
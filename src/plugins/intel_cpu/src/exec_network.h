@@ -69,6 +69,10 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                    _numaNodesWeights;
+    // Runtime parameters cache shared by the graphs of all the streams (if enabled by the config)
+    MultiCachePtr                               _sharedParamsCache;
+    // Infers the shapes of the dynamic graphs while the streams prepare the params of their nodes (non-TBB builds only)
+    InferenceEngine::ITaskExecutor::Ptr         _preparationExecutor;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -3,6 +3,7 @@
 //
 
 #include "extension.h"
+#include "ngraph_transformations/op/color_convert_normalize.hpp"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include "ngraph_transformations/op/interaction.hpp"
 #include "ngraph_transformations/op/leaky_relu.hpp"
@@ -50,6 +51,7 @@ std::map<std::string, ngraph::OpSet> Extension::getOpSets() {
         NGRAPH_OP(PowerStaticNode, ov::intel_cpu)
         NGRAPH_OP(SwishNode, ov::intel_cpu)
         NGRAPH_OP(MHANode, ov::intel_cpu)
+        NGRAPH_OP(ColorConvertNormalizeNode, ov::intel_cpu)
         NGRAPH_OP(LoadConvertSaturation, ov::intel_cpu)
         NGRAPH_OP(LoadConvertTruncation, ov::intel_cpu)
         NGRAPH_OP(StoreConvertSaturation, ov::intel_cpu)
@@ -13,6 +13,8 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <mutex>
+#include <condition_variable>
 
 #include "graph.h"
 #include "graph_dumper.h"
@@ -27,6 +29,7 @@
 #include "nodes/convert.h"
 #include "nodes/subgraph.h"
 #include "nodes/fullyconnected.h"
+#include "nodes/memory.hpp"
 
 #include <ie_algorithm.hpp>
 #include <blob_factory.hpp>
@@ -50,6 +53,7 @@
 #include <transformations/utils/utils.hpp>
 #include <low_precision/low_precision.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include <common/primitive_hashing_utils.hpp>
 #include <common/primitive_desc.hpp>
 #include <common/primitive_desc_iface.hpp>
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -417,6 +421,46 @@ void Graph::InitGraph() {
     ExtractConstantAndExecutableNodes();
 
     ExecuteConstantNodesOnly();
+
+    // The output shapes may be reused for the same input shapes only if they are fully defined by the graph input shapes,
+    // i.e. there are no nodes with data dependent output shapes (sync nodes), no states, which may change the shapes between
+    // inferences, and the shape inference of every node reads only the values which are defined by the input shapes
+    // (e.g. Reshape with a target shape computed from ShapeOf, but not from a Parameter).
+    std::unordered_map<Node*, bool> definedByShapes;
+    std::function<bool(const NodePtr&)> valuesDefinedByShapes = [&](const NodePtr& node) {
+        if (node->isConstant() || node->getType() == Type::ShapeOf)
+            return true;
+        if (node->getType() == Type::Input || node->getType() == Type::MemoryInput)
+            return false;
+        auto it = definedByShapes.find(node.get());
+        if (it != definedByShapes.end())
+            return it->second;
+        bool defined = true;
+        for (size_t i = 0; i < node->getParentEdges().size() && defined; ++i) {
+            defined = valuesDefinedByShapes(node->getParentEdgeAt(i)->getParent());
+        }
+        definedByShapes[node.get()] = defined;
+        return defined;
+    };
+    auto shapesDependOnValues = [&](const NodePtr& node) {
+        if (node->getType() == Type::MemoryInput)
+            return true;
+        if (!node->isDynamicNode() || !node->shapeInference)
+            return false;
+        const auto portMask = node->shapeInference->get_port_mask();
+        for (size_t i = 0; i < node->getParentEdges().size(); ++i) {
+            const auto edge = node->getParentEdgeAt(i);
+            if ((portMask & PortMask(edge->getOutputNum())) && !valuesDefinedByShapes(edge->getParent()))
+                return true;
+        }
+        return false;
+    };
+    const auto shapesPlanCacheCapacity = getConfig().shapesPlanCacheCapacity;
+    if (haveDynNodes && syncNodesInds.empty() && shapesPlanCacheCapacity > 0 &&
+        std::none_of(graphNodes.begin(), graphNodes.end(), shapesDependOnValues)) {
+        shapesPlanCache.reset(new LruCache<InputShapesKey, ShapesPlan>(shapesPlanCacheCapacity));
+    }
+
     status = haveDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
 }
 
@@ -673,6 +717,91 @@ static edge_clusters_t findEdgeClusters(const std::vector<EdgePtr> & graphEdges)
     return edge_clusters;
 }
 
+/**
+ * The state of a ReadValue/Assign pair is kept in two buffers, whose roles are swapped after each inference.
+ * The memory of the ReadValue output and of the Assign input is bound to the current and the next state buffer
+ * respectively, so ReadValue reads the state in place and the Assign producer writes the new state directly.
+ * The clusters of such edges get their own memory managers and do not take part in the memory reuse.
+ * The pair falls back to copying when the clusters can't be bound safely, e.g. when the state is passed through
+ * in-place nodes from ReadValue to Assign or is a graph output.
+ * @return the ReadValue nodes with the bound state buffers
+ */
+static std::vector<node::MemoryInput*> allocateStateBuffers(const std::vector<NodePtr>& graphNodes, edge_clusters_t& edge_clusters) {
+    std::unordered_map<EdgePtr, size_t> clusterIndices;
+    for (size_t i = 0; i < edge_clusters.size(); i++) {
+        for (auto& edge : edge_clusters[i])
+            clusterIndices[edge] = i;
+    }
+
+    auto canBeBound = [&](size_t clusterIdx, size_t stateSize) {
+        for (auto& edge : edge_clusters[clusterIdx]) {
+            const auto& desc = edge->getDesc();
+            if (!desc.isDefined() || desc.getCurrentMemSize() > stateSize)
+                return false;
+            // the base memory of the cluster must be the state itself, not a bigger buffer the state is a part of
+            if (edge->getStatus() == Edge::Status::NeedAllocation && desc.getCurrentMemSize() != stateSize)
+                return false;
+            const auto& parent = edge->getParent();
+            const auto& child = edge->getChild();
+            if (parent->isConstant() || parent->getType() == Type::Input || child->getType() == Type::Output)
+                return false;
+        }
+        return true;
+    };
+
+    std::vector<node::MemoryInput*> states;
+    std::vector<bool> bound(edge_clusters.size(), false);
+    for (auto& node : graphNodes) {
+        if (node->getType() != Type::MemoryOutput)
+            continue;
+        auto assign = std::dynamic_pointer_cast<node::MemoryOutput>(node);
+        auto readValue = assign ? dynamic_cast<node::MemoryInput*>(assign->getInputNode()) : nullptr;
+        if (!readValue || readValue->getChildEdges().empty())
+            continue;
+
+        const auto readEdge = readValue->getChildEdgeAt(0);
+        const auto writeEdge = assign->getParentEdgeAt(0);
+        const auto readIt = clusterIndices.find(readEdge);
+        const auto writeIt = clusterIndices.find(writeEdge);
+        if (readIt == clusterIndices.end() || writeIt == clusterIndices.end())
+            continue;
+
+        const size_t readCluster = readIt->second;
+        const size_t writeCluster = writeIt->second;
+        if (readCluster == writeCluster || bound[readCluster] || bound[writeCluster])
+            continue;
+
+        const auto& stateDesc = readEdge->getDesc();
+        if (!stateDesc.isDefined() || !stateDesc.isCompatible(writeEdge->getDesc()))
+            continue;
+        const size_t stateSize = stateDesc.getCurrentMemSize();
+        if (!canBeBound(readCluster, stateSize) || !canBeBound(writeCluster, stateSize))
+            continue;
+
+        DnnlMemoryMngrPtr memMngrs[2];
+        const size_t clusters[2] = {readCluster, writeCluster};
+        for (size_t i = 0; i < 2; i++) {
+            memMngrs[i] = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse()));
+            for (auto& edge : edge_clusters[clusters[i]]) {
+                if (edge->getStatus() == Edge::Status::NeedAllocation)
+                    edge->allocate(memMngrs[i]);
+            }
+            bound[clusters[i]] = true;
+        }
+        readValue->bindStateBuffers(memMngrs[0], memMngrs[1]);
+        states.push_back(readValue);
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < edge_clusters.size(); i++) {
+        if (!bound[i])
+            edge_clusters[count++] = std::move(edge_clusters[i]);
+    }
+    edge_clusters.resize(count);
+
+    return states;
+}
+
 void Graph::AllocateWithReuse() {
     edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
 
@@ -704,16 +833,24 @@ void Graph::AllocateWithReuse() {
 
     edge_clusters.resize(edge_clusters_count);
 
+    doubleBufferedStates = allocateStateBuffers(graphNodes, edge_clusters);
+
     const int64_t alignment = 32;  // 32 bytes
 
+    memPlanStatistics = MemoryPlanStatistics();
+
+    // The dynamic tensors with upper bounded shapes are planned the same way as the static ones using their upper bound size,
+    // so they are never reallocated during inference. Only the unbounded ones are allocated at runtime.
     std::vector<MemorySolver::Box> definedBoxes;
     std::vector<MemorySolver::Box> undefinedBoxes;
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, i };
         int64_t boxSize = 0;
+        bool isDynamic = false;
         for (auto &edge : edge_clusters[i]) {
             int e_start = edge->getParent()->execIndex;
             int e_finish = edge->getChild()->execIndex;
+            isDynamic |= edge->getDesc().getShape().isDynamic();
 
             if (boxSize != -1 && edge->getDesc().hasDefinedMaxSize()) {
                 int64_t e_size = edge->getDesc().getMaxMemSize();  // size in bytes (from the beginning of data to the last element)
@@ -749,14 +886,21 @@ void Graph::AllocateWithReuse() {
         if (boxSize != -1) {
             box.size = div_up(boxSize, alignment);
             definedBoxes.push_back(box);
+            memPlanStatistics.naiveBytes += box.size * alignment;
+            if (isDynamic)
+                memPlanStatistics.upperBoundedTensors++;
         } else {
             box.size = boxSize;
             undefinedBoxes.push_back(box);
+            memPlanStatistics.unboundedTensors++;
         }
     }
 
     MemorySolver staticMemSolver(definedBoxes);
     size_t total_size = static_cast<size_t>(staticMemSolver.solve()) * alignment;
+    memPlanStatistics.plannedBytes = total_size;
+    DEBUG_LOG("Memory plan of ", _name, ": workspace ", total_size, " bytes (", memPlanStatistics.naiveBytes, " bytes without reuse), ",
+              memPlanStatistics.upperBoundedTensors, " upper bounded and ", memPlanStatistics.unboundedTensors, " unbounded dynamic tensors");
 
     memWorkspace = std::make_shared<Memory>(getEngine());
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
@@ -1050,9 +1194,70 @@ void Graph::InferStatic(InferRequestBase* request) {
     }
 }
 
+size_t Graph::InputShapesKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& item : dims) {
+        seed = get_vector_hash(seed, item);
+    }
+    return seed;
+}
+
+bool Graph::InputShapesKey::operator==(const InputShapesKey& rhs) const {
+    return dims == rhs.dims;
+}
+
 void Graph::InferDynamic(InferRequestBase* request) {
     dnnl::stream stream(getEngine());
 
+    // Shape inference is skipped for the nodes, whose output shapes have already been resolved for the current input shapes.
+    // The shapes are recorded only for the nodes without shape inference by-products (e.g. auto pads), since these by-products
+    // are consumed on the params preparation stage.
+    InputShapesKey shapesKey;
+    ShapesPlan shapesPlan;
+    std::vector<std::vector<VectorDims>> resolvedShapes;
+    bool resolvedShapesValid = true;
+    if (shapesPlanCache) {
+        shapesKey.dims.reserve(inputNodesMap.size());
+        for (const auto& input : inputNodesMap) {
+            const auto& node = input.second;
+            shapesKey.dims.push_back(node->getChildEdges().empty() ? VectorDims{} :
+                                     node->getChildEdgesAtPort(0)[0]->getMemory().getStaticDims());
+        }
+        shapesPlan = shapesPlanCache->get(shapesKey);
+        if (!shapesPlan) {
+            resolvedShapes.resize(executableGraphNodes.size());
+        }
+    }
+
+    auto updateNodeShapes = [&](size_t node_indx) {
+        const auto& node = executableGraphNodes[node_indx];
+        if (shapesPlan) {
+            const auto& shapes = (*shapesPlan)[node_indx];
+            if (shapes.empty()) {
+                node->updateShapes();
+            } else if (node->needShapeInfer()) {
+                node->redefineOutputMemory(shapes);
+            }
+        } else if (!resolvedShapes.empty() && node->getType() != Type::Input) {
+            // in contrast to updateShapes() the shapes are inferred even if the input shapes have not been changed,
+            // as the previous shapes may have been inferred for another input shapes set
+            auto result = node->shapeInfer();
+            if (ShapeInferStatus::success == result.status) {
+                node->redefineOutputMemory(result.dims);
+                if (node->shapeInference->get_pads_begin().empty() && node->shapeInference->get_pads_end().empty()) {
+                    resolvedShapes[node_indx] = std::move(result.dims);
+                }
+            } else {
+                resolvedShapesValid = false;
+            }
+        } else {
+            node->updateShapes();
+        }
+    };
+
     std::set<size_t> syncIndsWorkSet;
     for (const auto& nodeIndx : syncNodesInds) {
         syncIndsWorkSet.insert(nodeIndx.second);
@@ -1063,13 +1268,16 @@ void Graph::InferDynamic(InferRequestBase* request) {
     syncIndsWorkSet.insert(executableGraphNodes.size());
 
     std::function<void(size_t)> updateNodes;
+    const bool pipeline = getConfig().dynamicPreparationPipeline;
 
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
     std::atomic<size_t> prepareCounter(0);
-    std::vector<std::atomic<uint8_t>> waveFrontCount(executableGraphNodes.size());
-    waveFrontCount.front().store(1);
-    for (size_t i = 1; i < waveFrontCount.size(); ++i) {
-        waveFrontCount[i].store(2);
+    std::vector<std::atomic<uint8_t>> waveFrontCount(pipeline ? executableGraphNodes.size() : 0);
+    if (pipeline) {
+        waveFrontCount.front().store(1);
+        for (size_t i = 1; i < waveFrontCount.size(); ++i) {
+            waveFrontCount[i].store(2);
+        }
     }
 
     tbb::task_group tg;
@@ -1082,9 +1290,8 @@ void Graph::InferDynamic(InferRequestBase* request) {
             return;
         }
 
-        const auto& node = executableGraphNodes[node_indx];
-        if (node->isDynamicNode()) {
-            node->updateShapes();
+        if (executableGraphNodes[node_indx]->isDynamicNode()) {
+            updateNodeShapes(node_indx);
         }
         if (--waveFrontCount[node_indx] == 0) {
             tg.run([=, &updateDynParams](){ updateDynParams(node_indx, stop_indx); });
@@ -1107,23 +1314,97 @@ void Graph::InferDynamic(InferRequestBase* request) {
         }
     };
 
-    updateNodes = [&](size_t stopIndx) {
-        auto startCounter = prepareCounter.load();
-        tg.run([=, &updateShapes](){ updateShapes(startCounter, stopIndx); });
-        tg.wait();
-    };
+    if (pipeline) {
+        updateNodes = [&](size_t stopIndx) {
+            auto startCounter = prepareCounter.load();
+            tg.run([=, &updateShapes](){ updateShapes(startCounter, stopIndx); });
+            tg.wait();
+        };
+    }
 #else
     size_t prepareCounter = 0;
-    updateNodes = [&](size_t stopIndx) {
-        for (; prepareCounter < stopIndx; ++prepareCounter) {
-            const auto& node = executableGraphNodes[prepareCounter];
-            if (node->isDynamicNode()) {
-                node->updateShapes();
-                node->updateDynamicParams();
+    // The shapes are inferred by a task of the preparation executor, while this thread prepares the params of every node
+    // as soon as its shapes are ready. So prepareParams runs outside of any parallel region, and its own parallel
+    // sections (e.g. weights reorders) use all the threads of the stream.
+    std::mutex shapesMutex;
+    std::condition_variable shapesCondition;
+    size_t shapesCounter = 0;
+    bool shapesDone = false;
+    std::exception_ptr shapesException;
+    std::atomic<bool> shapesCanceled(false);
+
+    const auto preparationExecutor = context->getPreparationExecutor();
+    if (pipeline && preparationExecutor) {
+        updateNodes = [&](size_t stopIndx) {
+            if (prepareCounter >= stopIndx) {
+                return;
             }
-        }
-    };
+            const size_t startIndx = prepareCounter;
+            shapesCounter = startIndx;
+            shapesDone = false;
+            shapesCanceled = false;
+            preparationExecutor->run([&, startIndx, stopIndx] {
+                std::exception_ptr exception;
+                try {
+                    for (size_t i = startIndx; i < stopIndx && !shapesCanceled; ++i) {
+                        if (!executableGraphNodes[i]->isDynamicNode()) {
+                            continue;
+                        }
+                        updateNodeShapes(i);
+                        std::lock_guard<std::mutex> lock(shapesMutex);
+                        shapesCounter = i + 1;
+                        shapesCondition.notify_one();
+                    }
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+                // the locals of InferDynamic mustn't be touched once shapesDone is set
+                std::lock_guard<std::mutex> lock(shapesMutex);
+                shapesException = exception;
+                shapesDone = true;
+                shapesCondition.notify_one();
+            });
+
+            std::exception_ptr paramsException;
+            try {
+                for (; prepareCounter < stopIndx; ++prepareCounter) {
+                    const auto& node = executableGraphNodes[prepareCounter];
+                    if (!node->isDynamicNode()) {
+                        continue;
+                    }
+                    {
+                        std::unique_lock<std::mutex> lock(shapesMutex);
+                        shapesCondition.wait(lock, [&] { return shapesCounter > prepareCounter || shapesDone; });
+                        if (shapesCounter <= prepareCounter)
+                            break;
+                    }
+                    node->updateDynamicParams();
+                }
+            } catch (...) {
+                paramsException = std::current_exception();
+                shapesCanceled = true;
+            }
+
+            std::unique_lock<std::mutex> lock(shapesMutex);
+            shapesCondition.wait(lock, [&] { return shapesDone; });
+            if (paramsException)
+                std::rethrow_exception(paramsException);
+            if (shapesException)
+                std::rethrow_exception(shapesException);
+        };
+    }
 #endif
+    if (!updateNodes) {
+        updateNodes = [&](size_t stopIndx) {
+            for (; prepareCounter < stopIndx; ++prepareCounter) {
+                const auto& node = executableGraphNodes[prepareCounter];
+                if (node->isDynamicNode()) {
+                    updateNodeShapes(prepareCounter);
+                    node->updateDynamicParams();
+                }
+            }
+        };
+    }
     size_t inferCounter = 0;
 
     for (auto stopIndx : syncIndsWorkSet) {
@@ -1138,6 +1419,10 @@ void Graph::InferDynamic(InferRequestBase* request) {
             ExecuteNode(node, stream);
         }
     }
+
+    if (!resolvedShapes.empty() && resolvedShapesValid) {
+        shapesPlanCache->put(shapesKey, std::make_shared<const std::vector<std::vector<VectorDims>>>(std::move(resolvedShapes)));
+    }
 }
 
 inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const {
@@ -1166,6 +1451,10 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
     }
 
+    for (auto state : doubleBufferedStates) {
+        state->swapStateBuffers();
+    }
+
     if (infer_count != -1) infer_count++;
 }
 
@@ -1287,6 +1576,36 @@ void Graph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEnginePr
     }
 }
 
+void Graph::GetConstantsMemorySize(size_t& sharedBytes, size_t& privateBytes) const {
+    sharedBytes = 0;
+    privateBytes = 0;
+    std::unordered_set<const void*> visited;
+    for (const auto& edge : graphEdges) {
+        const auto parent = edge->getParent();
+        if (!parent->isConstant() ||
+            !one_of(edge->getStatus(), Edge::Status::Allocated, Edge::Status::Validated))
+            continue;
+        const auto& memory = edge->getMemoryPtr();
+        if (!memory || !visited.insert(memory->GetData()).second)
+            continue;
+
+        const auto size = memory->getDesc().getCurrentMemSize();
+        auto input = std::dynamic_pointer_cast<node::Input>(parent);
+        if (input && input->isSharedConstant()) {
+            sharedBytes += size;
+        } else {
+            privateBytes += size;
+        }
+    }
+    // the weights repacked by the nodes themselves (for dynamic shapes only after the first inference)
+    for (const auto& node : graphNodes) {
+        for (const auto& memory : node->getRepackedWeights()) {
+            if (memory && visited.insert(memory->GetData()).second)
+                privateBytes += memory->getDesc().getCurrentMemSize();
+        }
+    }
+}
+
 void Graph::RemoveEdge(EdgePtr& edge) {
     for (auto it = graphEdges.begin(); it != graphEdges.end(); it++) {
         if ((*it) == edge) {
@@ -11,6 +11,7 @@
 #include "node.h"
 #include "edge.h"
 #include "cache/multi_cache.h"
+#include "cache/lru_cache.h"
 #include "dnnl_scratch_pad.h"
 #include "graph_context.h"
 #include <map>
@@ -25,6 +26,10 @@ namespace intel_cpu {
 class InferRequestBase;
 class InferRequest;
 
+namespace node {
+class MemoryInput;
+}   // namespace node
+
 class Graph {
 public:
     typedef std::shared_ptr<Graph> Ptr;
@@ -115,6 +120,29 @@ public:
 
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
+    /**
+     * @brief Computes the size of the constant data referenced by the graph
+     * @param sharedBytes
+     * constant data used in place from the model buffers (e.g. memory mapped weights file)
+     * @param privateBytes
+     * constant data held in plugin owned memory (copied or reordered weights)
+     */
+    void GetConstantsMemorySize(size_t& sharedBytes, size_t& privateBytes) const;
+
+    /**
+     * @brief Statistics of the intermediate tensors memory planning
+     */
+    struct MemoryPlanStatistics {
+        size_t plannedBytes = 0;         // size of the workspace shared by the tensors with defined or upper bounded size
+        size_t naiveBytes = 0;           // total size of the same tensors if each of them was allocated separately
+        size_t upperBoundedTensors = 0;  // dynamic tensors placed to the workspace according to their upper bound size
+        size_t unboundedTensors = 0;     // dynamic tensors without upper bound, allocated and grown at runtime
+    };
+
+    const MemoryPlanStatistics& GetMemoryPlanStatistics() const {
+        return memPlanStatistics;
+    }
+
     void RemoveDroppedNodes();
     void RemoveDroppedEdges();
     void RemoveEdge(EdgePtr& edge);
@@ -202,6 +230,8 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        shapesPlanCache.reset();
+        doubleBufferedStates.clear();
     }
     Status status { Status::NotReady };
 
@@ -212,6 +242,7 @@ protected:
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
+    MemoryPlanStatistics memPlanStatistics;
 
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
@@ -255,6 +286,21 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // ReadValue nodes whose state buffers are bound to the graph memory directly and swapped after each inference
+    std::vector<node::MemoryInput*> doubleBufferedStates;
+
+    // The output shapes of the executable nodes resolved for a particular set of the graph input shapes.
+    // Allows to skip shape inference in InferDynamic when the graph is executed with the input shapes it has already seen.
+    struct InputShapesKey {
+        std::vector<VectorDims> dims;
+
+        size_t hash() const;
+        bool operator==(const InputShapesKey& rhs) const;
+    };
+    using ShapesPlan = std::shared_ptr<const std::vector<std::vector<VectorDims>>>;
+
+    std::unique_ptr<LruCache<InputShapesKey, ShapesPlan>> shapesPlanCache;
+
     GraphContext::CPtr context;
 
     void EnforceBF16();
@@ -8,6 +8,7 @@
 #include "config.h"
 #include "dnnl_scratch_pad.h"
 #include "extension_mngr.h"
+#include "threading/ie_itask_executor.hpp"
 #include "weights_cache.hpp"
 
 namespace ov {
@@ -22,13 +23,18 @@ public:
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
                  std::shared_ptr<std::mutex> sharedMutex,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 MultiCachePtr paramsCache = nullptr,
+                 InferenceEngine::ITaskExecutor::Ptr preparationExecutor = nullptr)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
           sharedMutex(sharedMutex),
+          rtParamsCache(paramsCache),
+          preparationExecutor(preparationExecutor),
           isGraphQuantizedFlag(isGraphQuantized) {
-        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+        if (!rtParamsCache)
+            rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
         rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
     }
 
@@ -52,6 +58,10 @@ public:
         return rtParamsCache;
     }
 
+    InferenceEngine::ITaskExecutor::Ptr getPreparationExecutor() const {
+        return preparationExecutor;
+    }
+
     DnnlScratchPadPtr getScratchPad() const {
         return rtScratchPad;
     }
@@ -71,8 +81,9 @@ private:
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
     std::shared_ptr<std::mutex> sharedMutex;  // mutex for protection of type-relaxed Op in clone_model()
 
-    MultiCachePtr rtParamsCache;     // primitive cache
+    MultiCachePtr rtParamsCache;     // primitive cache (may be shared between the graphs of a compiled model)
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
+    InferenceEngine::ITaskExecutor::Ptr preparationExecutor;  // infers the shapes of the dynamic graphs (non-TBB builds only)
 
     bool isGraphQuantizedFlag = false;
     static dnnl::engine eng;  // onednn engine (singleton)
@@ -41,6 +41,7 @@
 #endif
 #endif
 #include <cpu/x64/cpu_isa_traits.hpp>
+#include "nodes/fullyconnected.h"
 
 #include <string>
 #include <list>
@@ -61,7 +62,11 @@ namespace intel_cpu {
 GraphOptimizer::GraphOptimizer() {}
 
 void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "ApplyCommonGraphOptimizations", "FuseFCAndWeightsDecompression");
+    FuseFCAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionMatMulDeconvAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -177,6 +182,98 @@ void GraphOptimizer::ApplyImplSpecificGraphOptimizations(Graph &graph) {
     graph.RemoveDroppedEdges();
 }
 
+void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
+    // The pass must run before the constant nodes are executed, the decompression subgraph
+    // is created by ConvertMatMulToFC:
+    //
+    //   Input(u8 / i8) -> Convert -> [Subtract(zero points)] -> Multiply(scales) -> [Reshape] -> FullyConnected
+    //
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableChainNode = [](const NodePtr& node) {
+        return node->getChildEdges().size() == 1 && node->getFusedWith().empty();
+    };
+
+    auto getConstantParent = [](const NodePtr& eltwise, size_t port) -> node::Input* {
+        if (eltwise->getParentEdges().size() != 2)
+            return nullptr;
+        const auto parent = eltwise->getParentEdgesAtPort(port)[0]->getParent();
+        if (parent->getType() != Type::Input || !parent->isConstant() ||
+            parent->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            return nullptr;
+        return dynamic_cast<node::Input*>(parent.get());
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto fcNode = std::dynamic_pointer_cast<FullyConnected>(graphNodes[i]);
+        if (!fcNode || fcNode->getInputShapeAtPort(1).getRank() != 2)
+            continue;
+
+        NodePtr reshapeNode, subtractNode;
+        auto multiplyNode = fcNode->getParentEdgesAtPort(1)[0]->getParent();
+        if (multiplyNode->getType() == Type::Reshape) {
+            reshapeNode = multiplyNode;
+            if (!isSuitableChainNode(reshapeNode))
+                continue;
+            multiplyNode = reshapeNode->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        if (multiplyNode->getAlgorithm() != Algorithm::EltwiseMultiply || !isSuitableChainNode(multiplyNode))
+            continue;
+        const auto scales = getConstantParent(multiplyNode, 1);
+        if (!scales)
+            continue;
+
+        auto convertNode = multiplyNode->getParentEdgesAtPort(0)[0]->getParent();
+        node::Input* zeroPoints = nullptr;
+        if (convertNode->getAlgorithm() == Algorithm::EltwiseSubtract) {
+            subtractNode = convertNode;
+            if (!isSuitableChainNode(subtractNode))
+                continue;
+            zeroPoints = getConstantParent(subtractNode, 1);
+            if (!zeroPoints)
+                continue;
+            convertNode = subtractNode->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        if (convertNode->getType() != Type::Convert || !isSuitableChainNode(convertNode))
+            continue;
+
+        const auto weightsNode = convertNode->getParentEdgesAtPort(0)[0]->getParent();
+        const auto weightsPrecision = weightsNode->getOriginalOutputPrecisionAtPort(0);
+        if (weightsNode->getType() != Type::Input || !weightsNode->isConstant() ||
+            !one_of(weightsPrecision, Precision::U8, Precision::I8))
+            continue;
+
+        // [OC, IC] weights with the scales per output channel or [OC, groups, IC / groups] with the scales per group
+        const auto& weightsDims = weightsNode->getOutputShapeAtPort(0).getStaticDims();
+        if (weightsDims.size() != (reshapeNode ? 3 : 2))
+            continue;
+        const size_t groups = reshapeNode ? weightsDims[1] : 1;
+        const size_t size = weightsDims[0] * groups;
+        if (scales->getOutputShapeAtPort(0).getElementsCount() != size ||
+            (zeroPoints && zeroPoints->getOutputShapeAtPort(0).getElementsCount() != size))
+            continue;
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseFCAndWeightsDecompression);
+
+        fcNode->initializeWeightsDecompression(static_cast<const float*>(scales->getMemoryPtr()->GetPtr()),
+                                               zeroPoints ? static_cast<const float*>(zeroPoints->getMemoryPtr()->GetPtr()) : nullptr,
+                                               groups);
+
+        // the constant inputs are disconnected, so the subgraph becomes a chain and is dropped node by node
+        for (const auto& node : {reshapeNode, multiplyNode, subtractNode}) {
+            if (!node)
+                continue;
+            auto constEdge = node->getParentEdgesAtPort(1)[0];
+            graph.RemoveEdge(constEdge);
+        }
+        for (const auto& node : {reshapeNode, multiplyNode, subtractNode, convertNode}) {
+            if (node)
+                graph.DropNode(node);
+        }
+        fcNode->setOriginalInputPrecisionAtPort(1, weightsPrecision);
+    }
+}
+
 void GraphOptimizer::FuseConvolutionMatMulDeconvAndBias(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
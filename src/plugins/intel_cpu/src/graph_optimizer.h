@@ -20,6 +20,7 @@ public:
     void ApplyImplSpecificGraphOptimizations(Graph& graph);
 
 private:
+    void FuseFCAndWeightsDecompression(Graph &graph);
     void FuseConvolutionMatMulDeconvAndBias(Graph &graph);
     void FuseDeconvolutionAndSimpleOperation(Graph &graph);
     void FuseMultiplyAndAdd(Graph &graph);
@@ -39,16 +39,14 @@ void InferRequestBase::CreateInferRequest() {
 
     initBlobs();
 
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
+    // The variable states are owned by the request and are attached to the MemoryInput nodes
+    // of the graph for the duration of each inference.
     for (auto& node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
             auto memoryNode = dynamic_cast<node::MemoryInput*>(node.get());
             if (!memoryNode) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
             }
-            auto state_store = memoryNode->getStore();
             auto state_name = memoryNode->getId();
 
             // Remove suffix with pair ID. Internal information.
@@ -56,7 +54,7 @@ void InferRequestBase::CreateInferRequest() {
             if (suffix_idx != std::string::npos)
                 state_name = state_name.substr(0, suffix_idx);
 
-            memoryStates.emplace_back(new VariableState(state_name, state_store));
+            memoryStates.emplace_back(new VariableState(state_name, memoryNode->getStateDesc(), memoryNode->getDefaultStateDims(), memoryNode->getEngine()));
         }
     }
 }
@@ -92,7 +90,7 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
     graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
 }
 
-void InferRequestBase::PushStates() {
+void InferRequestBase::AttachStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
             auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
@@ -102,36 +100,21 @@ void InferRequestBase::PushStates() {
             auto cur_id = cur_node->getId();
             for (const auto& state : memoryStates) {
                 if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+                    cur_node->attachState(std::dynamic_pointer_cast<VariableState>(state));
                 }
             }
         }
     }
 }
 
-void InferRequestBase::PullStates() {
+void InferRequestBase::DetachStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
             auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
             if (!cur_node) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
             }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
-            }
+            cur_node->attachState(nullptr);
         }
     }
 }
@@ -174,13 +157,13 @@ void InferRequestBase::InferImpl() {
     PushInputData();
 
     if (memoryStates.size() != 0) {
-        PushStates();
+        AttachStates();
     }
 
     graph->Infer(this);
 
     if (memoryStates.size() != 0) {
-        PullStates();
+        DetachStates();
     }
 
     ThrowIfCanceled();
@@ -55,12 +55,15 @@ protected:
     virtual void initBlobs() = 0;
     virtual void PushInputData() = 0;
 
+    // The graph of the stream the request is currently executed on (it is reacquired on each inference).
+    // The intermediate tensors live in the graph workspace and are shared by all the requests executed on the same stream,
+    // so only the I/O blobs and the variable states are owned by the request itself.
     Graph* graph = nullptr;
     std::unordered_map<std::string, void*> externalPtr;
 
 private:
-    void PushStates();
-    void PullStates();
+    void AttachStates();
+    void DetachStates();
     void redefineMemoryForInputNodes();
 
     std::shared_ptr<ExecNetwork>        execNetwork;
@@ -5,16 +5,198 @@
 #include "memory_state.h"
 #include "dnnl_extension_utils.h"
 #include "blob_factory.hpp"
+#include "nodes/common/cpu_convert.h"
+#include "ie_parallel.hpp"
+
+#include <numeric>
 
 using namespace InferenceEngine;
 
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+
+/**
+ * Copies the slices [begin, end) along the axis of the tensor with the given dimensions.
+ * The source and the destination memory may have a reserve along the axis, i.e. their dimension along the axis
+ * may exceed the tensor dimension.
+ */
+void copySlices(const void* src, Precision srcPrc, size_t srcAxisDim,
+                void* dst, Precision dstPrc, size_t dstAxisDim,
+                const VectorDims& dims, size_t axis, size_t begin, size_t end) {
+    if (dims.empty()) {
+        if (srcPrc == dstPrc) {
+            cpu_memcpy(dst, src, srcPrc.size());
+        } else {
+            cpu_convert(src, dst, srcPrc, dstPrc, 1);
+        }
+        return;
+    }
+
+    const size_t outer = std::accumulate(dims.begin(), dims.begin() + axis, size_t(1), std::multiplies<size_t>());
+    const size_t inner = std::accumulate(dims.begin() + axis + 1, dims.end(), size_t(1), std::multiplies<size_t>());
+    const size_t count = (end - begin) * inner;
+    if (begin >= end || outer == 0 || count == 0)
+        return;
+
+    auto srcPtr = static_cast<const uint8_t*>(src);
+    auto dstPtr = static_cast<uint8_t*>(dst);
+    auto copySlice = [&](size_t i) {
+        auto srcSlice = srcPtr + (i * srcAxisDim + begin) * inner * srcPrc.size();
+        auto dstSlice = dstPtr + (i * dstAxisDim + begin) * inner * dstPrc.size();
+        if (srcPrc == dstPrc) {
+            cpu_memcpy(dstSlice, srcSlice, count * srcPrc.size());
+        } else {
+            cpu_convert(srcSlice, dstSlice, srcPrc, dstPrc, count);
+        }
+    };
+
+    if (outer == 1) {
+        copySlice(0);
+    } else {
+        parallel_for(outer, copySlice);
+    }
+}
+
+/**
+ * Returns the axis the reserve is kept along, the axis doesn't matter if there is no reserve
+ */
+size_t getReservedAxis(const VectorDims& dims, const VectorDims& reservedDims) {
+    for (size_t i = 0; i < dims.size(); i++) {
+        if (dims[i] != reservedDims[i])
+            return i;
+    }
+    return 0;
+}
+
+}   // namespace
+
+VariableState::VariableState(std::string name, MemoryDescPtr desc, VectorDims defaultDims, const dnnl::engine& engine)
+    : InferenceEngine::IVariableStateInternal{name}, desc(std::move(desc)), defaultDims(std::move(defaultDims)), engine(engine) {
+    Reset();
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    dims = defaultDims;
+    reserve(dims, false);
+    buffers[current]->FillZero();
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    const auto& tensorDesc = newState->getTensorDesc();
+    if (!desc->getShape().isCompatible(tensorDesc.getDims())) {
+        IE_THROW(ParameterMismatch) << "Can't set the state of the variable " << name << ": the state shape "
+                                    << desc->getShape().toString() << " is incompatible with the blob dimensions "
+                                    << MemoryDescUtils::dims2str(tensorDesc.getDims());
+    }
+    assign(newState->cbuffer().as<const void*>(), tensorDesc.getDims(), tensorDesc.getPrecision());
+}
+
+Blob::CPtr VariableState::GetState() const {
+    auto blob = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(*desc->cloneWithNewDims(dims, true)));
+    blob->allocate();
+    copyTo(blob->buffer(), desc->getPrecision());
+    return blob;
+}
+
+void VariableState::read(const Memory& dst) const {
+    const size_t elementsCount = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+    IE_ASSERT(dst.GetShape().getElementsCount() == elementsCount) << "The variable " << name << " state and the memory have different sizes.";
+    copyTo(dst.GetPtr(), dst.getDesc().getPrecision());
+}
+
+void VariableState::write(const Memory& src) {
+    assign(src.GetPtr(), src.getStaticDims(), src.getDesc().getPrecision());
+}
+
+void VariableState::append(const Memory& src, size_t axis) {
+    const auto& newDims = src.getStaticDims();
+    const auto prec = src.getDesc().getPrecision();
+
+    bool extends = prec == desc->getPrecision() && newDims.size() == dims.size() && axis < dims.size() &&
+                   newDims[axis] >= dims[axis] && (reservedDims == dims || getReservedAxis(dims, reservedDims) == axis);
+    for (size_t i = 0; extends && i < dims.size(); i++) {
+        extends = i == axis || newDims[i] == dims[i];
+    }
+    if (!extends) {
+        assign(src.GetPtr(), newDims, prec);
+        return;
+    }
+
+    if (newDims[axis] > reservedDims[axis]) {
+        auto newReservedDims = dims;
+        newReservedDims[axis] = std::max(newDims[axis], 2 * reservedDims[axis]);
+        reserve(newReservedDims, true);
+    }
+
+    copySlices(src.GetPtr(), prec, newDims[axis], buffers[current]->GetPtr(), prec, reservedDims[axis],
+               newDims, axis, dims[axis], newDims[axis]);
+    dims = newDims;
+}
+
+MemoryPtr VariableState::getCurrentBuffer() const {
+    return buffers[current];
+}
+
+MemoryPtr VariableState::getNextBuffer() {
+    auto& next = buffers[current ^ 1];
+    if (!next) {
+        next = std::make_shared<Memory>(engine);
+        next->Create(desc->cloneWithNewDims(reservedDims, true));
+    }
+    return next;
+}
+
+void VariableState::swapBuffers() {
+    IE_ASSERT(buffers[current ^ 1]) << "The variable " << name << " state is not double buffered.";
+    current ^= 1;
+}
+
+void VariableState::assign(const void* data, const VectorDims& newDims, Precision prec) {
+    // the state is written to the beginning of the reserved memory if it fits, the reserve is released otherwise
+    const auto axis = getReservedAxis(dims, reservedDims);
+    bool fits = newDims.size() == reservedDims.size();
+    for (size_t i = 0; fits && i < newDims.size(); i++) {
+        fits = i == axis ? newDims[i] <= reservedDims[i] : newDims[i] == reservedDims[i];
+    }
+    if (!fits) {
+        reserve(newDims, false);
+    }
+    dims = newDims;
+
+    const size_t axisDim = dims.empty() ? 1 : dims[axis];
+    const size_t reservedAxisDim = reservedDims.empty() ? 1 : reservedDims[axis];
+    copySlices(data, prec, axisDim, buffers[current]->GetPtr(), desc->getPrecision(), reservedAxisDim,
+               dims, axis, 0, axisDim);
+}
+
+void VariableState::copyTo(void* data, Precision prec) const {
+    const auto axis = getReservedAxis(dims, reservedDims);
+    const size_t axisDim = dims.empty() ? 1 : dims[axis];
+    const size_t reservedAxisDim = reservedDims.empty() ? 1 : reservedDims[axis];
+    copySlices(buffers[current]->GetPtr(), desc->getPrecision(), reservedAxisDim, data, prec, axisDim,
+               dims, axis, 0, axisDim);
+}
+
+void VariableState::reserve(const VectorDims& newReservedDims, bool keepData) {
+    const auto newDesc = desc->cloneWithNewDims(newReservedDims, true);
+    auto& buffer = buffers[current];
+    if (!buffer) {
+        buffer = std::make_shared<Memory>(engine);
+        buffer->Create(newDesc);
+    } else if (keepData) {
+        auto newBuffer = std::make_shared<Memory>(engine);
+        newBuffer->Create(newDesc);
+        const auto axis = getReservedAxis(dims, newReservedDims);
+        copySlices(buffer->GetPtr(), desc->getPrecision(), reservedDims[axis], newBuffer->GetPtr(), desc->getPrecision(),
+                   newReservedDims[axis], dims, axis, 0, dims[axis]);
+        buffer = newBuffer;
+    } else {
+        buffer->redefineDesc(newDesc);
+    }
+    reservedDims = newReservedDims;
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
@@ -10,21 +10,72 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
+#include <array>
 #include <string>
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief The variable state of an infer request.
+ * The state memory is owned by the infer request and is attached to the ReadValue/Assign nodes of the graph for the duration
+ * of each inference, so the state is not copied between the infer request and the graph.
+ * The state with dynamic shape keeps a reserve along the axis it grows by. The reserve is doubled each time it is exhausted,
+ * so appending a new part to the state (e.g. the keys and values of the next token) costs O(new part size) amortized.
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
-    }
+    /**
+     * @param name the variable name
+     * @param desc the state descriptor
+     * @param defaultDims the dimensions of the default (zero filled) state
+     * @param engine
+     */
+    VariableState(std::string name, MemoryDescPtr desc, VectorDims defaultDims, const dnnl::engine& engine);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    const VectorDims& getDims() const {
+        return dims;
+    }
+
+    /**
+     * @brief Copies the state to the dense memory with the state dimensions
+     */
+    void read(const Memory& dst) const;
+    /**
+     * @brief Replaces the state with the content of the memory
+     */
+    void write(const Memory& src);
+    /**
+     * @brief Replaces the state with the memory, which is the concatenation of the state with a new part along the axis.
+     * Only the new part is copied, the memory is written as is if it doesn't extend the state along the axis.
+     */
+    void append(const Memory& src, size_t axis);
+
+    /**
+     * @brief The buffers of the double buffered state: the current one holds the state, the next one receives the new state
+     * during the inference. The buffers are used for the states with static shape only.
+     */
+    MemoryPtr getCurrentBuffer() const;
+    MemoryPtr getNextBuffer();
+    void swapBuffers();
+
+private:
+    void assign(const void* data, const VectorDims& newDims, InferenceEngine::Precision prec);
+    void copyTo(void* data, InferenceEngine::Precision prec) const;
+    void reserve(const VectorDims& newReservedDims, bool keepData);
+
+    MemoryDescPtr desc;
+    VectorDims defaultDims;
+    dnnl::engine engine;
+    VectorDims dims;
+    // dimensions of the allocated memory, exceed the state dimensions along the axis the state grows by
+    VectorDims reservedDims;
+    std::array<MemoryPtr, 2> buffers;
+    size_t current = 0;
 };
 
 }   // namespace intel_cpu
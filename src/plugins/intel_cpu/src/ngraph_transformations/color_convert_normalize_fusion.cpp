@@ -0,0 +1,153 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "color_convert_normalize_fusion.hpp"
+
+#include <algorithm>
+
+#include <openvino/core/rt_info.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+
+#include "itt.hpp"
+#include "op/color_convert_normalize.hpp"
+
+namespace {
+
+constexpr size_t channels = 3;
+
+/**
+ * Returns the per-channel values of the constant input of the elementwise operation,
+ * or the empty vector if the constant isn't broadcasted along the channels of the NHWC image
+ */
+std::vector<float> getChannelValues(const std::shared_ptr<ov::Node>& eltwise, const ov::Output<ov::Node>& data) {
+    const auto& autob = eltwise->get_autob();
+    if (autob.m_type != ov::op::AutoBroadcastType::NUMPY)
+        return {};
+
+    const bool commutative = ov::is_type<ov::opset1::Add>(eltwise) || ov::is_type<ov::opset1::Multiply>(eltwise);
+    size_t constIdx = 1;
+    if (eltwise->input_value(0) != data) {
+        if (!commutative)
+            return {};
+        constIdx = 0;
+    }
+    auto constant = ov::as_type_ptr<ov::opset1::Constant>(eltwise->get_input_node_shared_ptr(constIdx));
+    if (!constant)
+        return {};
+
+    const auto& shape = constant->get_shape();
+    const size_t size = ov::shape_size(shape);
+    if (shape.size() > 4 || (size != 1 && size != channels) || (size == channels && shape.back() != channels))
+        return {};
+
+    auto values = constant->cast_vector<float>();
+    if (size == 1)
+        values.resize(channels, values[0]);
+    return values;
+}
+
+}   // namespace
+
+ov::intel_cpu::ColorConvertNormalizeFusion::ColorConvertNormalizeFusion() {
+    MATCHER_SCOPE(ColorConvertNormalizeFusion);
+    using namespace ov::pass::pattern;
+    auto colorConvert_m = wrap_type<ov::opset8::NV12toRGB, ov::opset8::NV12toBGR, ov::opset8::I420toRGB, ov::opset8::I420toBGR>();
+
+    matcher_pass_callback callback = [](Matcher& m) {
+        const auto colorConvert = m.get_match_root();
+        const auto srcFormat = ov::is_type<ov::opset8::NV12toRGB>(colorConvert) || ov::is_type<ov::opset8::NV12toBGR>(colorConvert)
+                                   ? "NV12" : "I420";
+        const auto dstFormat = ov::is_type<ov::opset8::NV12toRGB>(colorConvert) || ov::is_type<ov::opset8::I420toRGB>(colorConvert)
+                                   ? "RGB" : "BGR";
+        const auto precision = colorConvert->get_output_element_type(0);
+        if (precision != ov::element::u8 && precision != ov::element::f32)
+            return false;
+
+        ov::NodeVector fused{colorConvert};
+
+        // the u8 planes converted to f32 are read as is
+        ov::OutputVector planes = colorConvert->input_values();
+        const bool convertedPlanes = std::all_of(planes.begin(), planes.end(), [](const ov::Output<ov::Node>& plane) {
+            const auto convert = ov::as_type_ptr<ov::opset1::Convert>(plane.get_node_shared_ptr());
+            return convert && convert->get_input_element_type(0) == ov::element::u8 && plane.get_target_inputs().size() == 1;
+        });
+        if (convertedPlanes) {
+            for (auto& plane : planes) {
+                fused.push_back(plane.get_node_shared_ptr());
+                plane = plane.get_node()->input_value(0);
+            }
+        }
+
+        // the output is (rgb - mean) * scale
+        std::vector<float> mean(channels, 0.f);
+        std::vector<float> scale(channels, 1.f);
+        bool planar = false;
+
+        auto last = colorConvert;
+        while (!planar) {
+            const auto consumers = last->output(0).get_target_inputs();
+            if (consumers.size() != 1)
+                break;
+            const auto node = consumers.begin()->get_node()->shared_from_this();
+            const auto inPrecision = last->get_output_element_type(0);
+
+            if (const auto convert = ov::as_type_ptr<ov::opset1::Convert>(node)) {
+                if (inPrecision != ov::element::u8 || convert->get_destination_type() != ov::element::f32)
+                    break;
+            } else if (ov::is_type<ov::opset1::Add>(node) || ov::is_type<ov::opset1::Subtract>(node) ||
+                       ov::is_type<ov::opset1::Multiply>(node) || ov::is_type<ov::opset1::Divide>(node)) {
+                if (inPrecision != ov::element::f32 || node->get_output_element_type(0) != ov::element::f32)
+                    break;
+                const auto values = getChannelValues(node, last->output(0));
+                if (values.empty())
+                    break;
+
+                auto newMean = mean, newScale = scale;
+                bool valid = true;
+                for (size_t c = 0; c < channels; c++) {
+                    if (ov::is_type<ov::opset1::Multiply>(node)) {
+                        newScale[c] *= values[c];
+                    } else if (ov::is_type<ov::opset1::Divide>(node)) {
+                        valid &= values[c] != 0.f;
+                        newScale[c] /= values[c];
+                    } else {
+                        // (rgb - mean) * scale +/- value == (rgb - (mean -/+ value / scale)) * scale
+                        valid &= scale[c] != 0.f;
+                        const float shift = values[c] / scale[c];
+                        newMean[c] += ov::is_type<ov::opset1::Add>(node) ? -shift : shift;
+                    }
+                }
+                if (!valid)
+                    break;
+                mean = newMean;
+                scale = newScale;
+            } else if (const auto transpose = ov::as_type_ptr<ov::opset1::Transpose>(node)) {
+                const auto order = ov::as_type_ptr<ov::opset1::Constant>(transpose->get_input_node_shared_ptr(1));
+                if (!order || order->cast_vector<int64_t>() != std::vector<int64_t>{0, 3, 1, 2})
+                    break;
+                planar = true;
+            } else {
+                break;
+            }
+
+            fused.push_back(node);
+            last = node;
+        }
+
+        if (fused.size() == 1 || last->get_output_element_type(0) != ov::element::f32)
+            return false;
+
+        const bool round = precision.is_integral();
+        auto colorConvertNormalize = std::make_shared<ColorConvertNormalizeNode>(planes, srcFormat, dstFormat, mean, scale, round, planar);
+        colorConvertNormalize->set_friendly_name(last->get_friendly_name());
+        ov::copy_runtime_info(fused, colorConvertNormalize);
+        ov::replace_node(last, colorConvertNormalize);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(colorConvert_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,25 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Fuses the chain generated by PrePostProcessor for the NV12/I420 input:
+ *   [Convert(u8->f32)] -> NV12toRGB/I420toRGB/... -> [Convert(u8->f32)] -> [Add/Subtract/Multiply/Divide]... -> [Transpose(0,3,1,2)]
+ * into ColorConvertNormalizeNode, which is executed in a single pass over the image.
+ * The arithmetic operations must have per-channel constants.
+ */
+class ColorConvertNormalizeFusion: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ColorConvertNormalizeFusion", "0");
+    ColorConvertNormalizeFusion();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -3,10 +3,14 @@
 //
 
 #include "convert_matmul_to_fc.hpp"
+#include "mark_weights_decompression.hpp"
 #include "op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/or.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/dequantization_node.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 #include <transformations/utils/utils.hpp>
 
 #include "itt.hpp"
@@ -15,7 +19,19 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
     MATCHER_SCOPE(ConvertMatMulToFC);
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
     auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
-    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
+    // int8 weights decompressed by FullyConnected, see MarkWeightsDecompression
+    auto compressed_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(
+        ngraph::pattern::type_matches_any({ ngraph::element::u8, ngraph::element::i8 }));
+    auto convert_m = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({ compressed_m }, ngraph::pattern::consumers_count(1));
+    auto zero_point_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto subtract_m = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({ convert_m, zero_point_m }, ngraph::pattern::consumers_count(1));
+    auto scale_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto multiply_input_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{ subtract_m, convert_m });
+    auto multiply_m = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({ multiply_input_m, scale_m }, ngraph::pattern::consumers_count(1));
+    auto reshape_m = ngraph::pattern::wrap_type<ngraph::opset1::Reshape>({ multiply_m, ngraph::pattern::wrap_type<ngraph::opset1::Constant>() },
+                                                                         ngraph::pattern::consumers_count(1));
+    auto matmul_weights_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{ weights_m, reshape_m, multiply_m });
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, matmul_weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
         const auto& pattern_map = m.get_pattern_value_map();
@@ -28,7 +44,8 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
         // fc_input_a and fc_input_b - are the final inputs that will be set to FullyConnected of GemmIE operations.
         // So in case of adding new operations that takes matmul inputs we need keep update fc_input_a and fc_input_b.
         auto fc_input_a = pattern_map.at(activations_m);
-        auto fc_input_b = pattern_map.at(weights_m);
+        auto fc_input_b = matmul->input_value(1);
+        const bool compressed = pattern_map.count(convert_m) != 0;
 
         auto shape_a = fc_input_a.get_partial_shape();
         auto shape_b = fc_input_b.get_partial_shape();
@@ -45,10 +62,18 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
+        if ((!compressed && !std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr())) ||
             std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
+        // the same check disables the constant folding of the decompression subgraph, see MarkWeightsDecompression
+        if (compressed && !is_fc_weights_decompression_supported(matmul,
+                                                                 pattern_map.at(convert_m).get_node_shared_ptr(),
+                                                                 pattern_map.count(subtract_m) ? pattern_map.at(zero_point_m).get_node_shared_ptr() : nullptr,
+                                                                 pattern_map.at(scale_m).get_node_shared_ptr(),
+                                                                 pattern_map.count(reshape_m) ? pattern_map.at(reshape_m).get_node_shared_ptr() : nullptr)) {
+            return false;
+        }
         /*
          *  get_aligned_shapes function align two input shapes to have the same size and
          *  the same batch dimensions (last two dimensions are not comparable).
@@ -125,8 +150,80 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
         // Transferring from MatMul representation: [B, I, K] * [B, K, O] = [B, I, O]
         // to FullyConnected representation: [I, K] * [K, O] = [I, O]
 
+        /*
+         *  create_decompression function returns the weights decompression subgraph in FullyConnected layout:
+         *  Convert([OC, IC]) -> [Subtract([OC, 1])] -> Multiply([OC, 1]) for the per channel scales or
+         *  Convert([OC, groups, group size]) -> [Subtract([OC, groups, 1])] -> Multiply([OC, groups, 1]) -> Reshape([OC, IC])
+         *  for the scales per group of input channels. The scales and the zero points are broadcasted to all
+         *  the output channels (and groups), so the decompression isn't converted to a scale-shift.
+         *  The subgraph is checked by is_fc_weights_decompression_supported() beforehand.
+         */
+        auto create_decompression = [&]() -> std::shared_ptr<ngraph::Node> {
+            auto weights = std::dynamic_pointer_cast<ngraph::opset1::Constant>(pattern_map.at(compressed_m).get_node_shared_ptr());
+            auto convert = pattern_map.at(convert_m).get_node_shared_ptr();
+            const auto& decompressed_type = convert->get_output_element_type(0);
+            const bool grouped = pattern_map.count(reshape_m) != 0;
+
+            ngraph::Output<ngraph::Node> weights_normalized = weights;
+            auto weights_shape = weights->get_shape();
+            if (!grouped && !matmul->get_transpose_b()) {
+                weights_normalized = create_transpose(weights, weights->get_friendly_name() + "/transpose_b");
+            }
+            const size_t oc_axis = !grouped && !matmul->get_transpose_b() ? 1 : 0;
+            const size_t OC = weights_shape[oc_axis];
+            const size_t groups = grouped ? weights_shape[1] : 1;
+
+            auto normalize = [&](const ngraph::Output<ngraph::Node>& output) -> std::shared_ptr<ngraph::Node> {
+                auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(output.get_node_shared_ptr());
+                auto shape = constant->get_shape();
+                shape.insert(shape.begin(), weights_shape.size() - shape.size(), 1);
+                const auto values = constant->cast_vector<float>();
+                const bool per_channel = shape[oc_axis] != 1;
+                const bool per_group = grouped && shape[1] != 1;
+                std::vector<float> broadcasted(OC * groups);
+                for (size_t oc = 0; oc < OC; oc++) {
+                    for (size_t g = 0; g < groups; g++) {
+                        broadcasted[oc * groups + g] = values[(per_channel ? oc : 0) * (per_group ? groups : 1) + (per_group ? g : 0)];
+                    }
+                }
+                auto normalized_shape = grouped ? ngraph::Shape{ OC, groups, 1 } : ngraph::Shape{ OC, 1 };
+                auto normalized = ngraph::opset1::Constant::create(decompressed_type, normalized_shape, broadcasted);
+                new_ops.push_back(normalized);
+                return normalized;
+            };
+
+            auto scale = normalize(pattern_map.at(scale_m));
+            std::shared_ptr<ngraph::Node> zero_point;
+            if (pattern_map.count(subtract_m)) {
+                zero_point = normalize(pattern_map.at(zero_point_m));
+            }
+
+            auto new_convert = std::make_shared<ngraph::opset1::Convert>(weights_normalized, decompressed_type);
+            ov::disable_constant_folding(new_convert);
+            new_ops.push_back(new_convert);
+            std::shared_ptr<ngraph::Node> decompressed = new_convert;
+            if (zero_point) {
+                decompressed = std::make_shared<ngraph::opset1::Subtract>(decompressed, zero_point);
+                ov::mark_as_dequantization_node(decompressed);
+                new_ops.push_back(decompressed);
+            }
+            decompressed = std::make_shared<ngraph::opset1::Multiply>(decompressed, scale);
+            ov::mark_as_dequantization_node(decompressed);
+            new_ops.push_back(decompressed);
+            if (grouped) {
+                const auto& output_shape = pattern_map.at(reshape_m).get_shape();
+                auto reshape_shape = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, output_shape);
+                new_ops.push_back(reshape_shape);
+                decompressed = std::make_shared<ngraph::opset1::Reshape>(decompressed, reshape_shape, false);
+                new_ops.push_back(decompressed);
+            }
+            return decompressed;
+        };
+
         // Weights normalization
-        if (!matmul->get_transpose_b()) {
+        if (compressed) {
+            fc_input_b = create_decompression();
+        } else if (!matmul->get_transpose_b()) {
             fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
         }
 
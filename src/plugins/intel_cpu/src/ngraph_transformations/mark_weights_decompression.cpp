@@ -0,0 +1,119 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_weights_decompression.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/dequantization_node.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+#include "itt.hpp"
+
+namespace {
+// the scales and the zero points are folded to constants, also when they are stored in a lower precision
+bool is_constant_path(const std::shared_ptr<ngraph::Node>& node) {
+    if (ngraph::is_type<ngraph::opset1::Convert>(node))
+        return ngraph::is_type<ngraph::opset1::Constant>(node->get_input_node_ptr(0));
+    return ngraph::is_type<ngraph::opset1::Constant>(node);
+}
+} // namespace
+
+bool ov::intel_cpu::is_fc_weights_decompression_supported(const std::shared_ptr<const ngraph::Node>& matmul_node,
+                                                          const std::shared_ptr<const ngraph::Node>& convert,
+                                                          const std::shared_ptr<const ngraph::Node>& zero_point,
+                                                          const std::shared_ptr<const ngraph::Node>& scale,
+                                                          const std::shared_ptr<const ngraph::Node>& reshape) {
+    const auto matmul = ov::as_type_ptr<const ngraph::opset1::MatMul>(matmul_node);
+    if (!matmul)
+        return false;
+    // FullyConnected takes 2D or 3D activations
+    const auto rank_a = matmul->get_input_partial_shape(0).rank();
+    if (rank_a.is_dynamic() || rank_a.get_length() == 1 || rank_a.get_length() > 3 || matmul->get_output_partial_shape(0).rank().is_dynamic())
+        return false;
+    // the weights are decompressed in [OC, IC] layout, so they are normalized only by transposition
+    const auto rank_b = matmul->get_input_partial_shape(1).rank();
+    if (rank_b.is_dynamic() || rank_b.get_length() != 2 || convert->get_output_element_type(0) != ngraph::element::f32)
+        return false;
+
+    const auto& weights_pshape = convert->get_input_partial_shape(0);
+    if (weights_pshape.is_dynamic())
+        return false;
+    const auto weights_shape = weights_pshape.to_shape();
+    const bool grouped = reshape != nullptr;
+    if (grouped) {
+        const auto& output_shape = reshape->get_output_partial_shape(0);
+        if (!matmul->get_transpose_b() || weights_shape.size() != 3 || output_shape.is_dynamic() || output_shape.size() != 2 ||
+            output_shape[0] != weights_shape[0])
+            return false;
+    } else if (weights_shape.size() != 2) {
+        return false;
+    }
+    const size_t oc_axis = !grouped && !matmul->get_transpose_b() ? 1 : 0;
+    const size_t groups = grouped ? weights_shape[1] : 1;
+    // the scalar decompression is converted to PowerStatic, which isn't fused
+    if (weights_shape[oc_axis] == 1 && groups == 1)
+        return false;
+
+    // only the output channels and the groups may be not broadcasted
+    auto is_broadcasted = [&](const std::shared_ptr<const ngraph::Node>& node) {
+        const auto& pshape = node->get_output_partial_shape(0);
+        if (node->get_output_element_type(0) != ngraph::element::f32 || pshape.is_dynamic() || pshape.size() > weights_shape.size())
+            return false;
+        auto shape = pshape.to_shape();
+        shape.insert(shape.begin(), weights_shape.size() - shape.size(), 1);
+        for (size_t i = 0; i < shape.size(); i++) {
+            if (shape[i] != 1 && (shape[i] != weights_shape[i] || (i != oc_axis && !(grouped && i == 1))))
+                return false;
+        }
+        return true;
+    };
+    return is_broadcasted(scale) && (!zero_point || is_broadcasted(zero_point));
+}
+
+ov::intel_cpu::MarkWeightsDecompression::MarkWeightsDecompression() {
+    MATCHER_SCOPE(MarkWeightsDecompression);
+    const ngraph::element::TypeVector compressed_precisions{ ngraph::element::u8, ngraph::element::i8,
+                                                             ngraph::element::u4, ngraph::element::i4 };
+    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(ngraph::pattern::type_matches_any(compressed_precisions));
+    auto convert_m = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({ weights_m },
+        [](ngraph::Output<ngraph::Node> output) {
+            return ngraph::pattern::consumers_count(1)(output) && ngraph::pattern::type_matches(ngraph::element::f32)(output);
+        });
+    auto zero_point_m = ngraph::pattern::any_input();
+    auto subtract_m = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({ convert_m, zero_point_m }, ngraph::pattern::consumers_count(1));
+    auto scale_m = ngraph::pattern::any_input();
+    auto multiply_input_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{ subtract_m, convert_m });
+    auto multiply_m = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({ multiply_input_m, scale_m }, ngraph::pattern::consumers_count(1));
+    auto reshape_m = ngraph::pattern::wrap_type<ngraph::opset1::Reshape>({ multiply_m, ngraph::pattern::wrap_type<ngraph::opset1::Constant>() },
+                                                                         ngraph::pattern::consumers_count(1));
+    auto matmul_weights_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{ reshape_m, multiply_m });
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ ngraph::pattern::any_input(), matmul_weights_m });
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        if (!is_constant_path(pattern_map.at(scale_m).get_node_shared_ptr()))
+            return false;
+
+        const auto subtract = pattern_map.find(subtract_m);
+        if (subtract != pattern_map.end() && !is_constant_path(pattern_map.at(zero_point_m).get_node_shared_ptr()))
+            return false;
+        if (!is_fc_weights_decompression_supported(pattern_map.at(matmul_m).get_node_shared_ptr(),
+                                                   pattern_map.at(convert_m).get_node_shared_ptr(),
+                                                   subtract != pattern_map.end() ? pattern_map.at(zero_point_m).get_node_shared_ptr() : nullptr,
+                                                   pattern_map.at(scale_m).get_node_shared_ptr(),
+                                                   pattern_map.count(reshape_m) ? pattern_map.at(reshape_m).get_node_shared_ptr() : nullptr))
+            return false;
+
+        if (subtract != pattern_map.end())
+            ov::mark_as_dequantization_node(subtract->second.get_node_shared_ptr());
+        ov::mark_as_dequantization_node(pattern_map.at(multiply_m).get_node_shared_ptr());
+        ov::disable_constant_folding(pattern_map.at(convert_m).get_node_shared_ptr());
+        return false;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, matcher_name);
+    this->register_matcher(m, callback);
+}
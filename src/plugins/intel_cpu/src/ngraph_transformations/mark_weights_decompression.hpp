@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+/*
+ * Description:
+ *     MarkWeightsDecompression keeps the int8 / int4 weights of MatMul compressed. ConstantFolding is disabled
+ *     for the decompression Convert, so the decompression subgraph reaches the plugin graph, where it's fused into
+ *     FullyConnected and evaluated by its kernel. Subtract and Multiply are marked as dequantization nodes, so they
+ *     are kept unchanged by the common transformations.
+ *
+ *     Constant (u8 / i8 / u4 / i4)
+ *         |
+ *      Convert   zero point
+ *          \     /
+ *          Subtract   scale          (Subtract is optional)
+ *              \      /
+ *              Multiply
+ *                 |
+ *              Reshape               (optional, [OC, groups, group size] -> [OC, IC] for the scales per group)
+ *                 |
+ *              MatMul
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+class MarkWeightsDecompression : public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkWeightsDecompression", "0");
+    MarkWeightsDecompression();
+};
+
+/**
+ * Checks that the decompression subgraph of the MatMul weights is converted to FullyConnected by ConvertMatMulToFC
+ * and fused into it. The subgraph is kept unfolded only when it is, otherwise the decompression is done at every
+ * inference. zero_point and reshape are nullptr when the subgraph doesn't have them.
+ */
+bool is_fc_weights_decompression_supported(const std::shared_ptr<const ngraph::Node>& matmul,
+                                           const std::shared_ptr<const ngraph::Node>& convert,
+                                           const std::shared_ptr<const ngraph::Node>& zero_point,
+                                           const std::shared_ptr<const ngraph::Node>& scale,
+                                           const std::shared_ptr<const ngraph::Node>& reshape);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "color_convert_normalize.hpp"
+#include "../itt.hpp"
+
+ov::intel_cpu::ColorConvertNormalizeNode::ColorConvertNormalizeNode(const ngraph::OutputVector& planes,
+                                                                   const std::string& srcFormat,
+                                                                   const std::string& dstFormat,
+                                                                   const std::vector<float>& mean,
+                                                                   const std::vector<float>& scale,
+                                                                   bool round,
+                                                                   bool planar)
+    : Op(planes), m_src_format(srcFormat), m_dst_format(dstFormat), m_mean(mean), m_scale(scale),
+      m_round(round), m_planar(planar) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::ColorConvertNormalizeNode::clone_with_new_inputs(const ngraph::OutputVector &new_args) const {
+    INTERNAL_OP_SCOPE(ColorConvertNormalizeNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::ColorConvertNormalizeNode>(new_args, m_src_format, m_dst_format, m_mean, m_scale,
+                                                                      m_round, m_planar);
+}
+
+void ov::intel_cpu::ColorConvertNormalizeNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(ColorConvertNormalizeNode_validate_and_infer_types);
+    NODE_VALIDATION_CHECK(this, m_src_format == "NV12" || m_src_format == "I420", "Unsupported source color format ", m_src_format);
+    NODE_VALIDATION_CHECK(this, m_dst_format == "RGB" || m_dst_format == "BGR", "Unsupported destination color format ", m_dst_format);
+    const size_t planes = get_input_size();
+    NODE_VALIDATION_CHECK(this, planes == 1 || planes == (m_src_format == "NV12" ? 2 : 3), "Incorrect number of the image planes");
+    NODE_VALIDATION_CHECK(this, m_mean.size() == 3 && m_scale.size() == 3, "Mean and scale must have a value per channel");
+
+    const auto& yShape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, yShape.rank().compatible(4), "Y plane must have rank 4");
+
+    ngraph::PartialShape outShape = ngraph::PartialShape::dynamic(4);
+    if (yShape.rank().is_static()) {
+        auto height = yShape[1];
+        if (planes == 1)
+            height = height.is_static() ? ngraph::Dimension(height.get_length() * 2 / 3) : ngraph::Dimension::dynamic();
+        outShape = m_planar ? ngraph::PartialShape{yShape[0], 3, height, yShape[2]}
+                            : ngraph::PartialShape{yShape[0], height, yShape[2], 3};
+    }
+    set_output_type(0, ngraph::element::f32, outShape);
+}
+
+bool ov::intel_cpu::ColorConvertNormalizeNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    INTERNAL_OP_SCOPE(ColorConvertNormalizeNode_visit_attributes);
+    visitor.on_attribute("src_format", m_src_format);
+    visitor.on_attribute("dst_format", m_dst_format);
+    visitor.on_attribute("mean", m_mean);
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("round", m_round);
+    visitor.on_attribute("planar", m_planar);
+    return true;
+}
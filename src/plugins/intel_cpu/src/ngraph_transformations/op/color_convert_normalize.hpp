@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Color conversion of the NV12/I420 image fused with the preprocessing applied to its result:
+ * conversion to f32, per-channel mean and scale and conversion of the layout from NHWC to NCHW.
+ * The output is computed as (rgb - mean) * scale.
+ */
+class ColorConvertNormalizeNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("ColorConvertNormalize", "cpu_plugin_opset");
+
+    ColorConvertNormalizeNode() = default;
+
+    /**
+     * @param planes      the planes of the image as expected by the NV12toRGB/I420toRGB operations
+     * @param srcFormat   "NV12" or "I420"
+     * @param dstFormat   "RGB" or "BGR"
+     * @param mean        per-channel mean, in the order of the output channels
+     * @param scale       per-channel scale, in the order of the output channels
+     * @param round       round the converted colors, as the conversion of the integer image does
+     * @param planar      produce the NCHW output instead of NHWC
+     */
+    ColorConvertNormalizeNode(const ngraph::OutputVector& planes,
+                              const std::string& srcFormat,
+                              const std::string& dstFormat,
+                              const std::vector<float>& mean,
+                              const std::vector<float>& scale,
+                              bool round,
+                              bool planar);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    const std::string& get_src_format() const { return m_src_format; }
+    const std::string& get_dst_format() const { return m_dst_format; }
+    const std::vector<float>& get_mean() const { return m_mean; }
+    const std::vector<float>& get_scale() const { return m_scale; }
+    bool get_round() const { return m_round; }
+    bool get_planar() const { return m_planar; }
+
+private:
+    std::string m_src_format;
+    std::string m_dst_format;
+    std::vector<float> m_mean;
+    std::vector<float> m_scale;
+    bool m_round = false;
+    bool m_planar = false;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -150,6 +150,12 @@ Node::Node(const std::shared_ptr<ngraph::Node>& op,
                 IE_THROW() << "Unsupported CPU implementation " << str << " for node " << getName();
         }
     }
+    if (implPriorities.empty() && rtInfo.count(EXPORTED_IMPL_TYPE)) {
+        exportedImplType = parse_impl_name(getRTInfoValue(rtInfo, EXPORTED_IMPL_TYPE));
+    }
+    if (rtInfo.count(EXPORTED_WEIGHTS)) {
+        exportedWeights = rtInfo.at(EXPORTED_WEIGHTS).as<ExportedWeights>();
+    }
 
     std::string inputMemoryFormats = getInputMemoryFormats(op);
     if (!inputMemoryFormats.empty()) {
@@ -615,6 +621,7 @@ void Node::initSupportedPrimitiveDescriptors() {
         return;
 
     auto attr = initPrimitiveAttr();
+    onlyExportedImpl = exportedImplType != impl_desc_type::unknown;
 
     for (auto& desc : descs) {
         primitive_desc_iterator itpd;
@@ -625,6 +632,13 @@ void Node::initSupportedPrimitiveDescriptors() {
         }
 
         while (static_cast<bool>(itpd)) {
+            impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
+            if (isSkippedOnImport(impl_type)) {
+                if (!itpd.next_impl())
+                    break;
+                continue;
+            }
+
             NodeConfig config;
             config.dynBatchSupport = true;
             for (size_t i = 0; i < descInputNumbers(desc); i++) {
@@ -652,13 +666,19 @@ void Node::initSupportedPrimitiveDescriptors() {
                 }
                 config.outConfs.push_back(portConfig);
             }
-            impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
 
             supportedPrimitiveDescriptors.emplace_back(config, impl_type);
-            if (!itpd.next_impl())
+            // the implementations of lower priority aren't selected anyway
+            if (onlyExportedImpl || !itpd.next_impl())
                 break;
         }
     }
+
+    if (onlyExportedImpl && supportedPrimitiveDescriptors.empty()) {
+        // the exported implementation isn't available, fall back to the regular selection
+        exportedImplType = impl_desc_type::unknown;
+        initSupportedPrimitiveDescriptors();
+    }
 }
 
 void Node::filterSupportedPrimitiveDescriptors() {
@@ -721,6 +741,13 @@ void Node::initDescriptor(const NodeConfig& config) {
             itpd = desc.createPrimitiveDescriptorIterator(engine, *(attr.get()));
         }
         while (static_cast<bool>(itpd)) {
+            impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
+            if (isSkippedOnImport(impl_type)) {
+                if (!itpd.next_impl())
+                    break;
+                continue;
+            }
+
             NodeConfig cfg;
             cfg.dynBatchSupport = true;
             for (size_t i = 0; i < descInputNumbers(desc); i++) {
@@ -738,7 +765,6 @@ void Node::initDescriptor(const NodeConfig& config) {
                 dataConfig.setMemDesc(getDstMemDesc(itpd, i));
                 cfg.outConfs.push_back(dataConfig);
             }
-            impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
             if (selected_count == selectedPrimitiveDescriptorIndex) {
                 if (impl_type != selectedPD->getImplementationType()) {
                     IE_THROW() << getName() << " expected selectedPD impl_type: " << impl_type_to_string(selectedPD->getImplementationType())
@@ -752,7 +778,7 @@ void Node::initDescriptor(const NodeConfig& config) {
                 }
             }
             selected_count++;
-            if (!itpd.next_impl())
+            if (onlyExportedImpl || !itpd.next_impl())
                 break;
         }
     }
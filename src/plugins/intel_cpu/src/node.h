@@ -8,6 +8,7 @@
 #include <memory>
 #include <vector>
 #include <string>
+#include <unordered_map>
 #include <cassert>
 #include <algorithm>
 #include <caseless.hpp>
@@ -41,6 +42,13 @@
 namespace ov {
 namespace intel_cpu {
 
+// The rt_info key of the implementation type selected for the node when the compiled model was exported
+constexpr const char* EXPORTED_IMPL_TYPE = "cpuExportedImplType";
+// The rt_info key of the weights reordered by the node when the compiled model was exported (ExportedWeights)
+constexpr const char* EXPORTED_WEIGHTS = "cpuExportedWeights";
+// The reordered weights read from the exported blob by the key of their precision and memory format
+using ExportedWeights = std::unordered_map<std::string, std::shared_ptr<const std::vector<uint8_t>>>;
+
 using NodePtr = std::shared_ptr<Node>;
 using NodeConstPtr = std::shared_ptr<const Node>;
 using NodeWeakPtr = std::weak_ptr<Node>;
@@ -181,6 +189,17 @@ public:
 
     bool isConstant();
 
+    // weights repacked by the node into a layout of the selected primitive, which aren't stored on the edges
+    virtual std::vector<MemoryCPtr> getRepackedWeights() const {
+        return {internalBlobMemory.begin(), internalBlobMemory.end()};
+    }
+
+    // weights reordered by the node into a layout of the selected primitive by the key of their precision and memory
+    // format, stored in the exported blob (see exportedWeights)
+    virtual std::unordered_map<std::string, MemoryCPtr> getReorderedWeights() const {
+        return {};
+    }
+
     // return type int supports return -1 in overloading when channel axis doesn't exist
     virtual int getFusingAxis() const {
         return 1;
@@ -548,6 +567,19 @@ protected:
     std::vector <NodePtr> fusedWith;
     std::vector <NodePtr> mergedWith;
     std::vector <impl_desc_type> implPriorities;
+    /**
+     * The implementation type selected for the node when the compiled model was exported, unknown if there is none
+     * or the user defined the priorities. Only the primitive descriptors of this type are enumerated then, which
+     * skips the creation of the other implementations on import.
+     */
+    impl_desc_type exportedImplType = impl_desc_type::unknown;
+    // supportedPrimitiveDescriptors contain only the implementations of exportedImplType
+    bool onlyExportedImpl = false;
+    bool isSkippedOnImport(impl_desc_type implType) const {
+        return onlyExportedImpl && implType != exportedImplType;
+    }
+    // The weights reordered by the node when the compiled model was exported, copied instead of reordered again on import
+    ExportedWeights exportedWeights;
     std::vector <dnnl::memory::format_tag> inputMemoryFormatsFilter;
     std::vector <dnnl::memory::format_tag> outputMemoryFormatsFilter;
     bool enforceBF16evenForGraphTail = false;
@@ -11,6 +11,7 @@
 #include <openvino/core/type.hpp>
 #include <ie/ie_parallel.hpp>
 #include <utils/jit_kernel.hpp>
+#include "ngraph_transformations/op/color_convert_normalize.hpp"
 
 using namespace InferenceEngine;
 using namespace dnnl::impl::utils;
@@ -31,6 +32,12 @@ std::tuple<Algorithm, std::string> getAlgorithmFor(const std::shared_ptr<const n
         return std::make_tuple(Algorithm::ColorConvertI420toRGB, std::string());
     if (ov::is_type<ov::op::v8::I420toBGR>(op))
         return std::make_tuple(Algorithm::ColorConvertI420toBGR, std::string());
+    if (const auto normalize = ov::as_type_ptr<const ov::intel_cpu::ColorConvertNormalizeNode>(op)) {
+        const bool rgb = normalize->get_dst_format() == "RGB";
+        if (normalize->get_src_format() == "NV12")
+            return std::make_tuple(rgb ? Algorithm::ColorConvertNV12toRGB : Algorithm::ColorConvertNV12toBGR, std::string());
+        return std::make_tuple(rgb ? Algorithm::ColorConvertI420toRGB : Algorithm::ColorConvertI420toBGR, std::string());
+    }
     return std::make_tuple(Algorithm::Default, std::string("Type ") + op->get_type_name() + " is not supported.");
 }
 
@@ -75,6 +82,73 @@ std::tuple<T, T, T> Converter::yuv_to_rgb(float y, float u, float v) {
     return std::make_tuple(r, g, b);
 }
 
+/**
+ * The base of the converters with the fused normalization. The output is f32: (rgb - mean) * scale.
+ */
+class NormalizingConverter : public Converter {
+public:
+    NormalizingConverter(Node *node);
+
+protected:
+    struct OutputRow {
+        float * begin;  // the first value of the interleaved row
+        float * r;
+        float * g;
+        float * b;
+        size_t step;    // the distance between the values of the neighbouring pixels
+    };
+
+    OutputRow outputRow(size_t batch, size_t h, size_t height, size_t width) const;
+
+    template <typename T>
+    void convertRow(const T* y, const T* u, const T* v, size_t uvStep, const OutputRow & dst, size_t width);
+
+    std::array<float, 6> _normalization;    // mean and scale of R, G and B
+    bool _round;
+    bool _planar;
+};
+
+NormalizingConverter::NormalizingConverter(Node *node)
+    : Converter(node) {
+    const auto normalization = static_cast<ColorConvert*>(node)->getNormalization();
+    if (!normalization)
+        IE_THROW() << "ColorConvert node with name '" << node->getName() << "' has no fused normalization";
+    for (size_t c = 0; c < 3; ++c) {
+        _normalization[c] = normalization->mean[_colorFormat[c]];
+        _normalization[3 + c] = normalization->scale[_colorFormat[c]];
+    }
+    _round = normalization->round;
+    _planar = normalization->planar;
+}
+
+NormalizingConverter::OutputRow NormalizingConverter::outputRow(size_t batch, size_t h, size_t height, size_t width) const {
+    float * dst = static_cast<float*>(output(0));
+    if (_planar) {
+        auto plane = [&](size_t c) {
+            return dst + (batch * 3 + c) * height * width + h * width;
+        };
+        return { nullptr, plane(_colorFormat[0]), plane(_colorFormat[1]), plane(_colorFormat[2]), 1 };
+    }
+    float * row = dst + (batch * height + h) * width * 3;
+    return { row, row + _colorFormat[0], row + _colorFormat[1], row + _colorFormat[2], 3 };
+}
+
+template <typename T>
+void NormalizingConverter::convertRow(const T* y, const T* u, const T* v, size_t uvStep, const OutputRow & dst, size_t width) {
+    for (size_t w = 0; w < width; w++) {
+        const size_t uv_index = (w / 2) * uvStep;
+        float rgb[3];
+        std::tie(rgb[0], rgb[1], rgb[2]) = yuv_to_rgb<float>(static_cast<float>(y[w]),
+                                                             static_cast<float>(u[uv_index]),
+                                                             static_cast<float>(v[uv_index]));
+        float * out[3] = { dst.r, dst.g, dst.b };
+        for (size_t c = 0; c < 3; c++) {
+            const float value = _round ? std::round(rgb[c]) : rgb[c];
+            out[c][w * dst.step] = (value - _normalization[c]) * _normalization[3 + c];
+        }
+    }
+}
+
 struct jit_uni_converter : public jit_kernel {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_converter)
 
@@ -85,6 +159,10 @@ struct jit_uni_converter : public jit_kernel {
         void * dst;
         size_t width;
         uint8_t colorFormat;    // RGB: 0, BGR: !=0
+        // The kernels with the fused normalization only
+        const float * normalization;    // mean and scale of R, G and B
+        void * dst_g;                   // the planes of G and B of the planar output, dst is the plane of R
+        void * dst_b;
     };
 
     typedef void (*function_t)(const Params *);
@@ -104,6 +182,41 @@ protected:
                     const variable<float[N]> & v,
                     const variable<uint8_t> & color_format,
                     bool round);
+    // The values of y, u and v are not preserved
+    template<size_t N>
+    void yuv_to_rgb(const variable<float[N]> & y,
+                    const variable<float[N]> & u,
+                    const variable<float[N]> & v,
+                    const variable<float[N]> & r,
+                    const variable<float[N]> & g,
+                    const variable<float[N]> & b,
+                    bool round);
+    // Interleaves r, g and b to r0, r1 and r2
+    template<size_t N>
+    void blend(const variable<float[N]> & r,
+               const variable<float[N]> & g,
+               const variable<float[N]> & b,
+               const variable<float[N]> & r0,
+               const variable<float[N]> & r1,
+               const variable<float[N]> & r2);
+
+    template<size_t N>
+    using yuv_variables = std::tuple<variable<float[N]>, variable<float[N]>, variable<float[N]>>;
+    template<typename T, size_t N>
+    using yuv_loader = std::function<yuv_variables<N>(const variable<const T*> & src_y,
+                                                      const variable<const T*> & src_u,
+                                                      const variable<const T*> & src_v)>;
+    template<typename T, size_t N>
+    using yuv_tail_loader = std::function<yuv_variables<N>(const variable<const T*> & src_y,
+                                                           const variable<const T*> & src_u,
+                                                           const variable<const T*> & src_v,
+                                                           const variable<size_t> & width)>;
+    // Generates the kernel with the fused normalization, the pixels are loaded in the source format specific way
+    template<typename T, size_t N>
+    void generate_normalizing(bool round,
+                              bool planar,
+                              const yuv_loader<T, N> & load,
+                              const yuv_tail_loader<T, N> & load_tail);
     template<typename T, size_t N>
     void store_tail(const variable<T*> & dst,
                     const variable<float[N]> & a,
@@ -132,78 +245,37 @@ void jit_uni_converter::yuv_to_rgb(const variable<float[N]> & y,
                                    const variable<float[N]> & v,
                                    const variable<uint8_t> & color_format,
                                    bool round) {
+    // Reserve registers
+    auto r = var<float[N]>();
+    auto g = var<float[N]>();
+    auto b = var<float[N]>();
+
+    yuv_to_rgb(y, u, v, r, g, b, round);
+
+    // blend r,g,b and put to y,u,v
+    _if(color_format == 0)
+    ._then([&]{ blend(r, g, b, y, u, v); })
+    ._else([&]{ blend(b, g, r, y, u, v); });
+}
+
+template<size_t N>
+void jit_uni_converter::yuv_to_rgb(const variable<float[N]> & y,
+                                   const variable<float[N]> & u,
+                                   const variable<float[N]> & v,
+                                   const variable<float[N]> & r,
+                                   const variable<float[N]> & g,
+                                   const variable<float[N]> & b,
+                                   bool round) {
     auto clip = [&](const variable<float[N]> & op,
-                    const variable<float[N]> & a,
-                    const variable<float[N]> & b) {
+                    const variable<float[N]> & lo,
+                    const variable<float[N]> & hi) {
         if (round)
             uni_vroundps(op, op, 0);
-        uni_vmaxps(op, op, a);
-        uni_vminps(op, op, b);
+        uni_vmaxps(op, op, lo);
+        uni_vminps(op, op, hi);
     };
 
-    // blend r,g,b and put to r0,r1,r2
-    auto blend = [&](const variable<float[N]> & r, const variable<float[N]> & g, const variable<float[N]> & b,
-                     const variable<float[N]> & r0, const variable<float[N]> & r1, const variable<float[N]> & r2) {
-        /*
-            Input:
-            r0,r1,r2,r3,r4,r5,r6,r7
-            g0,g1,g2,g3,g4,g5,g6,g7
-            b0,b1,b2,b3,b4,b5,b6,b7
-
-            Permutation:
-            r0,r3,r6,r1,r4,r7,r2,r5
-            g5,g0,g3,g6,g1,g4,g7,g2
-            b2,b5,b0,b3,b6,b1,b4,b7
-
-            Blend
-            r0,g0,xx,r1,g1,xx,r2,g2     blend 1+2 by mask 10210210
-            r0,g0,b0,r1,g1,b1,r2,g2     blend +3  by mask 00100100
-
-            xx,r3,g3,xx,r4,g4,xx,r5     blend 1+2 by mask 02102102
-            b2,r3,g3,b3,r4,g4,b4,r5     blend +3  by mask 01001001
-
-            g5,xx,r6,g6,xx,r7,g7,xx     blend 1+2 by mask 21021021
-            g5,b5,r6,g6,b6,r7,g7,b7     blend +3  by mask 10010010
-
-            Result
-            a = r0,g0,b0,r1,g1,b1,r2,g2
-            b = b2,r3,g3,b3,r4,g4,b4,r5
-            c = g5,b5,r6,g6,b6,r7,g7,b7
-        */
-
-        auto genPermutationMask = [&](int offset) {
-            std::array<uint8_t, N> mask {};
-            for (uint8_t i = 0; i < mask.size(); ++i)
-                mask[(i * 3 + offset) % mask.size()] = i;
-            return mask;
-        };
-
-        r.permute(genPermutationMask(0));
-        g.permute(genPermutationMask(1));
-        b.permute(genPermutationMask(2));
-
-        auto blendWithMask = [&](int offset, const variable<float[N]> & result) {
-            static const uint32_t blendMasks[2] = {
-                0x92492492,
-                0x24924924
-            };
-            const uint16_t mask0 = static_cast<const uint16_t>(blendMasks[0] >> ((offset * N) % 3));
-            const uint16_t mask1 = static_cast<const uint16_t>(blendMasks[1] >> ((offset * N) % 3));
-
-            result = r;
-            result.blend(g, mask0);
-            result.blend(b, mask1);
-        };
-
-        blendWithMask(0, r0);
-        blendWithMask(1, r1);
-        blendWithMask(2, r2);
-    };  // blend
-
     // Reserve registers
-    auto r = var<float[N]>();
-    auto g = var<float[N]>();
-    auto b = var<float[N]>();
     auto tmp = var<float[N]>();
 
     uni_vbroadcastss(tmp, ptr[_consts + 0 * sizeof(float)]);    // tmp = [16.0f,16.0f,...]
@@ -237,10 +309,69 @@ void jit_uni_converter::yuv_to_rgb(const variable<float[N]> & y,
     clip(r, y, u);
     clip(g, y, u);
     clip(b, y, u);
+}
 
-    _if(color_format == 0)
-    ._then([&]{ blend(r, g, b, y, u, v); })
-    ._else([&]{ blend(b, g, r, y, u, v); });
+template<size_t N>
+void jit_uni_converter::blend(const variable<float[N]> & r,
+                              const variable<float[N]> & g,
+                              const variable<float[N]> & b,
+                              const variable<float[N]> & r0,
+                              const variable<float[N]> & r1,
+                              const variable<float[N]> & r2) {
+    /*
+        Input:
+        r0,r1,r2,r3,r4,r5,r6,r7
+        g0,g1,g2,g3,g4,g5,g6,g7
+        b0,b1,b2,b3,b4,b5,b6,b7
+
+        Permutation:
+        r0,r3,r6,r1,r4,r7,r2,r5
+        g5,g0,g3,g6,g1,g4,g7,g2
+        b2,b5,b0,b3,b6,b1,b4,b7
+
+        Blend
+        r0,g0,xx,r1,g1,xx,r2,g2     blend 1+2 by mask 10210210
+        r0,g0,b0,r1,g1,b1,r2,g2     blend +3  by mask 00100100
+
+        xx,r3,g3,xx,r4,g4,xx,r5     blend 1+2 by mask 02102102
+        b2,r3,g3,b3,r4,g4,b4,r5     blend +3  by mask 01001001
+
+        g5,xx,r6,g6,xx,r7,g7,xx     blend 1+2 by mask 21021021
+        g5,b5,r6,g6,b6,r7,g7,b7     blend +3  by mask 10010010
+
+        Result
+        a = r0,g0,b0,r1,g1,b1,r2,g2
+        b = b2,r3,g3,b3,r4,g4,b4,r5
+        c = g5,b5,r6,g6,b6,r7,g7,b7
+    */
+
+    auto genPermutationMask = [&](int offset) {
+        std::array<uint8_t, N> mask {};
+        for (uint8_t i = 0; i < mask.size(); ++i)
+            mask[(i * 3 + offset) % mask.size()] = i;
+        return mask;
+    };
+
+    r.permute(genPermutationMask(0));
+    g.permute(genPermutationMask(1));
+    b.permute(genPermutationMask(2));
+
+    auto blendWithMask = [&](int offset, const variable<float[N]> & result) {
+        static const uint32_t blendMasks[2] = {
+            0x92492492,
+            0x24924924
+        };
+        const uint16_t mask0 = static_cast<const uint16_t>(blendMasks[0] >> ((offset * N) % 3));
+        const uint16_t mask1 = static_cast<const uint16_t>(blendMasks[1] >> ((offset * N) % 3));
+
+        result = r;
+        result.blend(g, mask0);
+        result.blend(b, mask1);
+    };
+
+    blendWithMask(0, r0);
+    blendWithMask(1, r1);
+    blendWithMask(2, r2);
 }
 
 template<typename T, size_t N>
@@ -264,6 +395,127 @@ void jit_uni_converter::store_tail(const variable<T*> & dst,
     copy<T>(ptr[dst], s.pointer(), copy_size);
 }
 
+template<typename T, size_t N>
+void jit_uni_converter::generate_normalizing(bool round,
+                                             bool planar,
+                                             const yuv_loader<T, N> & load,
+                                             const yuv_tail_loader<T, N> & load_tail) {
+    preamble();
+
+    // Get arguments addresses
+    auto src_y = arg<const T*>(&Params::y);
+    auto src_u = arg<const T*>(&Params::u);
+    auto src_v = arg<const T*>(&Params::v);
+    auto width = arg(&Params::width);
+    auto normalization = arg(&Params::normalization);
+
+    static const float data[8] = { 16.f, 128.f, 1.164f, 1.596f, 0.391f, 2.018f, 0.813f, 255.f };
+    _consts = data;
+
+    const size_t reg_capacity_log = static_cast<size_t>(std::logb(N));
+    const size_t step = N * sizeof(float);
+
+    // (rgb - mean) * scale, the channels of r, g and b are 0, 1 and 2
+    auto normalize = [&](const variable<float[N]> & op, size_t channel) {
+        auto tmp = var<float[N]>();
+        uni_vbroadcastss(tmp, ptr[normalization + channel * sizeof(float)]);          // tmp = [mean,mean,...]
+        uni_vsubps(op, op, tmp);                                                        // op = op - tmp
+        uni_vbroadcastss(tmp, ptr[normalization + (3 + channel) * sizeof(float)]);    // tmp = [scale,scale,...]
+        uni_vmulps(op, op, tmp);                                                        // op = op * tmp
+    };
+
+    auto convert = [&](const yuv_variables<N> & yuv,
+                       const variable<float[N]> & r,
+                       const variable<float[N]> & g,
+                       const variable<float[N]> & b) {
+        yuv_to_rgb(std::get<0>(yuv), std::get<1>(yuv), std::get<2>(yuv), r, g, b, round);
+        normalize(r, 0);
+        normalize(g, 1);
+        normalize(b, 2);
+    };
+
+    width >>= reg_capacity_log;
+
+    if (planar) {
+        auto dst_r = arg<float*>(&Params::dst);
+        auto dst_g = arg<float*>(&Params::dst_g);
+        auto dst_b = arg<float*>(&Params::dst_b);
+
+        foreach(0, width, [&](const Reg64 & idx) {
+            auto yuv = load(src_y, src_u, src_v);
+            auto r = var<float[N]>();
+            auto g = var<float[N]>();
+            auto b = var<float[N]>();
+
+            convert(yuv, r, g, b);
+
+            store(dst_r, r);  dst_r += step;
+            store(dst_g, g);  dst_g += step;
+            store(dst_b, b);  dst_b += step;
+        });
+
+        mov(width, argPtr(&Params::width));
+        width &= N - 1;
+
+        _if(width != 0)
+        ._then([&] {
+            auto yuv = load_tail(src_y, src_u, src_v, width);
+            auto r = var<float[N]>();
+            auto g = var<float[N]>();
+            auto b = var<float[N]>();
+
+            convert(yuv, r, g, b);
+
+            store(dst_r, r, width);
+            store(dst_g, g, width);
+            store(dst_b, b, width);
+        });
+    } else {
+        auto dst = arg<float*>(&Params::dst);
+        auto colorFormat = arg(&Params::colorFormat);
+
+        // the interleaved output of the converted pixels: the blended r, g and b are put to y, u and v
+        auto convert_interleaved = [&](const yuv_variables<N> & yuv) {
+            const auto & y = std::get<0>(yuv);
+            const auto & u = std::get<1>(yuv);
+            const auto & v = std::get<2>(yuv);
+            auto r = var<float[N]>();
+            auto g = var<float[N]>();
+            auto b = var<float[N]>();
+
+            convert(yuv, r, g, b);
+
+            _if(colorFormat == 0)
+            ._then([&]{ blend(r, g, b, y, u, v); })
+            ._else([&]{ blend(b, g, r, y, u, v); });
+        };
+
+        foreach(0, width, [&](const Reg64 & idx) {
+            auto yuv = load(src_y, src_u, src_v);
+
+            convert_interleaved(yuv);
+
+            store(dst, std::get<0>(yuv));  dst += step;
+            store(dst, std::get<1>(yuv));  dst += step;
+            store(dst, std::get<2>(yuv));  dst += step;
+        });
+
+        mov(width, argPtr(&Params::width));
+        width &= N - 1;
+
+        _if(width != 0)
+        ._then([&] {
+            auto yuv = load_tail(src_y, src_u, src_v, width);
+
+            convert_interleaved(yuv);
+
+            store_tail(dst, std::get<0>(yuv), std::get<1>(yuv), std::get<2>(yuv), width);
+        });
+    }
+
+    postamble();
+}
+
 namespace nv12 {
 
 ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node *node) {
@@ -272,11 +524,15 @@ ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node *node) {
     const Precision precision = node->getOriginalInputPrecisionAtPort(0) == Precision::U8
                                     ? Precision::U8
                                     : Precision::FP32;
+    // f32 if the normalization is fused
+    const Precision outPrecision = node->getOriginalOutputPrecisionAtPort(0) == Precision::U8
+                                    ? Precision::U8
+                                    : Precision::FP32;
 
     ColorConvert::Converter::PrimitiveDescs descs;
 
     descs.emplace_back(std::vector<PortConfigurator> { node->getOriginalInputsNumber(), { layout, precision } },
-                        std::vector<PortConfigurator> { { layout, precision } },
+                        std::vector<PortConfigurator> { { layout, outPrecision } },
                         mayiuse(cpu_isa_t::sse41)
                             ? impl_desc_type::jit_uni
                             : impl_desc_type::ref,
@@ -398,6 +654,12 @@ class JitConverter;
 
 template<typename T, size_t N>
 class JitConverter<T[N]> : public jit_uni_converter {
+public:
+    JitConverter() = default;
+    // The converter with the fused normalization
+    JitConverter(bool round, bool planar)
+        : _normalizing(true), _round(round), _planar(planar) {}
+
 private:
     void generate() override;
     std::tuple<variable<float[N]>,
@@ -408,10 +670,40 @@ private:
     std::tuple<variable<float[N]>,
                variable<float[N]>>
     unpack_uv(const variable<float[N]> & uv);
+
+    bool _normalizing = false;
+    bool _round = false;
+    bool _planar = false;
 };
 
 template<typename T, size_t N>
 void JitConverter<T[N]>::generate() {
+    if (_normalizing) {
+        generate_normalizing<T, N>(_round, _planar,
+            [&](const variable<const T*> & src_y,
+                const variable<const T*> & src_uv,
+                const variable<const T*> &) -> yuv_variables<N> {
+                return load_yuv(src_y, src_uv);
+            },
+            [&](const variable<const T*> & src_y,
+                const variable<const T*> & src_uv,
+                const variable<const T*> &,
+                const variable<size_t> & width) -> yuv_variables<N> {
+                auto y = var<float[N]>();
+                auto uv = var<float[N]>();
+
+                load(y, src_y, width);
+                load(uv, src_uv, width);
+
+                auto uv_pair = unpack_uv(uv);
+
+                return std::make_tuple(std::move(y),
+                                       std::move(std::get<0>(uv_pair)),
+                                       std::move(std::get<1>(uv_pair)));
+            });
+        return;
+    }
+
     preamble();
 
     // Get arguments addresses
@@ -541,6 +833,41 @@ const jit_uni_converter & jit_converter_get() {
     return jit_converter_create<T>();
 }
 
+template<typename T>
+const jit_uni_converter & jit_normalizing_converter_get(bool round, bool planar) {
+    auto createKernel = [](bool round, bool planar) {
+        std::unique_ptr<jit_uni_converter> kernel;
+
+        if (mayiuse(cpu_isa_t::avx512_core)) {
+            auto converter = new JitConverter<T[16]>(round, planar);
+            kernel.reset(converter);
+            converter->init();
+        } else if (mayiuse(cpu_isa_t::avx2)) {
+            auto converter = new JitConverter<T[8]>(round, planar);
+            kernel.reset(converter);
+            converter->init();
+        } else if (mayiuse(cpu_isa_t::sse41)) {
+            auto converter = new JitConverter<T[4]>(round, planar);
+            kernel.reset(converter);
+            converter->init();
+        } else {
+            IE_THROW() << "Can't create jit color converter kernel";
+        }
+
+        return kernel;
+    };
+
+    // indexed by round * 2 + planar
+    static const std::array<std::unique_ptr<jit_uni_converter>, 4> kernels = {
+        createKernel(false, false),
+        createKernel(false, true),
+        createKernel(true, false),
+        createKernel(true, true)
+    };
+
+    return *kernels[(round ? 2 : 0) + (planar ? 1 : 0)];
+}
+
 template<typename T>
 class SinglePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
 public:
@@ -611,6 +938,53 @@ public:
     }
 };
 
+template<typename T, impl_desc_type I>
+class NormalizingConvert : public NormalizingConverter {
+public:
+    NormalizingConvert(Node *node)
+        : NormalizingConverter(node) {
+        if (node->getOriginalInputsNumber() != (singlePlane() ? 1: 2))
+            IE_THROW() <<"NV12Converter node has incorrect number of inputs";
+        if (I == impl_desc_type::jit_uni)
+            jit_normalizing_converter_get<T>(_round, _planar);
+    }
+
+    void execute(dnnl::stream strm) override {
+        const auto & dims = inputDims(0);
+
+        const size_t batch_size = dims[N_DIM];
+        const size_t height = singlePlane() ? dims[H_DIM] * 2 / 3 : dims[H_DIM];
+        const size_t width = dims[W_DIM];
+
+        const T* y = static_cast<const T*>(input(0));
+        const T* uv = singlePlane() ? y + width * height : static_cast<const T*>(input(1));
+
+        const size_t stride_y = singlePlane() ? height * width * 3 / 2 : height * width;
+        const size_t stride_uv = singlePlane() ? height * width * 3 / 2 : height * width / 2;
+
+        InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
+            const T* y_row = y + batch * stride_y + h * width;
+            const T* uv_row = uv + batch * stride_uv + (h / 2) * width;
+            const auto dst = outputRow(batch, h, height, width);
+
+            if (I == impl_desc_type::jit_uni) {
+                typename jit_uni_converter::Params args;
+                args.y = y_row;
+                args.u = args.v = uv_row;
+                args.dst = _planar ? dst.r : dst.begin;
+                args.dst_g = dst.g;
+                args.dst_b = dst.b;
+                args.width = width;
+                args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
+                args.normalization = _normalization.data();
+                jit_normalizing_converter_get<T>(_round, _planar)(args);
+            } else {
+                convertRow(y_row, uv_row, uv_row + 1, 2, dst, width);
+            }
+        });
+    }
+};
+
 }   // namespace nv12
 
 namespace i420 {
@@ -621,11 +995,15 @@ ColorConvert::Converter::PrimitiveDescs supportedPrimitiveDescs(Node *node) {
     const Precision precision = node->getOriginalInputPrecisionAtPort(0) == Precision::U8
                                     ? Precision::U8
                                     : Precision::FP32;
+    // f32 if the normalization is fused
+    const Precision outPrecision = node->getOriginalOutputPrecisionAtPort(0) == Precision::U8
+                                    ? Precision::U8
+                                    : Precision::FP32;
 
     ColorConvert::Converter::PrimitiveDescs descs;
 
     descs.emplace_back(std::vector<PortConfigurator> { node->getOriginalInputsNumber(), { layout, precision } },
-                        std::vector<PortConfigurator> { { layout, precision } },
+                        std::vector<PortConfigurator> { { layout, outPrecision } },
                         mayiuse(cpu_isa_t::sse41)
                             ? impl_desc_type::jit_uni
                             : impl_desc_type::ref,
@@ -752,6 +1130,12 @@ class JitConverter;
 
 template<typename T, size_t N>
 class JitConverter<T[N]> : public jit_uni_converter {
+public:
+    JitConverter() = default;
+    // The converter with the fused normalization
+    JitConverter(bool round, bool planar)
+        : _normalizing(true), _round(round), _planar(planar) {}
+
 private:
     void generate() override;
     std::tuple<variable<float[N]>,
@@ -762,10 +1146,42 @@ private:
              const variable<const T *> & src_v);
     void unpack_uv(const variable<float[N]> & u,
                    const variable<float[N]> & v);
+
+    bool _normalizing = false;
+    bool _round = false;
+    bool _planar = false;
 };
 
 template<typename T, size_t N>
 void JitConverter<T[N]>::generate() {
+    if (_normalizing) {
+        generate_normalizing<T, N>(_round, _planar,
+            [&](const variable<const T*> & src_y,
+                const variable<const T*> & src_u,
+                const variable<const T*> & src_v) -> yuv_variables<N> {
+                return load_yuv(src_y, src_u, src_v);
+            },
+            [&](const variable<const T*> & src_y,
+                const variable<const T*> & src_u,
+                const variable<const T*> & src_v,
+                const variable<size_t> & width) -> yuv_variables<N> {
+                auto y = var<float[N]>();
+                auto u = var<float[N]>();
+                auto v = var<float[N]>();
+
+                auto uv_width = width >> 1;
+
+                load(y, src_y, width);
+                load(u, src_u, uv_width);
+                load(v, src_v, uv_width);
+
+                unpack_uv(u, v);
+
+                return std::make_tuple(std::move(y), std::move(u), std::move(v));
+            });
+        return;
+    }
+
     preamble();
 
     // Get arguments addresses
@@ -890,6 +1306,41 @@ const jit_uni_converter & jit_converter_get() {
     return jit_converter_create<T>();
 }
 
+template<typename T>
+const jit_uni_converter & jit_normalizing_converter_get(bool round, bool planar) {
+    auto createKernel = [](bool round, bool planar) {
+        std::unique_ptr<jit_uni_converter> kernel;
+
+        if (mayiuse(cpu_isa_t::avx512_core)) {
+            auto converter = new JitConverter<T[16]>(round, planar);
+            kernel.reset(converter);
+            converter->init();
+        } else if (mayiuse(cpu_isa_t::avx2)) {
+            auto converter = new JitConverter<T[8]>(round, planar);
+            kernel.reset(converter);
+            converter->init();
+        } else if (mayiuse(cpu_isa_t::sse41)) {
+            auto converter = new JitConverter<T[4]>(round, planar);
+            kernel.reset(converter);
+            converter->init();
+        } else {
+            IE_THROW() << "Can't create jit color converter kernel";
+        }
+
+        return kernel;
+    };
+
+    // indexed by round * 2 + planar
+    static const std::array<std::unique_ptr<jit_uni_converter>, 4> kernels = {
+        createKernel(false, false),
+        createKernel(false, true),
+        createKernel(true, false),
+        createKernel(true, true)
+    };
+
+    return *kernels[(round ? 2 : 0) + (planar ? 1 : 0)];
+}
+
 template<typename T>
 class SinglePlaneConvert<T, impl_desc_type::jit_uni> : public Converter {
 public:
@@ -964,24 +1415,75 @@ public:
     }
 };
 
+template<typename T, impl_desc_type I>
+class NormalizingConvert : public NormalizingConverter {
+public:
+    NormalizingConvert(Node *node)
+        : NormalizingConverter(node) {
+        if (node->getOriginalInputsNumber() != (singlePlane() ? 1: 3))
+            IE_THROW() <<"I420Converter node has incorrect number of inputs";
+        if (I == impl_desc_type::jit_uni)
+            jit_normalizing_converter_get<T>(_round, _planar);
+    }
+
+    void execute(dnnl::stream strm) override {
+        const auto & dims = inputDims(0);
+
+        const size_t batch_size = dims[N_DIM];
+        const size_t height = singlePlane() ? dims[H_DIM] * 2 / 3 : dims[H_DIM];
+        const size_t width = dims[W_DIM];
+
+        const T* y = static_cast<const T*>(input(0));
+        const T* u = singlePlane() ? y + width * height : static_cast<const T*>(input(1));
+        const T* v = singlePlane() ? y + 5 * width * height / 4 : static_cast<const T*>(input(2));
+
+        const size_t stride_y = singlePlane() ? height * width * 3 / 2 : height * width;
+        const size_t stride_uv = singlePlane() ? height * width * 3 / 2 : height * width / 4;
+
+        InferenceEngine::parallel_for2d(batch_size, height, [&](int batch, int h) {
+            const T* y_row = y + batch * stride_y + h * width;
+            const T* u_row = u + batch * stride_uv + (h / 2) * (width / 2);
+            const T* v_row = v + batch * stride_uv + (h / 2) * (width / 2);
+            const auto dst = outputRow(batch, h, height, width);
+
+            if (I == impl_desc_type::jit_uni) {
+                typename jit_uni_converter::Params args;
+                args.y = y_row;
+                args.u = u_row;
+                args.v = v_row;
+                args.dst = _planar ? dst.r : dst.begin;
+                args.dst_g = dst.g;
+                args.dst_b = dst.b;
+                args.width = width;
+                args.colorFormat = _colorFormat[0]; // The first byte is enough to determine the RGB or BGR format.
+                args.normalization = _normalization.data();
+                jit_normalizing_converter_get<T>(_round, _planar)(args);
+            } else {
+                convertRow(y_row, u_row, v_row, 1, dst, width);
+            }
+        });
+    }
+};
+
 }   // namespace i420
 
 /**
  * Implements Color Convert shape inference algorithm. Depending on wether it has only single plain H dimension is
- * passed through or recalculated as 2/3 of the initial size.
+ * passed through or recalculated as 2/3 of the initial size. The output is NCHW if the fused normalization is planar.
  * 
  */
 class ColorConvertShapeInfer : public ShapeInferEmptyPads {
 public:
-    ColorConvertShapeInfer(bool singlePlain) : m_singlePlain(singlePlain) {}
+    ColorConvertShapeInfer(bool singlePlain, bool planar) : m_singlePlain(singlePlain), m_planar(planar) {}
     Result infer(const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
                            const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
         const auto& dims = input_shapes.front().get();
         if (dims.size() != 4)
             IE_THROW() <<"NV12Converter node has incorrect input dimensions";
-        return { m_singlePlain
-                    ? std::vector<VectorDims>{ { dims[Converter::N_DIM], dims[Converter::H_DIM] * 2 / 3, dims[Converter::W_DIM], 3 } }
-                    : std::vector<VectorDims>{ { dims[Converter::N_DIM], dims[Converter::H_DIM], dims[Converter::W_DIM], 3 } },
+        const auto height = m_singlePlain ? dims[Converter::H_DIM] * 2 / 3 : dims[Converter::H_DIM];
+        return { m_planar
+                    ? std::vector<VectorDims>{ { dims[Converter::N_DIM], 3, height, dims[Converter::W_DIM] } }
+                    : std::vector<VectorDims>{ { dims[Converter::N_DIM], height, dims[Converter::W_DIM], 3 } },
                     ShapeInferStatus::success };
     }
 
@@ -991,6 +1493,7 @@ public:
 
 private:
     bool m_singlePlain = false;
+    bool m_planar = false;
 };
 
 class ColorConvertShapeInferFactory : public ShapeInferFactory {
@@ -998,7 +1501,8 @@ public:
     ColorConvertShapeInferFactory(std::shared_ptr<ov::Node> op) : m_op(op) {}
     ShapeInferPtr makeShapeInfer() const override {
         bool isSinglePlain = m_op->get_input_size() == 1;
-        return std::make_shared<ColorConvertShapeInfer>(isSinglePlain);
+        const auto normalize = ov::as_type_ptr<ov::intel_cpu::ColorConvertNormalizeNode>(m_op);
+        return std::make_shared<ColorConvertShapeInfer>(isSinglePlain, normalize && normalize->get_planar());
     }
 
 private:
@@ -1044,6 +1548,13 @@ ColorConvert::ColorConvert(const std::shared_ptr<ngraph::Node>& op, const GraphC
     std::tie(algorithm, errorMessage) = getAlgorithmFor(op);
     if (algorithm == Algorithm::Default)
         IE_THROW(NotImplemented) << errorMessage;
+
+    if (const auto normalize = ov::as_type_ptr<ov::intel_cpu::ColorConvertNormalizeNode>(op)) {
+        _normalization.reset(new Normalization{ normalize->get_mean(),
+                                                normalize->get_scale(),
+                                                normalize->get_round(),
+                                                normalize->get_planar() });
+    }
 }
 
 void ColorConvert::getSupportedDescriptors() {}
@@ -1088,6 +1599,18 @@ void ColorConvert::initSupportedNV12Impls() {
             return new nv12::Impl<type, impl_desc_type::desc_type>(node);   \
         };
 
+    // the fused normalization, the converter supports both single and multiple planes
+    if (_normalization) {
+        auto &refImpls = _supportedImpls[impl_desc_type::ref][algorithm];
+        refImpls[Precision::U8][true] = refImpls[Precision::U8][false] = SUPPORTED_IMPL(NormalizingConvert, uint8_t, ref);
+        refImpls[Precision::FP32][true] = refImpls[Precision::FP32][false] = SUPPORTED_IMPL(NormalizingConvert, float, ref);
+
+        auto &jitImpls = _supportedImpls[impl_desc_type::jit_uni][algorithm];
+        jitImpls[Precision::U8][true] = jitImpls[Precision::U8][false] = SUPPORTED_IMPL(NormalizingConvert, uint8_t, jit_uni);
+        jitImpls[Precision::FP32][true] = jitImpls[Precision::FP32][false] = SUPPORTED_IMPL(NormalizingConvert, float, jit_uni);
+        return;
+    }
+
     // ref
     {
         auto &impls = _supportedImpls[impl_desc_type::ref][algorithm];
@@ -1115,6 +1638,18 @@ void ColorConvert::initSupportedI420Impls() {
             return new i420::Impl<type, impl_desc_type::desc_type>(node);   \
         };
 
+    // the fused normalization, the converter supports both single and multiple planes
+    if (_normalization) {
+        auto &refImpls = _supportedImpls[impl_desc_type::ref][algorithm];
+        refImpls[Precision::U8][true] = refImpls[Precision::U8][false] = SUPPORTED_IMPL(NormalizingConvert, uint8_t, ref);
+        refImpls[Precision::FP32][true] = refImpls[Precision::FP32][false] = SUPPORTED_IMPL(NormalizingConvert, float, ref);
+
+        auto &jitImpls = _supportedImpls[impl_desc_type::jit_uni][algorithm];
+        jitImpls[Precision::U8][true] = jitImpls[Precision::U8][false] = SUPPORTED_IMPL(NormalizingConvert, uint8_t, jit_uni);
+        jitImpls[Precision::FP32][true] = jitImpls[Precision::FP32][false] = SUPPORTED_IMPL(NormalizingConvert, float, jit_uni);
+        return;
+    }
+
     // ref
     {
         auto &impls = _supportedImpls[impl_desc_type::ref][algorithm];
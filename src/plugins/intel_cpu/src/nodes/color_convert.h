@@ -9,6 +9,8 @@
 #include <functional>
 #include <tuple>
 #include <array>
+#include <memory>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
@@ -19,6 +21,20 @@ public:
     ColorConvert(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context);
     class Converter;
 
+    /**
+     * The preprocessing fused into the color conversion: (rgb - mean) * scale with f32 output
+     */
+    struct Normalization {
+        std::vector<float> mean;    // per output channel
+        std::vector<float> scale;   // per output channel
+        bool round;                 // round the converted colors as the conversion of the integer image does
+        bool planar;                // NCHW output instead of NHWC
+    };
+
+    const Normalization * getNormalization() const {
+        return _normalization.get();
+    }
+
 public:
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
@@ -44,6 +60,7 @@ private:
 
     std::unique_ptr<Converter> _impl;
     SupportedImpls _supportedImpls;
+    std::unique_ptr<const Normalization> _normalization;
 };
 
 class ColorConvert::Converter {
@@ -27,6 +27,9 @@ public:
     void executeDynamicImpl(dnnl::stream strm) override { execute(strm); }
 
     bool isOptimized() const;
+    size_t getAxis() const {
+        return axis;
+    }
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
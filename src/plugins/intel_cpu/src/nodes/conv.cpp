@@ -705,6 +705,7 @@ void Convolution::initSupportedPrimitiveDescriptors() {
 
     SetPostOpsAndZeroPoints(attrs);
     bool containJitImpl = false;
+    onlyExportedImpl = exportedImplType != impl_desc_type::unknown;
 
     for (auto& desc : descs) {
         if (containJitImpl && isPossibleToSkipInitConfig(desc))
@@ -713,6 +714,15 @@ void Convolution::initSupportedPrimitiveDescriptors() {
             auto &attr = attrs[i];
             auto itpd = desc.createPrimitiveDescriptorIterator(getEngine(), attr);
             while (static_cast<bool>(itpd)) {
+                impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
+                if (impl_type & jit)
+                    containJitImpl = true;
+                if (isSkippedOnImport(impl_type)) {
+                    if (!itpd.next_impl())
+                        break;
+                    continue;
+                }
+
                 NodeConfig config;
                 config.dynBatchSupport = true;
                 for (size_t i = 0; i < descInputNumbers(desc); i++) {
@@ -768,16 +778,19 @@ void Convolution::initSupportedPrimitiveDescriptors() {
                         config.inConfs.push_back(dataConfig);
                     }
                 }
-                impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
-                if (impl_type & jit)
-                    containJitImpl = true;
-
                 supportedPrimitiveDescriptors.emplace_back(config, impl_type);
-                if (!itpd.next_impl())
+                // the implementations of lower priority aren't selected anyway
+                if (onlyExportedImpl || !itpd.next_impl())
                     break;
             }
         }
     }
+
+    if (onlyExportedImpl && supportedPrimitiveDescriptors.empty()) {
+        // the exported implementation isn't available, fall back to the regular selection
+        exportedImplType = impl_desc_type::unknown;
+        initSupportedPrimitiveDescriptors();
+    }
 }
 
 bool Convolution::created() const {
@@ -978,6 +991,15 @@ void Convolution::initDescriptor(const NodeConfig& config) {
             auto &attr = attrs[n];
             auto itpd = desc.createPrimitiveDescriptorIterator(getEngine(), attr);
             while (static_cast<bool>(itpd)) {
+                impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
+                if (impl_type & jit)
+                    containJitImpl = true;
+                if (isSkippedOnImport(impl_type)) {
+                    if (!itpd.next_impl())
+                        break;
+                    continue;
+                }
+
                 NodeConfig cfg;
                 cfg.dynBatchSupport = true;
                 for (size_t j = 0; j < descInputNumbers(desc); j++) {
@@ -1019,9 +1041,6 @@ void Convolution::initDescriptor(const NodeConfig& config) {
 
                     cfg.outConfs.push_back(dataConfig);
                 }
-                impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
-                if (impl_type & jit)
-                    containJitImpl = true;
 
                 if (selected_count == selectedPrimitiveDescriptorIndex) {
                     if (impl_type != selectedPD->getImplementationType()) {
@@ -1043,7 +1062,7 @@ void Convolution::initDescriptor(const NodeConfig& config) {
                     }
                 }
                 selected_count++;
-                if (!itpd.next_impl())
+                if (onlyExportedImpl || !itpd.next_impl())
                     break;
             }
         }
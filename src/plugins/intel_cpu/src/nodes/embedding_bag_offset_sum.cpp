@@ -51,8 +51,13 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
             {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
+    auto tablePrecision = inDataPrecision;
+    if (inDataPrecision == Precision::BF16) {
         inDataPrecision = Precision::FP32;
+        // the constant table is converted once and read by the jit kernels in BF16, the output stays FP32
+        if (!mayiuse(cpu::x64::avx2) || !getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getParent()->isConstant())
+            tablePrecision = Precision::FP32;
+    }
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -63,7 +68,7 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
     }
 
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, tablePrecision},
                                                        {LayoutType::ncsp, Precision::I32},
                                                        {LayoutType::ncsp, Precision::I32}});
     if (inputShapes.size() > DEFAULT_INDEX_IDX)
@@ -77,7 +82,8 @@ void EmbeddingBagOffsetSum::initSupportedPrimitiveDescriptors() {
 void EmbeddingBagOffsetSum::prepareParams() {
     _indicesLen = getParentEdgesAtPort(INDICES_IDX)[0]->getMemory().getStaticDims()[0];
     _offsetsLen = getParentEdgesAtPort(OFFSETS_IDX)[0]->getMemory().getStaticDims()[0];
-    EmbeddingBagSum::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory().getStaticDims());
+    const auto& tableMemory = getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory();
+    EmbeddingBagSum::prepareParams(tableMemory.getStaticDims(), tableMemory.getDesc().getPrecision());
 }
 
 void EmbeddingBagOffsetSum::initFromInputs() {
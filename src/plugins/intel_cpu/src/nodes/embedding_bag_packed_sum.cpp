@@ -48,8 +48,13 @@ void EmbeddingBagPackedSum::initSupportedPrimitiveDescriptors() {
             {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
+    auto tablePrecision = inDataPrecision;
+    if (inDataPrecision == Precision::BF16) {
         inDataPrecision = Precision::FP32;
+        // the constant table is converted once and read by the jit kernels in BF16, the output stays FP32
+        if (!mayiuse(cpu::x64::avx2) || !getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getParent()->isConstant())
+            tablePrecision = Precision::FP32;
+    }
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -60,7 +65,7 @@ void EmbeddingBagPackedSum::initSupportedPrimitiveDescriptors() {
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
     }
 
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, tablePrecision},
                                                        {LayoutType::ncsp, Precision::I32}});
     if (inputShapes.size() > PER_SAMPLE_WEIGHTS_IDX)
         inDataConfigurators.push_back({LayoutType::ncsp, inDataPrecision});
@@ -71,7 +76,8 @@ void EmbeddingBagPackedSum::initSupportedPrimitiveDescriptors() {
 void EmbeddingBagPackedSum::prepareParams() {
     _batch = getParentEdgesAtPort(INDICES_IDX)[0]->getMemory().getStaticDims()[0];
     _indicesPerBag = getParentEdgesAtPort(INDICES_IDX)[0]->getMemory().getStaticDims()[1];
-    EmbeddingBagSum::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory().getStaticDims());
+    const auto& tableMemory = getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory();
+    EmbeddingBagSum::prepareParams(tableMemory.getStaticDims(), tableMemory.getDesc().getPrecision());
 }
 
 void EmbeddingBagPackedSum::initFromInputs() {
@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <numeric>
 #include <vector>
 #include <string>
 #include <dnnl_types.h>
@@ -10,6 +13,7 @@
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
 
 using namespace InferenceEngine;
 
@@ -39,92 +43,207 @@ EmbeddingBagSum::EmbeddingBagSum(
     }
 }
 
-void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
+void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape, const Precision& tablePrecision) {
     _embDepth = 1lu;
     for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+    if (!one_of(tablePrecision, Precision::FP32, Precision::BF16) || !mayiuse(cpu::x64::avx2)) {
+        _kernel.reset();
+        _kernelWithWeights.reset();
+        return;
+    }
+
+    const size_t simdW = mayiuse(cpu::x64::avx512_core) ? jit_emb_bag_kernel_f32<cpu::x64::avx512_core>::simd_w
+                                                        : jit_emb_bag_kernel_f32<cpu::x64::avx2>::simd_w;
+    jit_emb_bag_params jcp = {};
+    jcp.embDepth = _embDepth / simdW * simdW;
+    jcp.rowStride = _embDepth * tablePrecision.size();
+    jcp.bf16Table = tablePrecision == Precision::BF16;
+    jcp.prefetchDistance = prefetchDistance;
+    if (jcp.embDepth == 0 || jcp.rowStride > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        _kernel.reset();
+        _kernelWithWeights.reset();
+        return;
+    }
+    if (_kernel && _kernel->jcp_.embDepth == jcp.embDepth && _kernel->jcp_.rowStride == jcp.rowStride &&
+        _kernel->jcp_.bf16Table == jcp.bf16Table)
+        return;
+
+    auto createKernel = [](const jit_emb_bag_params& jcp) {
+        std::shared_ptr<jit_emb_bag_kernel> kernel;
+        if (mayiuse(cpu::x64::avx512_core)) {
+            kernel.reset(new jit_emb_bag_kernel_f32<cpu::x64::avx512_core>(jcp));
+        } else {
+            kernel.reset(new jit_emb_bag_kernel_f32<cpu::x64::avx2>(jcp));
+        }
+        kernel->create_ker();
+        return kernel;
+    };
+
+    jcp.withWeights = false;
+    _kernel = createKernel(jcp);
+    if (_withWeights) {
+        jcp.withWeights = true;
+        _kernelWithWeights = createKernel(jcp);
+    }
+}
+
+template<typename F>
+void EmbeddingBagSum::parallelForBags(size_t outputBagsNum, size_t tableRows, const F& func) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    // the sizes of the bags are skewed in practice, so the bags are split between the threads by the number
+    // of the rows to accumulate, an empty bag still costs the write of the output row
+    _bags.resize(outputBagsNum);
+    _bagsWork.resize(outputBagsNum + 1);
+    _bagsWork[0] = 0lu;
+    parallel_for(outputBagsNum, [&](size_t obi) {
+        Bag& bag = _bags[obi];
+        bag.indices = nullptr;
+        bag.size = 0lu;
+        bag.weightsIdx = 0;
+        bag.withWeights = _withWeights;
+        getIndices(static_cast<int>(obi), bag.indices, bag.size, bag.weightsIdx, bag.withWeights);
+        bag.withWeights = bag.withWeights && _withWeights;
+
+        if (bag.indices != nullptr) {
+            for (size_t i = 0lu; i < bag.size; i++) {
+                if (static_cast<size_t>(bag.indices[i]) >= tableRows) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(bag.indices[i]);
+                }
+            }
+        }
+        _bagsWork[obi + 1] = bag.indices != nullptr ? std::max(bag.size, size_t(1)) : 1lu;
+    });
+    std::partial_sum(_bagsWork.begin(), _bagsWork.end(), _bagsWork.begin());
+
+    const size_t totalWork = _bagsWork.back();
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t workStart(0lu), workEnd(0lu);
+        splitter(totalWork, nthr, ithr, workStart, workEnd);
+        if (workStart >= workEnd)
+            return;
+
+        // the bag belongs to the thread which owns its first row
+        const auto bagsEnd = _bagsWork.end() - 1;
+        const size_t start = std::lower_bound(_bagsWork.begin(), bagsEnd, workStart) - _bagsWork.begin();
+        const size_t end = std::lower_bound(_bagsWork.begin(), bagsEnd, workEnd) - _bagsWork.begin();
+        for (size_t obi = start; obi < end; obi++) {
+            func(obi, _bags[obi]);
+        }
+    });
 }
 
 template<typename T>
 void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                                   const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
-    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
-
     initFromInputs();
 
     const size_t outputBagsNum = outMemory->GetShape().getStaticDims()[0];
     auto *dstData = reinterpret_cast<T *>(outMemory->GetPtr());
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
-        if (start >= end)
-            return;
+    parallelForBags(outputBagsNum, inDataDims[0], [&](size_t obi, const Bag& bag) {
+        size_t dstIndex = obi * _embDepth;
 
-        size_t indicesSize = 0lu;
-        const int* indices = nullptr;
-        int weightsIdx = 0lu;
-        bool withWeights = _withWeights;
+        if (bag.indices != nullptr) {
+            int weightsIdx = bag.weightsIdx;
 
-        for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
-
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
-
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0]) {
-                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+            size_t srcIndex = bag.indices[0] * _embDepth;
+            if (bag.withWeights) {
+                for (size_t i = 0lu; i < _embDepth; i++) {
+                    dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
                 }
-                size_t srcIndex = indices[inIdx] * _embDepth;
+                weightsIdx++;
+            } else {
+                for (size_t i = 0lu; i < _embDepth; i++) {
+                    dstData[dstIndex + i] = srcData[srcIndex + i];
+                }
+            }
 
-                if (withWeights) {
+            for (size_t inIdx = 1lu; inIdx < bag.size; inIdx++) {
+                size_t srcIndex = bag.indices[inIdx] * _embDepth;
+
+                if (bag.withWeights) {
                     for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
+                        dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
                     }
                     weightsIdx++;
                 } else {
                     for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
+                        dstData[dstIndex + i] += srcData[srcIndex + i];
                     }
                 }
-
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
-                }
-            } else {
-                for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
-                }
+            }
+        } else {
+            for (size_t i = 0lu; i < _embDepth; i++) {
+                dstData[dstIndex + i] = 0;
             }
         }
-    };
+    });
+}
 
-    parallel_nt(0, threadBody);
+template<typename T>
+static void accumulateRowsRef(const uint8_t* srcData, const int* indices, size_t size, const float* weights,
+                              size_t rowLen, size_t start, size_t end, float* dst) {
+    for (size_t i = start; i < end; i++)
+        dst[i] = 0.f;
+    for (size_t inIdx = 0lu; inIdx < size; inIdx++) {
+        const T* row = reinterpret_cast<const T*>(srcData) + indices[inIdx] * rowLen;
+        const float weight = weights ? weights[inIdx] : 1.f;
+        for (size_t i = start; i < end; i++) {
+            dst[i] += static_cast<float>(row[i]) * weight;
+        }
+    }
+}
+
+void EmbeddingBagSum::processFloatData(const uint8_t* srcData, const float* weightsData, const Precision& srcPrc,
+                                       const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
+    initFromInputs();
+
+    const size_t outputBagsNum = outMemory->GetShape().getStaticDims()[0];
+    auto *dstData = reinterpret_cast<float *>(outMemory->GetPtr());
+    const bool bf16Table = srcPrc == Precision::BF16;
+    // the end of the row which is shorter than the vector is accumulated by the reference code
+    const size_t tailStart = _kernel ? _kernel->jcp_.embDepth : 0lu;
+
+    parallelForBags(outputBagsNum, inDataDims[0], [&](size_t obi, const Bag& bag) {
+        float* dst = dstData + obi * _embDepth;
+
+        if (bag.indices == nullptr) {
+            std::fill(dst, dst + _embDepth, 0.f);
+            return;
+        }
+
+        const float* weights = bag.withWeights ? weightsData + bag.weightsIdx : nullptr;
+        if (_kernel) {
+            jit_emb_bag_args args;
+            args.src = srcData;
+            args.indices = bag.indices;
+            args.weights = weights;
+            args.size = bag.size;
+            args.dst = dst;
+            if (bag.withWeights)
+                (*_kernelWithWeights)(&args);
+            else
+                (*_kernel)(&args);
+        }
+        if (tailStart < _embDepth) {
+            if (bf16Table)
+                accumulateRowsRef<bfloat16_t>(srcData, bag.indices, bag.size, weights, _embDepth, tailStart, _embDepth, dst);
+            else
+                accumulateRowsRef<float>(srcData, bag.indices, bag.size, weights, _embDepth, tailStart, _embDepth, dst);
+        }
+    });
 }
 
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision &srcPrc,
                               const InferenceEngine::SizeVector& inDims, const MemoryPtr& outMemory) {
     switch (srcPrc) {
-        case Precision::FP32: {
-            return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
-                    reinterpret_cast<const float*>(weightsData), inDims, outMemory);
+        case Precision::FP32:
+        case Precision::BF16: {
+            return processFloatData(srcData, reinterpret_cast<const float*>(weightsData), srcPrc, inDims, outMemory);
         }
         case Precision::I8: {
             return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <node.h>
+#include "kernels/embedding_bag_kernel.hpp"
 #include <string>
 #include <memory>
 #include <vector>
@@ -37,20 +38,40 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& tablePrecision);
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData,
                      const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
+    // FP32 and BF16 tables with the FP32 output, the rows are accumulated by the jit kernels when they are available
+    void processFloatData(const uint8_t* srcData, const float* weightsData, const InferenceEngine::Precision& srcPrc,
+                          const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
+
+    struct Bag {
+        const int* indices;
+        size_t size;
+        int weightsIdx;
+        bool withWeights;
+    };
+    // Calls func(bagIdx, bag) for all the output bags, the threads get the bags with equal total number of indices
+    template<typename F>
+    void parallelForBags(size_t outputBagsNum, size_t tableRows, const F& func);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
     const size_t PER_SAMPLE_WEIGHTS_IDX;
     const size_t DEFAULT_INDEX_IDX;
+    // in indices of the bag
+    static constexpr size_t prefetchDistance = 8lu;
 
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::vector<Bag> _bags;
+    std::vector<size_t> _bagsWork;
+    std::shared_ptr<jit_emb_bag_kernel> _kernel;
+    std::shared_ptr<jit_emb_bag_kernel> _kernelWithWeights;
 };
 
 }   // namespace node
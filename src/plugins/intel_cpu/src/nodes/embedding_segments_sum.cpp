@@ -54,8 +54,13 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
             {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
+    auto tablePrecision = inDataPrecision;
+    if (inDataPrecision == Precision::BF16) {
         inDataPrecision = Precision::FP32;
+        // the constant table is converted once and read by the jit kernels in BF16, the output stays FP32
+        if (!mayiuse(cpu::x64::avx2) || !getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getParent()->isConstant())
+            tablePrecision = Precision::FP32;
+    }
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -66,7 +71,7 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
     }
 
-    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, inDataPrecision},
+    std::vector<PortConfigurator> inDataConfigurators({{LayoutType::ncsp, tablePrecision},
                                                        {LayoutType::ncsp, Precision::I32},
                                                        {LayoutType::ncsp, Precision::I32},
                                                        {LayoutType::ncsp, Precision::I32}});
@@ -79,7 +84,8 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
 }
 
 void EmbeddingSegmentsSum::prepareParams() {
-    EmbeddingBagSum::prepareParams(getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory().getStaticDims());
+    const auto& tableMemory = getParentEdgesAtPort(EMB_TABLE_IDX)[0]->getMemory();
+    EmbeddingBagSum::prepareParams(tableMemory.getStaticDims(), tableMemory.getDesc().getPrecision());
 }
 
 void EmbeddingSegmentsSum::initFromInputs() {
@@ -92,6 +98,17 @@ void EmbeddingSegmentsSum::initFromInputs() {
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = reinterpret_cast<const int *>(getParentEdgeAt(DEFAULT_INDEX_IDX)->getMemoryPtr()->GetPtr());
     }
+
+    // the segments are found in one pass here instead of the scan over all the segment ids for every bag
+    segmentStarts_.assign(lastNumSegments_, 0lu);
+    segmentSizes_.assign(lastNumSegments_, 0lu);
+    for (size_t si = 0; si < indicesSize_; si++) {
+        const int segmentId = segmentIds_[si];
+        if (segmentId < 0 || segmentId >= lastNumSegments_)
+            continue;
+        if (segmentSizes_[segmentId]++ == 0)
+            segmentStarts_[segmentId] = si;
+    }
 }
 
 void EmbeddingSegmentsSum::getIndices(int embIndex, const int*& indices, size_t& size, int& weightsIdx, bool& withWeight) {
@@ -99,19 +116,9 @@ void EmbeddingSegmentsSum::getIndices(int embIndex, const int*& indices, size_t&
         IE_THROW() << "Invalid embedding bag index.";
 
     indices = nullptr;
-    size = 0;
+    size = segmentSizes_[embIndex];
     withWeight = true;
 
-    for (int si = 0; si < indicesSize_; si++) {
-        if (segmentIds_[si] == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
-    }
-
     // Empty bag
     if (size == 0) {
         size = 1lu;
@@ -120,6 +127,9 @@ void EmbeddingSegmentsSum::getIndices(int embIndex, const int*& indices, size_t&
             indices = defaultIndices_;
         return;
     }
+
+    indices = indices_ + segmentStarts_[embIndex];
+    weightsIdx = static_cast<int>(segmentStarts_[embIndex]);
 }
 
 int32_t EmbeddingSegmentsSum::getNumSegments() const {
@@ -47,6 +47,9 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+    // the first index and the number of indices of every segment
+    std::vector<size_t> segmentStarts_;
+    std::vector<size_t> segmentSizes_;
 };
 
 }   // namespace node
@@ -8,6 +8,7 @@
 #include "fake_quantize.h"
 #include "input.h"
 #include "reorder.h"
+#include "common/cpu_memcpy.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <string>
@@ -24,6 +25,9 @@
 #include <common/primitive_desc_iface.hpp>
 #include "onednn/dnnl.h"
 #include "cpu/x64/cpu_isa_traits.hpp"
+#include "ie_parallel.hpp"
+#include <algorithm>
+#include <numeric>
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -130,6 +134,46 @@ private:
     std::shared_ptr<const ngraph::Node> m_op;
 };
 
+// jit_fc_decompression_kernel decompresses all the weights for every maxRows rows of the activations, so starting from
+// this number of rows every thread decompresses its output channels once into a small buffer and multiplies them by sgemm
+constexpr size_t decompressedWeightsMinRows = 16;
+// output channels decompressed by a thread at once, the f32 buffer is [IC, decompressedChunk]
+constexpr size_t decompressedChunk = 64;
+
+// weight of the output channel oc of the [IC, block] block of the packed weights
+inline float unpackWeight(const uint8_t* weights, size_t ic, size_t oc, size_t block, size_t bits, bool signedWeights) {
+    if (bits == 8) {
+        const auto w = weights[ic * block + oc];
+        return signedWeights ? static_cast<float>(static_cast<int8_t>(w)) : static_cast<float>(w);
+    }
+    const size_t half = block / 2;
+    const auto byte = weights[ic * half + oc % half];
+    const int w = oc < half ? byte & 0xF : byte >> 4;
+    return static_cast<float>(signedWeights ? (w ^ 8) - 8 : w);
+}
+
+// reference implementation of jit_fc_decompression_kernel over the same packed weights
+void fcDecompressionRef(const jit_fc_decompression_params& jcp, const jit_fc_decompression_args& args, size_t block) {
+    const size_t groups = jcp.IC / jcp.groupSize;
+    for (size_t r = 0; r < jcp.rows; r++) {
+        auto src = reinterpret_cast<const float*>(reinterpret_cast<const uint8_t*>(args.src) + r * args.src_stride);
+        auto dst = reinterpret_cast<float*>(reinterpret_cast<uint8_t*>(args.dst) + r * args.dst_stride);
+        for (size_t oc = 0; oc < block; oc++) {
+            float acc = jcp.withBias ? args.bias[oc] : 0.f;
+            for (size_t g = 0; g < groups; g++) {
+                const float zeroPoint = jcp.withZeroPoints ? args.zero_points[g * block + oc] : 0.f;
+                float partial = 0.f;
+                for (size_t ic = g * jcp.groupSize; ic < (g + 1) * jcp.groupSize; ic++) {
+                    const float weight = unpackWeight(args.weights, ic, oc, block, jcp.weightsBits, jcp.signedWeights);
+                    partial += (weight - zeroPoint) * src[ic];
+                }
+                acc += partial * args.scales[g * block + oc];
+            }
+            dst[oc] = acc;
+        }
+    }
+}
+
 } // namespace
 
 bool FullyConnected::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
@@ -224,6 +268,10 @@ void FullyConnected::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    // the compressed weights are handled by jit_fc_decompression_kernel, not by oneDNN
+    if (useWeightsDecompression())
+        return;
+
     useSparseWeights = useSparseWeightsDecompression();
 
     auto inputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
@@ -266,6 +314,10 @@ void FullyConnected::getSupportedDescriptors() {
 }
 
 void FullyConnected::createPrimitive() {
+    if (useWeightsDecompression()) {
+        Node::createPrimitive();
+        return;
+    }
     setPostOps(attr, outDims);
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     Node::createPrimitive();
@@ -273,6 +325,10 @@ void FullyConnected::createPrimitive() {
 }
 
 void FullyConnected::prepareParams() {
+    if (useWeightsDecompression()) {
+        prepareWeightsDecompression();
+        return;
+    }
     auto srcMemPtr = getParentEdgesAtPort(0)[0]->getMemoryPtr();
     auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
     if (!dstMemPtr || !dstMemPtr->isAllocated())
@@ -442,6 +498,10 @@ void FullyConnected::prepareParams() {
 }
 
 void FullyConnected::setDynamicBatchLim(int lim) {
+    if (useWeightsDecompression()) {
+        Node::setDynamicBatchLim(lim);
+        return;
+    }
     if (!execPtr) {
         IE_THROW() << "Can't set dynamic batch for FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -473,6 +533,10 @@ void FullyConnected::setDynamicBatchLim(int lim) {
 }
 
 void FullyConnected::execute(dnnl::stream strm) {
+    if (useWeightsDecompression()) {
+        executeWeightsDecompression();
+        return;
+    }
     if (!execPtr) {
         IE_THROW() << "Can't execute FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -502,6 +566,9 @@ void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // post ops aren't supported by jit_fc_decompression_kernel
+    if (useWeightsDecompression())
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -656,6 +723,9 @@ void FullyConnected::createDescriptorInternal(const dnnl::memory::desc &inputDes
 
 void FullyConnected::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                 const std::vector<MemoryDescPtr> &outputDesc) {
+    if (useWeightsDecompression())
+        return;
+
     MemoryDescPtr inpDesc;
     if (inputDesc[0]->isDefined()) {
         inpDesc = inputDesc[0];
@@ -677,6 +747,21 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (useWeightsDecompression()) {
+        impl_desc_type implType = impl_desc_type::ref;
+        if (impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core)) {
+            implType = impl_desc_type::jit_avx512;
+        } else if (impl::cpu::x64::mayiuse(impl::cpu::x64::avx2)) {
+            implType = impl_desc_type::jit_avx2;
+        }
+        std::vector<PortConfigurator> inConfs = {{LayoutType::ncsp, Precision::FP32},
+                                                 {LayoutType::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)}};
+        if (withBiases)
+            inConfs.emplace_back(LayoutType::ncsp, Precision::FP32);
+        addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, Precision::FP32}}, implType);
+        return;
+    }
+
     for (auto& desc : descs) {
         auto itpd = desc.createPrimitiveDescriptorIterator(getEngine());
         while (static_cast<bool>(itpd)) {
@@ -766,8 +851,26 @@ InferenceEngine::Precision FullyConnected::getRuntimePrecision() const {
     return getMaxPrecision(inputPrecisions);
 }
 
+std::unordered_map<std::string, MemoryCPtr> FullyConnected::getReorderedWeights() const {
+    std::unordered_map<std::string, MemoryCPtr> weights;
+    for (const auto& item : privateWeightCache)
+        weights.emplace(std::string(item.second->getDesc().getPrecision().name()) + "_" + item.first, item.second);
+    return weights;
+}
+
+std::vector<MemoryCPtr> FullyConnected::getRepackedWeights() const {
+    auto weights = Node::getRepackedWeights();
+    for (const auto& item : privateWeightCache)
+        weights.push_back(item.second);
+    if (packedWeights)
+        weights.push_back(packedWeights);
+    return weights;
+}
+
 void FullyConnected::initOptimalPrimitiveDescriptor() {
     Node::initOptimalPrimitiveDescriptor();
+    if (useWeightsDecompression())
+        return;
     auto selectedPD = getSelectedPrimitiveDescriptor();
     implementationTypeIP = selectedPD->getImplementationType();
     // if convolution selected the reorder for ip is useless. Will do the reoder for ip in prepareParams
@@ -902,21 +1005,28 @@ MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
     auto constDnnlMemOutDesc = blob->GetDescWithType<DnnlMemoryDesc>();
     auto weightSrcDesc = constDnnlMemOutDesc->getDnnlDesc();
     weightSrcDesc = weightSrcDesc.reshape(weightDesc->getDnnlDesc().dims());
+    const auto& format = weightDesc->serializeFormat();
+    const auto exported = exportedWeights.find(std::string(weightDesc->getPrecision().name()) + "_" + format);
     auto create = [&] () {
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
+        _ptr->Create(weightDesc);
+        // the weights were reordered into the same layout when the compiled model was exported
+        if (exported != exportedWeights.end() && exported->second->size() == _ptr->GetSize()) {
+            cpu_memcpy(_ptr->GetPtr(), exported->second->data(), _ptr->GetSize());
+            return _ptr;
+        }
+
         auto newSrcDesc = DnnlExtensionUtils::makeDescriptor(weightSrcDesc);
 
         Memory srcMemory{ getEngine() };
         srcMemory.Create(newSrcDesc, blob->GetData());
 
-        MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
-        _ptr->Create(weightDesc);
         node::Reorder::reorderData(srcMemory, *_ptr, context->getParamsCache());
 
         return _ptr;
     };
 
     MemoryPtr ptr;
-    const auto& format = weightDesc->serializeFormat();
     auto itr = privateWeightCache.find(format);
     if (privateWeightCache.end() != itr) {
         ptr = itr->second;
@@ -932,11 +1042,217 @@ MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
             ptr = create();
         }
         privateWeightCache[format] = ptr;
+        if (exported != exportedWeights.end())
+            exportedWeights.erase(exported);
     }
 
     return ptr;
 }
 
+void FullyConnected::initializeWeightsDecompression(const float* scales, const float* zeroPoints, size_t groups) {
+    const size_t size = getInputShapeAtPort(WEIGHTS_ID).getStaticDims()[0] * groups;
+    decompressionGroups = groups;
+    decompressionMultiply.assign(scales, scales + size);
+    if (zeroPoints)
+        decompressionSubtract.assign(zeroPoints, zeroPoints + size);
+}
+
+void FullyConnected::prepareWeightsDecompression() {
+    auto weightsMemPtr = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemoryPtr();
+    if (!weightsMemPtr || !weightsMemPtr->isAllocated())
+        IE_THROW() << "Weights memory hasn't been allocated for node " << getName() << ".";
+    // the weights are constant, so they are packed once
+    if (packedWeights)
+        return;
+
+    const auto& weightsDims = weightsMemPtr->getStaticDims();
+    const size_t OC = weightsDims[0];
+    const size_t IC = weightsDims[1];
+    const size_t groups = decompressionGroups;
+
+    if (impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core)) {
+        decompressionBlock = jit_fc_decompression_kernel_f32<impl::cpu::x64::avx512_core>::simd_w;
+    } else {
+        decompressionBlock = jit_fc_decompression_kernel_f32<impl::cpu::x64::avx2>::simd_w;
+    }
+    const size_t block = decompressionBlock;
+    const size_t OCBlocks = div_up(OC, block);
+    const bool signedWeights = weightsMemPtr->getDesc().getPrecision() == Precision::I8;
+
+    // the u4 / i4 weights are unpacked to 8 bits when the model is loaded, they are packed back when all the values fit
+    const auto src = static_cast<const uint8_t*>(weightsMemPtr->GetPtr());
+    const size_t size = OC * IC;
+    const bool fits4Bits = signedWeights ? std::all_of(src, src + size, [](uint8_t w) { return static_cast<int8_t>(w) >= -8 &&
+                                                                                               static_cast<int8_t>(w) <= 7; })
+                                         : std::all_of(src, src + size, [](uint8_t w) { return w <= 15; });
+    const size_t bits = fits4Bits ? 4 : 8;
+
+    // [OC, IC] -> [OC / block, IC, block], so every input channel of the block is loaded by one instruction
+    auto create = [&] () {
+        const size_t blockBytes = block * bits / 8;
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
+        _ptr->Create(std::make_shared<CpuBlockedMemoryDesc>(Precision::U8, Shape(VectorDims{OCBlocks * IC * blockBytes})));
+        auto dst = static_cast<uint8_t*>(_ptr->GetPtr());
+        parallel_for(OCBlocks, [&](size_t ob) {
+            for (size_t ic = 0; ic < IC; ic++) {
+                auto weight = [&](size_t oc) -> uint8_t {
+                    const size_t srcOC = ob * block + oc;
+                    return srcOC < OC ? src[srcOC * IC + ic] : 0;
+                };
+                uint8_t* packed = dst + (ob * IC + ic) * blockBytes;
+                for (size_t b = 0; b < blockBytes; b++)
+                    packed[b] = bits == 8 ? weight(b) : (weight(b) & 0xF) | ((weight(b + blockBytes) & 0xF) << 4);
+            }
+        });
+        return _ptr;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_decompression_" + std::to_string(block) + "_" + std::to_string(bits)
+                                        + "_" + std::to_string(weightsMemPtr->GetSize())
+                                        + "_" + std::to_string(reinterpret_cast<uint64_t>(weightsMemPtr->GetData()));
+        packedWeights = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        packedWeights = create();
+    }
+
+    // [OC, groups] -> [OC / block, groups, block]
+    auto pack = [&](const std::vector<float>& values) {
+        std::vector<float> packed(OCBlocks * groups * block, 0.f);
+        for (size_t oc = 0; oc < OC; oc++) {
+            for (size_t g = 0; g < groups; g++) {
+                packed[((oc / block) * groups + g) * block + oc % block] = values[oc * groups + g];
+            }
+        }
+        return packed;
+    };
+    packedScales = pack(decompressionMultiply);
+    if (!decompressionSubtract.empty())
+        packedZeroPoints = pack(decompressionSubtract);
+    if (withBiases) {
+        const auto bias = static_cast<const float*>(getParentEdgesAtPort(BIAS_ID)[0]->getMemoryPtr()->GetPtr());
+        packedBias.assign(OCBlocks * block, 0.f);
+        std::copy(bias, bias + OC, packedBias.begin());
+    }
+
+    decompressionParams.IC = IC;
+    decompressionParams.groupSize = IC / groups;
+    decompressionParams.rows = jit_fc_decompression_params::maxRows;
+    decompressionParams.signedWeights = signedWeights;
+    decompressionParams.weightsBits = bits;
+    decompressionParams.withZeroPoints = !packedZeroPoints.empty();
+    decompressionParams.withBias = withBiases;
+
+    if (!impl::cpu::x64::mayiuse(impl::cpu::x64::avx2))
+        return;
+    for (size_t rows = 1; rows <= jit_fc_decompression_params::maxRows; rows++) {
+        auto jcp = decompressionParams;
+        jcp.rows = rows;
+        std::shared_ptr<jit_fc_decompression_kernel> kernel;
+        if (impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core)) {
+            kernel.reset(new jit_fc_decompression_kernel_f32<impl::cpu::x64::avx512_core>(jcp));
+        } else {
+            kernel.reset(new jit_fc_decompression_kernel_f32<impl::cpu::x64::avx2>(jcp));
+        }
+        kernel->create_ker();
+        decompressionKernels.push_back(kernel);
+    }
+}
+
+void FullyConnected::executeWeightsDecompression() {
+    constexpr size_t maxRows = jit_fc_decompression_params::maxRows;
+    constexpr size_t maxBlock = jit_fc_decompression_kernel_f32<impl::cpu::x64::avx512_core>::simd_w;
+
+    const auto& srcMem = getParentEdgesAtPort(DATA_ID)[0]->getMemory();
+    auto& dstMem = getChildEdgesAtPort(0)[0]->getMemory();
+    const auto& srcDims = srcMem.getStaticDims();
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    const size_t IC = decompressionParams.IC;
+    const size_t OC = getParentEdgesAtPort(WEIGHTS_ID)[0]->getMemory().getStaticDims()[0];
+    const size_t groups = decompressionGroups;
+    const size_t block = decompressionBlock;
+
+    const auto src = reinterpret_cast<const float*>(srcMem.GetPtr());
+    auto dst = reinterpret_cast<float*>(dstMem.GetPtr());
+    const auto weights = static_cast<const uint8_t*>(packedWeights->GetPtr());
+    const size_t blockBytes = block * decompressionParams.weightsBits / 8;
+
+    if (M >= decompressedWeightsMinRows) {
+        // the chunk of the output channels is decompressed once into the buffer of the thread, which is released after the
+        // inference, so only the compressed weights are kept
+        const size_t chunkBlocks = decompressedChunk / block;
+        const size_t chunks = div_up(OC, chunkBlocks * block);
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(chunks, nthr, ithr, start, end);
+            if (start >= end)
+                return;
+            std::vector<float> decompressed(IC * chunkBlocks * block);
+            for (size_t chunk = start; chunk < end; chunk++) {
+                const size_t oc = chunk * chunkBlocks * block;
+                const size_t N = std::min(chunkBlocks * block, OC - oc);
+                const size_t ldb = chunkBlocks * block;
+                for (size_t ob = oc / block; ob < div_up(oc + N, block); ob++) {
+                    const size_t col = ob * block - oc;
+                    const uint8_t* blockWeights = weights + ob * IC * blockBytes;
+                    const float* scales = packedScales.data() + ob * groups * block;
+                    const float* zeroPoints = packedZeroPoints.empty() ? nullptr : packedZeroPoints.data() + ob * groups * block;
+                    for (size_t ic = 0; ic < IC; ic++) {
+                        const size_t g = ic / decompressionParams.groupSize;
+                        for (size_t b = 0; b < block; b++) {
+                            const float w = unpackWeight(blockWeights, ic, b, block, decompressionParams.weightsBits,
+                                                         decompressionParams.signedWeights);
+                            const float zeroPoint = zeroPoints ? zeroPoints[g * block + b] : 0.f;
+                            decompressed[ic * ldb + col + b] = (w - zeroPoint) * scales[g * block + b];
+                        }
+                    }
+                }
+                if (!packedBias.empty()) {
+                    for (size_t m = 0; m < M; m++)
+                        std::copy(packedBias.data() + oc, packedBias.data() + oc + N, dst + m * OC + oc);
+                }
+                const auto m = static_cast<dnnl_dim_t>(M), n = static_cast<dnnl_dim_t>(N), k = static_cast<dnnl_dim_t>(IC);
+                dnnl_sgemm('N', 'N', m, n, k, 1.f, src, k, decompressed.data(), static_cast<dnnl_dim_t>(ldb),
+                           packedBias.empty() ? 0.f : 1.f, dst + oc, static_cast<dnnl_dim_t>(OC));
+            }
+        });
+        return;
+    }
+
+    // the blocks of the output channels are the outer dimension, so a thread reuses the decompressed weights
+    parallel_for2d(div_up(OC, block), div_up(M, maxRows), [&](size_t ob, size_t mb) {
+        const size_t m = mb * maxRows;
+        const size_t rows = std::min(maxRows, M - m);
+        const size_t oc = ob * block;
+        const bool isTail = oc + block > OC;
+        float tail[maxRows * maxBlock];
+
+        jit_fc_decompression_args args;
+        args.src = src + m * IC;
+        args.weights = weights + ob * IC * blockBytes;
+        args.scales = packedScales.data() + ob * groups * block;
+        args.zero_points = packedZeroPoints.empty() ? nullptr : packedZeroPoints.data() + ob * groups * block;
+        args.bias = packedBias.empty() ? nullptr : packedBias.data() + oc;
+        args.dst = isTail ? tail : dst + m * OC + oc;
+        args.src_stride = IC * sizeof(float);
+        args.dst_stride = (isTail ? block : OC) * sizeof(float);
+
+        if (!decompressionKernels.empty()) {
+            (*decompressionKernels[rows - 1])(&args);
+        } else {
+            auto jcp = decompressionParams;
+            jcp.rows = rows;
+            fcDecompressionRef(jcp, args, block);
+        }
+
+        if (isTail) {
+            for (size_t r = 0; r < rows; r++)
+                std::copy(tail + r * block, tail + r * block + (OC - oc), dst + (m + r) * OC + oc);
+        }
+    });
+}
+
 bool FullyConnected::useSparseWeightsDecompression() {
     // minSparseRate == 1 means that sparse feature is switched off
     if (minSparseRate == 1.f) {
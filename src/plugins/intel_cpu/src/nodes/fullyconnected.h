@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 #include "common/dnnl_executor.h"
+#include "kernels/fc_decompression_kernel.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -48,6 +49,9 @@ public:
 
     InferenceEngine::Precision getRuntimePrecision() const override;
 
+    std::vector<MemoryCPtr> getRepackedWeights() const override;
+    std::unordered_map<std::string, MemoryCPtr> getReorderedWeights() const override;
+
     bool canFuse(const NodePtr& node) const override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
@@ -57,6 +61,15 @@ public:
 
     void setDynamicBatchLim(int lim) override;
 
+    /**
+     * Keeps the int8 weights compressed: FullyConnected decompresses them on the fly as
+     * (weights - zeroPoints) * scales, the scales and the zero points are [OC, groups] values in f32.
+     * The weights which fit into 4 bits are packed by two into a byte. For the activations with many rows
+     * every thread decompresses a chunk of the output channels once into a temporary buffer and multiplies it by sgemm.
+     * zeroPoints may be nullptr.
+     */
+    void initializeWeightsDecompression(const float* scales, const float* zeroPoints, size_t groups);
+
 private:
     void createDescriptorInternal(const dnnl::memory::desc &inputDesc,
                                   const dnnl::memory::desc &outputDesc);
@@ -113,6 +126,25 @@ private:
     float minSparseRate = 1.f;
     float weiSparseRate = 0.f;
     bool useSparseWeightsDecompression();
+
+    // int8 weights decompression
+    bool useWeightsDecompression() const {
+        return !decompressionMultiply.empty();
+    }
+    void prepareWeightsDecompression();
+    void executeWeightsDecompression();
+    std::vector<float> decompressionMultiply;
+    std::vector<float> decompressionSubtract;
+    size_t decompressionGroups = 1;
+    jit_fc_decompression_params decompressionParams = {};
+    // output channels are packed into blocks of decompressionBlock, the tail is padded with zeros
+    size_t decompressionBlock = 0;
+    MemoryPtr packedWeights;
+    std::vector<float> packedScales;
+    std::vector<float> packedZeroPoints;
+    std::vector<float> packedBias;
+    // kernel per number of the processed rows, empty when the reference implementation is used
+    std::vector<std::shared_ptr<jit_fc_decompression_kernel>> decompressionKernels;
 };
 
 }   // namespace node
@@ -231,7 +231,10 @@ jit_has_subnormals_base::fn_t jit_has_subnormals_function() {
 }   // namespace
 
 Input::Input(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context)
-        : Node(op, context, PassThroughShapeInferFactory()) {
+        : Input(op, context, PassThroughShapeInferFactory()) {}
+
+Input::Input(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context, const ShapeInferFactory& shapeInferFactory)
+        : Node(op, context, shapeInferFactory) {
     if (!one_of(op->get_type_info(),
             v0::Parameter::get_type_info_static(),
             v0::Constant::get_type_info_static(),
@@ -351,19 +354,27 @@ void Input::cloneBlobIfRequired() {
                 + "_" + ptr;
     };
 
+    // By default the constants are copied to the weights cache, so every NUMA node gets its own replica.
+    // With CPU_CONSTANTS_IN_PLACE the constants which can be consumed as is are used in place, all the streams
+    // reference the same ngraph Constant, so the data is shared between them (and with other processes,
+    // if the weights buffer is a file mapping).
     auto weightCache = context->getWeightsCache();
-    if (weightCache) {
-        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
-        memoryPtr = std::const_pointer_cast<const Memory>(ptr);
-    } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
+    if ((!weightCache || context->getConfig().constantsInPlace) && isBlobAligned() && !hasSubnormals() && !isWA()) {
         auto ptr = new Memory(getEngine());
         ptr->Create(memDesc, constOp->get_data_ptr());
         memoryPtr = MemoryCPtr(ptr);
+    } else if (weightCache) {
+        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        memoryPtr = std::const_pointer_cast<const Memory>(ptr);
     } else {
         memoryPtr = std::const_pointer_cast<const Memory>(cloneBlob());
     }
 }
 
+bool Input::isSharedConstant() const {
+    return constOp && memoryPtr && memoryPtr->GetData() == constOp->get_data_ptr();
+}
+
 Input::Input(const Shape& shape,
              const InferenceEngine::Precision& prc,
              const std::string& name,
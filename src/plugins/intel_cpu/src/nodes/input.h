@@ -30,6 +30,10 @@ public:
 
     void withMeanImage();
     MemoryCPtr getMemoryPtr() const;
+    /**
+     * @brief Checks whether the constant data is used directly from the ngraph Constant buffer (without copying)
+     */
+    bool isSharedConstant() const;
 
     void executeDynamicImpl(dnnl::stream strm) override {}
     bool isExecutable() const override {
@@ -39,6 +43,9 @@ public:
     bool needShapeInfer() const override { return false; }
     bool needPrepareParams() const override { return false; }
 
+protected:
+    Input(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context, const ShapeInferFactory& shapeInferFactory);
+
 private:
     void cloneBlobIfRequired();
     void initSupportedPdDefault();
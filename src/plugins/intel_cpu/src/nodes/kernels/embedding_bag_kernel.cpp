@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_kernel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+#define GET_OFF(field) offsetof(jit_emb_bag_args, field)
+
+template <cpu_isa_t isa>
+void jit_emb_bag_kernel_f32<isa>::accumulate_row(size_t accs, bool withPrefetch) {
+    const size_t srcVlen = simd_w * (jcp_.bf16Table ? sizeof(uint16_t) : sizeof(float));
+    const size_t cacheLine = 64;
+
+    movsxd(reg_row, dword[reg_indices]);
+    imul(reg_row, reg_row, static_cast<int>(jcp_.rowStride));
+    add(reg_row, reg_src);
+
+    if (withPrefetch) {
+        movsxd(reg_prefetch_row, dword[reg_indices + jcp_.prefetchDistance * sizeof(int)]);
+        imul(reg_prefetch_row, reg_prefetch_row, static_cast<int>(jcp_.rowStride));
+        add(reg_prefetch_row, reg_src);
+        for (size_t offset = 0; offset < accs * srcVlen; offset += cacheLine)
+            prefetcht0(ptr[reg_prefetch_row + offset]);
+    }
+
+    if (jcp_.withWeights)
+        uni_vbroadcastss(vmm_weight, ptr[reg_weights]);
+
+    for (size_t a = 0; a < accs; a++) {
+        if (jcp_.bf16Table) {
+            uni_vpmovzxwd(vmm_data, ptr[reg_row + a * srcVlen]);
+            uni_vpslld(vmm_data, vmm_data, 16);
+        } else {
+            uni_vmovups(vmm_data, ptr[reg_row + a * srcVlen]);
+        }
+        if (jcp_.withWeights)
+            uni_vfmadd231ps(vmm_acc(a), vmm_data, vmm_weight);
+        else
+            uni_vaddps(vmm_acc(a), vmm_acc(a), vmm_data);
+    }
+
+    add(reg_indices, sizeof(int));
+    if (jcp_.withWeights)
+        add(reg_weights, sizeof(float));
+    dec(reg_work);
+}
+
+template <cpu_isa_t isa>
+void jit_emb_bag_kernel_f32<isa>::accumulate_chunk(size_t accs) {
+    using Xbyak::Label;
+
+    for (size_t a = 0; a < accs; a++)
+        uni_vpxor(vmm_acc(a), vmm_acc(a), vmm_acc(a));
+
+    mov(reg_indices, ptr[param1 + GET_OFF(indices)]);
+    if (jcp_.withWeights)
+        mov(reg_weights, ptr[param1 + GET_OFF(weights)]);
+    mov(reg_work, ptr[param1 + GET_OFF(size)]);
+
+    Label prefetch_loop;
+    Label main_loop;
+    Label end;
+
+    if (jcp_.prefetchDistance) {
+        // the row of the index prefetchDistance ahead is prefetched while it exists
+        L(prefetch_loop);
+        {
+            cmp(reg_work, static_cast<int>(jcp_.prefetchDistance));
+            jbe(main_loop, T_NEAR);
+            accumulate_row(accs, true);
+            jmp(prefetch_loop, T_NEAR);
+        }
+    }
+
+    L(main_loop);
+    {
+        test(reg_work, reg_work);
+        jz(end, T_NEAR);
+        accumulate_row(accs, false);
+        jmp(main_loop, T_NEAR);
+    }
+    L(end);
+
+    for (size_t a = 0; a < accs; a++)
+        uni_vmovups(ptr[reg_dst + a * simd_w * sizeof(float)], vmm_acc(a));
+}
+
+template <cpu_isa_t isa>
+void jit_emb_bag_kernel_f32<isa>::generate() {
+    using Xbyak::Label;
+
+    this->preamble();
+
+    const size_t vecs = jcp_.embDepth / simd_w;
+    const size_t fullChunks = vecs / maxAccs;
+    const size_t tailAccs = vecs % maxAccs;
+    const size_t srcVlen = simd_w * (jcp_.bf16Table ? sizeof(uint16_t) : sizeof(float));
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_dst, ptr[param1 + GET_OFF(dst)]);
+
+    // the row is processed by chunks of maxAccs vectors, every chunk walks over all the indices of the bag
+    if (fullChunks) {
+        Label chunk_loop;
+        mov(reg_chunks, fullChunks);
+        L(chunk_loop);
+        {
+            accumulate_chunk(maxAccs);
+            add(reg_src, maxAccs * srcVlen);
+            add(reg_dst, maxAccs * simd_w * sizeof(float));
+            dec(reg_chunks);
+            jnz(chunk_loop, T_NEAR);
+        }
+    }
+    if (tailAccs)
+        accumulate_chunk(tailAccs);
+
+    this->postamble();
+}
+
+template struct jit_emb_bag_kernel_f32<cpu::x64::avx2>;
+template struct jit_emb_bag_kernel_f32<cpu::x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,95 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu/x64/jit_generator.hpp"
+#include <dnnl_types.h>
+
+namespace ov {
+namespace intel_cpu {
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+using namespace dnnl::impl::utils;
+
+struct jit_emb_bag_params {
+    size_t embDepth;            // elements of the row accumulated by the kernel, multiple of simd_w
+    size_t rowStride;           // bytes between the rows of the table
+    bool bf16Table;
+    bool withWeights;
+    size_t prefetchDistance;    // in indices, 0 disables the software prefetching
+};
+
+struct jit_emb_bag_args {
+    const uint8_t* src;     // embedding table
+    const int* indices;     // [size] rows of the bag
+    const float* weights;   // [size] per sample weights
+    size_t size;            // at least 1
+    float* dst;             // [embDepth] sum of the rows
+};
+
+/**
+ * Sums the rows of the embedding table selected by the indices of one bag. The accumulators of a chunk of the row
+ * stay in registers during the walk over the indices, the rows of the upcoming indices are prefetched since their
+ * addresses are random and the hardware prefetcher can't follow them.
+ */
+struct jit_emb_bag_kernel {
+    void (*ker_)(const jit_emb_bag_args*);
+
+    void operator()(const jit_emb_bag_args* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_emb_bag_kernel(const jit_emb_bag_params& jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_emb_bag_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_emb_bag_params jcp_;
+};
+
+template <cpu_isa_t isa>
+struct jit_emb_bag_kernel_f32 : public jit_emb_bag_kernel, public jit_generator {
+    public:
+        DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_emb_bag_kernel_f32)
+
+        explicit jit_emb_bag_kernel_f32(const jit_emb_bag_params& jcp)
+            : jit_emb_bag_kernel(jcp), jit_generator(jit_name()) {}
+
+        void create_ker() override {
+            jit_generator::create_kernel();
+            ker_ = (decltype(ker_))jit_ker();
+        }
+
+        void generate() override;
+
+        static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    private:
+        using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm,
+                                          isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+        static constexpr size_t maxAccs = isa == cpu::x64::avx512_core ? 16 : 8;
+
+        void accumulate_chunk(size_t accs);
+        void accumulate_row(size_t accs, bool withPrefetch);
+
+        Xbyak::Reg64 reg_src = r8;
+        Xbyak::Reg64 reg_indices = r9;
+        Xbyak::Reg64 reg_weights = r10;
+        Xbyak::Reg64 reg_work = r11;
+        Xbyak::Reg64 reg_dst = r12;
+        Xbyak::Reg64 reg_row = r13;
+        Xbyak::Reg64 reg_prefetch_row = r14;
+        Xbyak::Reg64 reg_chunks = r15;
+
+        Vmm vmm_acc(size_t idx) const { return Vmm(idx); }
+        Vmm vmm_data = Vmm(maxAccs);
+        Vmm vmm_weight = Vmm(maxAccs + 1);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,148 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fc_decompression_kernel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+#define GET_OFF(field) offsetof(jit_fc_decompression_args, field)
+
+template <cpu_isa_t isa>
+Xbyak::Address jit_fc_decompression_kernel_f32<isa>::row_ptr(const Xbyak::Reg64& base,
+                                                             const Xbyak::Reg64& stride,
+                                                             const Xbyak::Reg64& stride3,
+                                                             size_t row) {
+    switch (row) {
+    case 0:
+        return ptr[base];
+    case 1:
+        return ptr[base + stride];
+    case 2:
+        return ptr[base + stride * 2];
+    default:
+        return ptr[base + stride3];
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_fc_decompression_kernel_f32<isa>::load_weights() {
+    if (jcp_.weightsBits == 8) {
+        if (jcp_.signedWeights)
+            uni_vpmovsxbd(vmm_weights, ptr[reg_weights]);
+        else
+            uni_vpmovzxbd(vmm_weights, ptr[reg_weights]);
+        return;
+    }
+
+    // simd_w / 2 bytes: the low nibbles are the first half of the output channels, the high nibbles the second one
+    const HalfVmm half_weights(vmm_weights.getIdx());
+    const HalfVmm half_high(vmm_high.getIdx());
+    vpmovzxbd(half_weights, ptr[reg_weights]);
+    vpsrld(half_high, half_weights, 4);
+    vpand(half_weights, half_weights, HalfVmm(vmm_nibble_mask.getIdx()));
+    if (isa == cpu::x64::avx512_core)
+        vinserti64x4(Xbyak::Zmm(vmm_weights.getIdx()), Xbyak::Zmm(vmm_weights.getIdx()), Xbyak::Ymm(vmm_high.getIdx()), 1);
+    else
+        vinserti128(Xbyak::Ymm(vmm_weights.getIdx()), Xbyak::Ymm(vmm_weights.getIdx()), Xbyak::Xmm(vmm_high.getIdx()), 1);
+    // sign extension of 4 bits: (w ^ 8) - 8
+    if (jcp_.signedWeights) {
+        uni_vpxor(vmm_weights, vmm_weights, vmm_sign);
+        vpsubd(vmm_weights, vmm_weights, vmm_sign);
+    }
+}
+
+template <cpu_isa_t isa>
+void jit_fc_decompression_kernel_f32<isa>::generate() {
+    using Xbyak::Label;
+
+    this->preamble();
+
+    const size_t rows = jcp_.rows;
+    const size_t groups = jcp_.IC / jcp_.groupSize;
+
+    mov(reg_src, ptr[param1 + GET_OFF(src)]);
+    mov(reg_weights, ptr[param1 + GET_OFF(weights)]);
+    mov(reg_scales, ptr[param1 + GET_OFF(scales)]);
+    if (jcp_.withZeroPoints)
+        mov(reg_zero_points, ptr[param1 + GET_OFF(zero_points)]);
+    mov(reg_stride, ptr[param1 + GET_OFF(src_stride)]);
+    lea(reg_stride3, ptr[reg_stride + reg_stride * 2]);
+
+    if (jcp_.weightsBits == 4) {
+        auto broadcast = [&](const Vmm& vmm, int value) {
+            mov(reg_tmp.cvt32(), value);
+            vmovd(Xbyak::Xmm(vmm.getIdx()), reg_tmp.cvt32());
+            vpbroadcastd(vmm, Xbyak::Xmm(vmm.getIdx()));
+        };
+        broadcast(vmm_nibble_mask, 0xF);
+        if (jcp_.signedWeights)
+            broadcast(vmm_sign, 8);
+    }
+
+    if (jcp_.withBias) {
+        mov(reg_tmp, ptr[param1 + GET_OFF(bias)]);
+        for (size_t r = 0; r < rows; r++)
+            uni_vmovups(vmm_acc(r), ptr[reg_tmp]);
+    } else {
+        for (size_t r = 0; r < rows; r++)
+            uni_vpxor(vmm_acc(r), vmm_acc(r), vmm_acc(r));
+    }
+
+    Label group_loop;
+    Label ic_loop;
+
+    mov(reg_groups, groups);
+    L(group_loop);
+    {
+        for (size_t r = 0; r < rows; r++)
+            uni_vpxor(vmm_partial(r), vmm_partial(r), vmm_partial(r));
+        if (jcp_.withZeroPoints)
+            uni_vmovups(vmm_zero_point, ptr[reg_zero_points]);
+
+        mov(reg_ic, jcp_.groupSize);
+        L(ic_loop);
+        {
+            // simd_w weights of the input channel are decompressed in the register
+            load_weights();
+            uni_vcvtdq2ps(vmm_weights, vmm_weights);
+            if (jcp_.withZeroPoints)
+                uni_vsubps(vmm_weights, vmm_weights, vmm_zero_point);
+
+            for (size_t r = 0; r < rows; r++) {
+                uni_vbroadcastss(vmm_src, row_ptr(reg_src, reg_stride, reg_stride3, r));
+                uni_vfmadd231ps(vmm_partial(r), vmm_weights, vmm_src);
+            }
+
+            add(reg_weights, simd_w * jcp_.weightsBits / 8);
+            add(reg_src, sizeof(float));
+            dec(reg_ic);
+            jnz(ic_loop, T_NEAR);
+        }
+
+        uni_vmovups(vmm_scale, ptr[reg_scales]);
+        for (size_t r = 0; r < rows; r++)
+            uni_vfmadd231ps(vmm_acc(r), vmm_partial(r), vmm_scale);
+
+        add(reg_scales, simd_w * sizeof(float));
+        if (jcp_.withZeroPoints)
+            add(reg_zero_points, simd_w * sizeof(float));
+        dec(reg_groups);
+        jnz(group_loop, T_NEAR);
+    }
+
+    mov(reg_dst, ptr[param1 + GET_OFF(dst)]);
+    mov(reg_stride, ptr[param1 + GET_OFF(dst_stride)]);
+    lea(reg_stride3, ptr[reg_stride + reg_stride * 2]);
+    for (size_t r = 0; r < rows; r++)
+        uni_vmovups(row_ptr(reg_dst, reg_stride, reg_stride3, r), vmm_acc(r));
+
+    this->postamble();
+}
+
+template struct jit_fc_decompression_kernel_f32<cpu::x64::avx2>;
+template struct jit_fc_decompression_kernel_f32<cpu::x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
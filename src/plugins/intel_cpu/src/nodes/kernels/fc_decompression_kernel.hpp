@@ -0,0 +1,114 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu/x64/jit_generator.hpp"
+#include <dnnl_types.h>
+
+namespace ov {
+namespace intel_cpu {
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+using namespace dnnl::impl::utils;
+
+struct jit_fc_decompression_params {
+    size_t IC;              // input channels
+    size_t groupSize;       // input channels per scale, IC for the scales per output channel
+    size_t rows;            // rows of the activations processed by one call, up to maxRows
+    bool signedWeights;
+    size_t weightsBits;     // 8, or 4 when two weights are packed into a byte
+    bool withZeroPoints;
+    bool withBias;
+
+    static constexpr size_t maxRows = 4;
+};
+
+struct jit_fc_decompression_args {
+    const float* src;           // [rows, IC] activations
+    const uint8_t* weights;     // [IC, simd_w] block of the packed u8 / i8 weights, [IC, simd_w / 2] bytes for 4 bits:
+                                // the low nibble keeps the output channel oc, the high one oc + simd_w / 2
+    const float* scales;        // [IC / groupSize, simd_w]
+    const float* zero_points;   // [IC / groupSize, simd_w]
+    const float* bias;          // [simd_w]
+    float* dst;                 // [rows, simd_w] block of the output
+    size_t src_stride;          // in bytes
+    size_t dst_stride;          // in bytes
+};
+
+/**
+ * Computes simd_w output channels of FullyConnected with the compressed weights: the weights are decompressed
+ * into registers as (w - zero_point) * scale, so they are read from memory in the int8 precision.
+ * The partial sums of every group of input channels are scaled once per group.
+ */
+struct jit_fc_decompression_kernel {
+    void (*ker_)(const jit_fc_decompression_args*);
+
+    void operator()(const jit_fc_decompression_args* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_fc_decompression_kernel(const jit_fc_decompression_params& jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_fc_decompression_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_fc_decompression_params jcp_;
+};
+
+template <cpu_isa_t isa>
+struct jit_fc_decompression_kernel_f32 : public jit_fc_decompression_kernel, public jit_generator {
+    public:
+        DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_fc_decompression_kernel_f32)
+
+        explicit jit_fc_decompression_kernel_f32(const jit_fc_decompression_params& jcp)
+            : jit_fc_decompression_kernel(jcp), jit_generator(jit_name()) {}
+
+        void create_ker() override {
+            jit_generator::create_kernel();
+            ker_ = (decltype(ker_))jit_ker();
+        }
+
+        void generate() override;
+
+        static constexpr int simd_w = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    private:
+        using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm,
+                                          isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+        using HalfVmm = typename conditional<isa == cpu::x64::avx512_core, Xbyak::Ymm, Xbyak::Xmm>::type;
+
+        Xbyak::Address row_ptr(const Xbyak::Reg64& base, const Xbyak::Reg64& stride, const Xbyak::Reg64& stride3, size_t row);
+
+        Xbyak::Reg64 reg_src = r8;
+        Xbyak::Reg64 reg_weights = r9;
+        Xbyak::Reg64 reg_scales = r10;
+        Xbyak::Reg64 reg_zero_points = r11;
+        Xbyak::Reg64 reg_dst = r12;
+        Xbyak::Reg64 reg_stride = r13;
+        Xbyak::Reg64 reg_stride3 = r14;
+        Xbyak::Reg64 reg_ic = r15;
+        Xbyak::Reg64 reg_groups = rbx;
+        Xbyak::Reg64 reg_tmp = rax;
+
+        // accumulators: 0 .. maxRows - 1, partial sums of the group: maxRows .. 2 * maxRows - 1
+        Vmm vmm_acc(size_t row) const { return Vmm(row); }
+        Vmm vmm_partial(size_t row) const { return Vmm(jit_fc_decompression_params::maxRows + row); }
+        Vmm vmm_weights = Vmm(2 * jit_fc_decompression_params::maxRows);
+        Vmm vmm_src = Vmm(2 * jit_fc_decompression_params::maxRows + 1);
+        Vmm vmm_zero_point = Vmm(2 * jit_fc_decompression_params::maxRows + 2);
+        Vmm vmm_scale = Vmm(2 * jit_fc_decompression_params::maxRows + 3);
+        // 4 bits weights
+        Vmm vmm_high = Vmm(2 * jit_fc_decompression_params::maxRows + 4);
+        Vmm vmm_nibble_mask = Vmm(2 * jit_fc_decompression_params::maxRows + 5);
+        Vmm vmm_sign = Vmm(2 * jit_fc_decompression_params::maxRows + 6);
+
+        void load_weights();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -6,8 +6,7 @@
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
 #include "memory.hpp"
-#include "common/cpu_convert.h"
-#include "common/cpu_memcpy.h"
+#include "concat.h"
 #include "utils/general_utils.h"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "utils/ngraph_utils.hpp"
@@ -31,8 +30,8 @@ MemoryNode::MemoryNode(const std::shared_ptr<ngraph::Node>& op) {
 
 bool MemoryOutput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
+        if (op->get_input_partial_shape(0).rank().is_dynamic()) {
+            errorMessage = "Doesn't support op with dynamic rank";
             return false;
         }
 
@@ -79,18 +78,32 @@ void MemoryOutput::initSupportedPrimitiveDescriptors() {
     supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::unknown);
 }
 
+void MemoryOutput::createPrimitive() {
+    // The growing state (e.g. the past keys and values of a decoder) is usually updated as the concatenation of the state
+    // read by the input sibling with the new part, so only the new part has to be stored.
+    if (!isDynamicNode())
+        return;
+    auto concat = std::dynamic_pointer_cast<Concat>(getParentEdgeAt(0)->getParent());
+    if (concat && concat->getParentEdgesAtPort(0)[0]->getParent().get() == inputNode)
+        appendAxis = static_cast<int>(concat->getAxis());
+}
+
 void MemoryOutput::execute(dnnl::stream strm)  {
     auto& srcMemory = getParentEdgeAt(0)->getMemory();
 
     auto inputMemoryNode = dynamic_cast<MemoryInput*>(inputNode);
     IE_ASSERT(inputMemoryNode != nullptr);
-    inputMemoryNode->storeState(srcMemory);
+    if (appendAxis >= 0) {
+        inputMemoryNode->appendState(srcMemory, appendAxis);
+    } else {
+        inputMemoryNode->storeState(srcMemory);
+    }
 }
 
 bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
+        if (op->get_output_partial_shape(0).rank().is_dynamic()) {
+            errorMessage = "Doesn't support op with dynamic rank";
             return false;
         }
 
@@ -106,8 +119,41 @@ bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>
     return true;
 }
 
+namespace {
+/**
+ * The output shape of MemoryInput is the shape of the attached state
+ */
+class MemoryInputShapeInfer : public ShapeInferEmptyPads {
+public:
+    explicit MemoryInputShapeInfer(const MemoryInput& node) : m_node(node) {}
+    Result infer(
+        const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
+        const std::unordered_map<size_t, MemoryPtr>& data_dependency) override {
+        return {{m_node.getStateDims()}, ShapeInferStatus::success};
+    }
+
+    port_mask_t get_port_mask() const override {
+        return EMPTY_PORT_MASK;
+    }
+
+private:
+    const MemoryInput& m_node;
+};
+
+class MemoryInputShapeInferFactory : public ShapeInferFactory {
+public:
+    explicit MemoryInputShapeInferFactory(const MemoryInput& node) : m_node(node) {}
+    ShapeInferPtr makeShapeInfer() const override {
+        return std::make_shared<MemoryInputShapeInfer>(m_node);
+    }
+
+private:
+    const MemoryInput& m_node;
+};
+}   // namespace
+
 MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr ctx)
-        : Input(op, ctx), MemoryNode(op), dataStore(new Memory{ctx->getEngine()}) {
+        : Input(op, ctx, MemoryInputShapeInferFactory(*this)), MemoryNode(op) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
@@ -120,56 +166,65 @@ MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const GraphCon
 void MemoryInput::createPrimitive() {
     Input::createPrimitive();
 
-    dataStore->Create(getChildEdgeAt(0)->getMemory().getDesc());
-
-    // default memory state is zero filled
-    if (dataStore->getDesc().hasDefinedMaxSize())
-        dataStore->FillZero();
+    defaultState = std::make_shared<VariableState>(getId(), getStateDesc(), getDefaultStateDims(), getEngine());
+    attachState(nullptr);
 }
 
-/**
- * Copy data from one tensor into other.
- * As is. Assume that data is dense tensor with same layout.
- * @param dst destination memory object
- * @param src source memory object
- */
-inline
-static void simple_copy(const Memory& dst, const Memory& src) {
-    auto srcPtr = static_cast<uint8_t*>(src.GetPtr());
-    auto dstPtr = static_cast<uint8_t*>(dst.GetPtr());
-    if (src.GetDataType() == dst.GetDataType()) {
-        auto srcSizeInByte = src.GetSize();
-        auto dstSizeInByte = dst.GetSize();
-
-        IE_ASSERT(srcSizeInByte == dstSizeInByte) << "MemoryNode objects are not compatible. Has different sizes.";
-
-        cpu_memcpy(dstPtr, srcPtr, srcSizeInByte);
-    } else {
-        cpu_convert(srcPtr, dstPtr, src.getDesc().getPrecision(),
-            dst.getDesc().getPrecision(), src.getDesc().getShape().getElementsCount());
+VectorDims MemoryInput::getDefaultStateDims() const {
+    const auto& stateShape = getOutputShapeAtPort(0);
+    if (stateShape.isStatic())
+        return stateShape.getStaticDims();
+    if (!getParentEdges().empty()) {
+        const auto& initShape = getInputShapeAtPort(0);
+        if (initShape.isStatic() && stateShape.isCompatible(initShape.getStaticDims()))
+            return initShape.getStaticDims();
     }
+    return stateShape.getMinDims();
 }
 
 MemoryInput::~MemoryInput() {
     MemoryNodeVirtualEdge::remove(this, holder);
 }
 
-MemoryPtr MemoryInput::getStore() {
-    return dataStore;
+void MemoryInput::attachState(std::shared_ptr<VariableState> newState) {
+    state = newState ? std::move(newState) : defaultState;
+    if (readMemMngr)
+        updateStateBuffersBinding();
+}
+
+void MemoryInput::bindStateBuffers(DnnlMemoryMngrPtr readMngr, DnnlMemoryMngrPtr writeMngr) {
+    readMemMngr = std::move(readMngr);
+    writeMemMngr = std::move(writeMngr);
+}
+
+void MemoryInput::updateStateBuffersBinding() {
+    const auto current = state->getCurrentBuffer();
+    const auto next = state->getNextBuffer();
+    readMemMngr->setExtBuff(current->GetData(), current->GetSize());
+    writeMemMngr->setExtBuff(next->GetData(), next->GetSize());
+}
+
+void MemoryInput::swapStateBuffers() {
+    state->swapBuffers();
+    updateStateBuffersBinding();
 }
 
 void MemoryInput::storeState(const Memory &new_state) {
-    // TODO: Should be next one call:
-    //           dataStore.SetData(new_state, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    // the new state has already been written to the next state buffer by the Assign producer
+    if (readMemMngr)
+        return;
+    state->write(new_state);
+}
+
+void MemoryInput::appendState(const Memory &new_state, size_t axis) {
+    state->append(new_state, axis);
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
-    // TODO: Should be simple call of:
-    //           dst_mem.SetData(dataStore, false);
-    //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    // the output memory is the current state buffer itself
+    if (readMemMngr)
+        return;
+    state->read(getChildEdgeAt(0)->getMemory());
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -8,6 +8,7 @@
 #include <cpu_types.h>
 #include "ie_algorithm.hpp"
 #include "input.h"
+#include "memory_state.h"
 #include <node.h>
 #include <string>
 #include <memory>
@@ -66,22 +67,37 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
-    void createPrimitive() override {}
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
     bool created() const override {
         return getType() == Type::MemoryOutput;
     }
 
+    bool needShapeInfer() const override { return false; }
+    bool needPrepareParams() const override { return false; }
+
     void setInputNode(Node* node) override {
         inputNode = node;
     }
 
+    Node* getInputNode() const {
+        return inputNode;
+    }
+
  private:
     /**
      * @brief keeps reference to input sibling node
      */
     Node* inputNode = nullptr;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
+    /**
+     * @brief the axis the new state extends the state read by the input sibling along, if the new state
+     * is their concatenation
+     */
+    int appendAxis = -1;
 };
 
 class MemoryInput : public Input, public MemoryNode {
@@ -97,14 +113,57 @@ public:
         return true;
     }
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
+    // the output shape follows the shape of the attached state
+    bool needShapeInfer() const override {
+        return isDynamicNode();
+    }
 
     void createPrimitive() override;
 
     void setInputNode(Node* node) override {}
     void storeState(const Memory& mem);
-    MemoryPtr getStore();
+    void appendState(const Memory& mem, size_t axis);
+
+    MemoryDescPtr getStateDesc() const {
+        return getBaseMemDescAtOutputPort(0);
+    }
+    /**
+     * @brief Returns the dimensions of the default state: the shape of the initializing subgraph if it is static
+     * (e.g. empty past keys and values), the lower bounds of the state dimensions otherwise
+     */
+    VectorDims getDefaultStateDims() const;
+    const VectorDims& getStateDims() const {
+        return state->getDims();
+    }
+    /**
+     * @brief Attaches the variable state of an infer request for the duration of the inference
+     * @param newState the state to attach, the default state of the node is attached if nullptr
+     */
+    void attachState(std::shared_ptr<VariableState> newState);
+
+    /**
+     * @brief Binds the memory of the ReadValue output and of the Assign input to a pair of state buffers,
+     * so the state is neither copied on read nor on write
+     * @param readMemMngr memory manager of the ReadValue output memory
+     * @param writeMemMngr memory manager of the paired Assign input memory
+     */
+    void bindStateBuffers(DnnlMemoryMngrPtr readMemMngr, DnnlMemoryMngrPtr writeMemMngr);
+    /**
+     * @brief Makes the state written by the last inference current. Is called after each inference
+     * for the nodes with the bound state buffers.
+     */
+    void swapStateBuffers();
+
  private:
-    MemoryPtr dataStore;
+    void updateStateBuffersBinding();
+
+    std::shared_ptr<VariableState> defaultState;
+    std::shared_ptr<VariableState> state;
+    DnnlMemoryMngrPtr readMemMngr;
+    DnnlMemoryMngrPtr writeMemMngr;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
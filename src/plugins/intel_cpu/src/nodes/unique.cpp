@@ -2,9 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cstring>
+#include <numeric>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "ie_parallel.hpp"
 #include "unique.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
@@ -162,6 +167,250 @@ void Unique::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
+namespace {
+
+// Elements per bucket below which the parallel processing doesn't pay off.
+constexpr size_t minBucketLen = 4096;
+
+template <typename T>
+struct IndexedElement {
+    T val;
+    int32_t idx;
+};
+
+size_t getBucketsNum(size_t len) {
+    return std::max(std::min(static_cast<size_t>(parallel_get_max_threads()), len / minBucketLen), size_t(1));
+}
+
+// Distributes the elements between the buckets, every bucket keeps the order of the input.
+// bucketStarts gets bucketsNum + 1 offsets of the buckets in elems.
+template <typename T, typename BucketOf>
+void partitionToBuckets(const T* src, size_t len, size_t bucketsNum, const BucketOf& bucketOf,
+                        std::vector<IndexedElement<T>>& elems, std::vector<size_t>& bucketStarts) {
+    // the input is split into as many chunks as there are buckets
+    const int chunksNum = static_cast<int>(bucketsNum);
+    std::vector<size_t> offsets(chunksNum * bucketsNum, 0lu);
+
+    parallel_for(chunksNum, [&](const int chunk) {
+        size_t start = 0lu, end = 0lu;
+        splitter(len, chunksNum, chunk, start, end);
+        auto* counts = offsets.data() + chunk * bucketsNum;
+        for (size_t i = start; i < end; i++) {
+            counts[bucketOf(src[i])]++;
+        }
+    });
+
+    bucketStarts.resize(bucketsNum + 1);
+    size_t offset = 0lu;
+    for (size_t b = 0; b < bucketsNum; b++) {
+        bucketStarts[b] = offset;
+        for (int t = 0; t < chunksNum; t++) {
+            const auto count = offsets[t * bucketsNum + b];
+            offsets[t * bucketsNum + b] = offset;
+            offset += count;
+        }
+    }
+    bucketStarts[bucketsNum] = offset;
+
+    elems.resize(len);
+    parallel_for(chunksNum, [&](const int chunk) {
+        size_t start = 0lu, end = 0lu;
+        splitter(len, chunksNum, chunk, start, end);
+        auto* positions = offsets.data() + chunk * bucketsNum;
+        for (size_t i = start; i < end; i++) {
+            elems[positions[bucketOf(src[i])]++] = {src[i], static_cast<int32_t>(i)};
+        }
+    });
+}
+
+// The order of the sorted outputs: NaN is greater than any number. NaN isn't equal to itself, so every NaN is unique,
+// the NaNs follow the numbers in the input order.
+template <typename T>
+bool lessNaNLast(const T& val1, const T& val2) {
+    const bool isNaN1 = val1 != val1;
+    const bool isNaN2 = val2 != val2;
+    return !isNaN1 && (isNaN2 || val1 < val2);
+}
+
+// Sample sort: the buckets are ranges of values, so every bucket is sorted and deduplicated independently.
+template <typename T>
+size_t sortedUnique(const T* src, size_t len, T* uniq, int32_t* first, int32_t* inToOut, int32_t* occur) {
+    const size_t bucketsNum = getBucketsNum(len);
+
+    std::vector<T> splitters;
+    if (bucketsNum > 1) {
+        const size_t samplesNum = std::min(len, bucketsNum * 64);
+        std::vector<T> samples(samplesNum);
+        for (size_t i = 0; i < samplesNum; i++) {
+            samples[i] = src[i * len / samplesNum];
+        }
+        std::sort(samples.begin(), samples.end(), lessNaNLast<T>);
+        for (size_t b = 1; b < bucketsNum; b++) {
+            splitters.push_back(samples[b * samplesNum / bucketsNum]);
+        }
+    }
+    auto bucketOf = [&](const T& val) {
+        return std::upper_bound(splitters.begin(), splitters.end(), val, lessNaNLast<T>) - splitters.begin();
+    };
+
+    std::vector<IndexedElement<T>> elems;
+    std::vector<size_t> bucketStarts;
+    partitionToBuckets(src, len, bucketsNum, bucketOf, elems, bucketStarts);
+
+    std::vector<size_t> uniqOffsets(bucketsNum + 1, 0lu);
+    parallel_for(bucketsNum, [&](size_t b) {
+        auto begin = elems.begin() + bucketStarts[b];
+        auto end = elems.begin() + bucketStarts[b + 1];
+        std::sort(begin, end, [](const IndexedElement<T>& el1, const IndexedElement<T>& el2) {
+            return lessNaNLast(el1.val, el2.val) || (!lessNaNLast(el2.val, el1.val) && el1.idx < el2.idx);
+        });
+        size_t uniqNum = 0lu;
+        for (auto it = begin; it != end; it++) {
+            if (it == begin || !(it->val == (it - 1)->val)) {
+                uniqNum++;
+            }
+        }
+        uniqOffsets[b + 1] = uniqNum;
+    });
+    std::partial_sum(uniqOffsets.begin(), uniqOffsets.end(), uniqOffsets.begin());
+
+    parallel_for(bucketsNum, [&](size_t b) {
+        int64_t u = static_cast<int64_t>(uniqOffsets[b]) - 1;
+        for (size_t i = bucketStarts[b]; i < bucketStarts[b + 1]; i++) {
+            const auto& el = elems[i];
+            if (i == bucketStarts[b] || !(el.val == elems[i - 1].val)) {
+                u++;
+                uniq[u] = el.val;
+                if (first) {
+                    // the equal values are ordered by the index
+                    first[u] = el.idx;
+                }
+                if (occur) {
+                    occur[u] = 0;
+                }
+            }
+            if (occur) {
+                occur[u]++;
+            }
+            if (inToOut) {
+                inToOut[el.idx] = static_cast<int32_t>(u);
+            }
+        }
+    });
+
+    return uniqOffsets[bucketsNum];
+}
+
+template <typename T>
+uint64_t hashOf(T val) {
+    uint32_t bits = 0;
+    if (std::is_floating_point<T>::value) {
+        // +0 and -0 are equal
+        if (val == T(0))
+            val = T(0);
+        std::memcpy(&bits, &val, sizeof(T));
+    } else {
+        bits = static_cast<uint32_t>(val);
+    }
+    return static_cast<uint64_t>(bits) * 0x9E3779B97F4A7C15ull;
+}
+
+// The buckets are the ranges of the hash values, every bucket finds its unique values with the own open addressing
+// table. The unique values are ordered by the first occurrence by the prefix sum over the input.
+template <typename T>
+size_t hashedUnique(const T* src, size_t len, T* uniq, int32_t* first, int32_t* inToOut, int32_t* occur) {
+    const size_t bucketsNum = getBucketsNum(len);
+    // the high bits of the hash select the bucket, the low bits select the slot of the table
+    auto bucketOf = [&](const T& val) {
+        return static_cast<size_t>((hashOf(val) >> 32) % bucketsNum);
+    };
+
+    std::vector<IndexedElement<T>> elems;
+    std::vector<size_t> bucketStarts;
+    partitionToBuckets(src, len, bucketsNum, bucketOf, elems, bucketStarts);
+
+    // the unique id of the element in its bucket
+    std::vector<int32_t> localIds(len);
+    // the first occurrences of the unique values, later their position in the output
+    std::vector<int32_t> ranks(len, 0);
+    std::vector<std::vector<int32_t>> bucketFirsts(bucketsNum);
+    std::vector<std::vector<int32_t>> bucketCounts(bucketsNum);
+
+    parallel_for(bucketsNum, [&](size_t b) {
+        const size_t bucketLen = bucketStarts[b + 1] - bucketStarts[b];
+        size_t tableSize = 16lu;
+        while (tableSize < 2 * bucketLen)
+            tableSize *= 2;
+        const uint64_t mask = tableSize - 1;
+        std::vector<int32_t> table(tableSize, -1);
+
+        auto& firsts = bucketFirsts[b];
+        auto& counts = bucketCounts[b];
+        for (size_t i = bucketStarts[b]; i < bucketStarts[b + 1]; i++) {
+            const auto& el = elems[i];
+            uint64_t slot = hashOf(el.val) & mask;
+            int32_t id = table[slot];
+            while (id >= 0 && !(src[firsts[id]] == el.val)) {
+                slot = (slot + 1) & mask;
+                id = table[slot];
+            }
+            if (id < 0) {
+                // the elements of the bucket go in the input order, so the first one found is the first occurrence
+                id = static_cast<int32_t>(firsts.size());
+                table[slot] = id;
+                firsts.push_back(el.idx);
+                counts.push_back(0);
+                ranks[el.idx] = 1;
+            }
+            counts[id]++;
+            localIds[i] = id;
+        }
+    });
+
+    const int chunksNum = static_cast<int>(bucketsNum);
+    std::vector<int32_t> chunkOffsets(chunksNum + 1, 0);
+    parallel_for(chunksNum, [&](const int chunk) {
+        size_t start = 0lu, end = 0lu;
+        splitter(len, chunksNum, chunk, start, end);
+        chunkOffsets[chunk + 1] = std::accumulate(ranks.begin() + start, ranks.begin() + end, 0);
+    });
+    std::partial_sum(chunkOffsets.begin(), chunkOffsets.end(), chunkOffsets.begin());
+    parallel_for(chunksNum, [&](const int chunk) {
+        size_t start = 0lu, end = 0lu;
+        splitter(len, chunksNum, chunk, start, end);
+        int32_t rank = chunkOffsets[chunk];
+        for (size_t i = start; i < end; i++) {
+            if (ranks[i]) {
+                ranks[i] = rank++;
+            }
+        }
+    });
+
+    parallel_for(bucketsNum, [&](size_t b) {
+        const auto& firsts = bucketFirsts[b];
+        const auto& counts = bucketCounts[b];
+        for (size_t id = 0; id < firsts.size(); id++) {
+            const auto u = ranks[firsts[id]];
+            uniq[u] = src[firsts[id]];
+            if (first) {
+                first[u] = firsts[id];
+            }
+            if (occur) {
+                occur[u] = counts[id];
+            }
+        }
+        if (inToOut) {
+            for (size_t i = bucketStarts[b]; i < bucketStarts[b + 1]; i++) {
+                inToOut[elems[i].idx] = ranks[firsts[localIds[i]]];
+            }
+        }
+    });
+
+    return chunkOffsets[chunksNum];
+}
+
+}   // namespace
+
 template <typename T>
 void Unique::flattenTensorExec() {
     const T* srcDataPtr = reinterpret_cast<const T*>(getParentEdgeAt(IN_DATA)->getMemoryPtr()->GetPtr());
@@ -178,87 +427,11 @@ void Unique::flattenTensorExec() {
     if (definedOutputs[OCCURRENCES_NUM]) {
         occurTmpPtr = occurTmp.data();
     }
-    uniqueLen = inputLen;
 
     if (sorted) {
-        std::memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        auto last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        uniqueLen = last - uniDataTmpPtr;
-
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (int i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
-                }
-            }
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (int i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
-                }
-                for (int j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
-                    }
-                }
-            }
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (int j = 0; j < uniqueLen; j++) {
-                for (int i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
-                }
-            }
-        }
+        uniqueLen = sortedUnique(srcDataPtr, inputLen, uniDataTmpPtr, firstTmpPtr, inToOutTmpPtr, occurTmpPtr);
     } else {
-        uniDataTmpPtr[0] = srcDataPtr[0];
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            firstTmpPtr[0] = 0;
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            inToOutTmpPtr[0] = 0;
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + inputLen, 1);
-        }
-        uniqueLen = 1;
-
-        for (int i = 1; i < inputLen; i++) {
-            bool found = false;
-            int j = 0;
-            for (; j < uniqueLen; j++) {
-                if (uniDataTmpPtr[j] == srcDataPtr[i]) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                uniDataTmpPtr[uniqueLen] = srcDataPtr[i];
-                if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                    firstTmpPtr[uniqueLen] = i;
-                }
-                uniqueLen++;
-            } else {
-                if (definedOutputs[OCCURRENCES_NUM]) {
-                    occurTmpPtr[j]++;
-                }
-            }
-            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-                inToOutTmpPtr[i] = j;
-            }
-        }
+        uniqueLen = hashedUnique(srcDataPtr, inputLen, uniDataTmpPtr, firstTmpPtr, inToOutTmpPtr, occurTmpPtr);
     }
 
     redefineOutputMemory({ {uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
@@ -324,12 +497,12 @@ void Unique::slicedTensorExec() {
     uniqueLen = 1;
     std::vector<int64_t> uniqIdx(cmpBlNum, 0);
     for (int b1 = 1; b1 < cmpBlNum; b1++) {
-        auto first1 = srcDataPtr + b1 * elPerPart;
-        auto last1 = srcDataPtr + (b1 + 1) * elPerPart;
         bool equal = true;
         int b2 = 0;
         // Compare with unique blocks.
         for (; b2 < uniqueLen; b2++) {
+            auto first1 = srcDataPtr + b1 * elPerPart;
+            auto last1 = srcDataPtr + (b1 + 1) * elPerPart;
             auto first2 = srcDataPtr + uniqIdx[b2] * elPerPart;
             equal = true;
             for (int p = 0; p < partsInBl; p++) {
@@ -373,103 +546,49 @@ void Unique::slicedTensorExec() {
     }
 
     if (sorted) {
-        const auto elInBl = elPerPart * partsInBl;
-        struct OrdEl {
-            T val;
-            int64_t idx;
+        // the unique slices are ordered lexicographically, the equivalent ones (with NaNs) keep the first occurrence order
+        auto sliceLess = [&](int64_t u1, int64_t u2) {
+            for (int64_t p = 0; p < partsInBl; p++) {
+                const auto first1 = uniDataTmpPtr + p * dstPrtStep + u1 * elPerPart;
+                const auto first2 = uniDataTmpPtr + p * dstPrtStep + u2 * elPerPart;
+                for (int64_t e = 0; e < elPerPart; e++) {
+                    if (lessNaNLast(first1[e], first2[e]))
+                        return true;
+                    if (lessNaNLast(first2[e], first1[e]))
+                        return false;
+                }
+            }
+            return false;
         };
+        std::vector<int64_t> order(uniqueLen);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), sliceLess);
 
-        std::vector<OrdEl> colToSort(uniqueLen);
+        std::vector<T> sortedData(dstPrtStep * partsInBl);
         std::vector<int64_t> moveTo(uniqueLen);
-        for (int k = 0; k < uniqueLen; k++) {
-            moveTo[k] = k;
+        for (size_t k = 0; k < uniqueLen; k++) {
+            moveTo[order[k]] = k;
+            for (int64_t p = 0; p < partsInBl; p++) {
+                memcpy(sortedData.data() + p * dstPrtStep + k * elPerPart, uniDataTmpPtr + p * dstPrtStep + order[k] * elPerPart, partLenB);
+            }
         }
-        std::vector<T> buff1(elPerPart);
-        std::vector<T> buff2(elPerPart);
-        for (int64_t p = partsInBl - 1; p >= 0; p--) {
-            for (int64_t e = elPerPart - 1; e >= 0 ; e--) {
-                int64_t pos1 = p * dstPrtStep + e;
-                for (int64_t i = 0; i < uniqueLen; i++) {
-                    int64_t pos2 = i * elInBl + pos1;
-                    colToSort[i] = {uniDataTmpPtr[pos2], i};
-                }
-                std::stable_sort(colToSort.begin(), colToSort.end(), [](const OrdEl &el1, const OrdEl &el2) { return el1.val < el2.val; });
-                for (int k = 0; k < uniqueLen; k++) {
-                    moveTo[colToSort[k].idx] = k;
-                }
-
-                // perm
-                for (int64_t pb = 0; pb < partsInBl; pb++) {
-                    auto currDst = uniDataTmpPtr + pb * dstPrtStep;
-                    memcpy(buff1.data(), currDst, partLenB);
-                    auto dstIdx = moveTo[0];
-                    for (int64_t b = 0; b < uniqueLen; b++) {
-                        if (dstIdx == moveTo[dstIdx]) {
-                            dstIdx = moveTo[dstIdx + 1];
-                            continue;
-                        }
-                        T* dst = currDst + dstIdx * elPerPart;
-
-                        auto& bSrc = b % 2 == 0 ? buff1 : buff2;
-                        auto& bDst = b % 2 == 0 ? buff2 : buff1;
-                        memcpy(bDst.data(), dst, partLenB);
-                        memcpy(dst, bSrc.data(), partLenB);
-
-                        dstIdx = moveTo[dstIdx];
-                    }
-                }
+        memcpy(uniDataTmpPtr, sortedData.data(), sortedData.size() * sizeof(T));
 
-                auto mPos = moveTo[0];
-                int32_t firstSrc = 0, firstDst = 0, ocSrc = 0, ocDst = 0;
-                if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                    firstSrc = firstTmpPtr[0];
-                }
-                if (definedOutputs[OCCURRENCES_NUM]) {
-                    ocSrc = occurTmpPtr[0];
-                }
-                for (int k = 0; k < uniqueLen; k++) {
-                    if (mPos == moveTo[mPos]) {
-                        mPos = moveTo[mPos + 1];
-                        continue;
-                    }
-
-                    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                        auto& fSrc = k % 2 == 0 ? firstSrc : firstDst;
-                        auto& fDst = k % 2 == 0 ? firstDst : firstSrc;
-                        fDst = firstTmpPtr[mPos];
-                        firstTmpPtr[mPos] = fSrc;
-                    }
-                    if (definedOutputs[OCCURRENCES_NUM]) {
-                        auto& oSrc = k % 2 == 0 ? ocSrc : ocDst;
-                        auto& oDst = k % 2 == 0 ? ocDst : ocSrc;
-                        oDst = occurTmpPtr[mPos];
-                        occurTmpPtr[mPos] = oSrc;
-                    }
-
-                    mPos = moveTo[mPos];
-                }
+        auto permute = [&](int32_t* values) {
+            const std::vector<int32_t> unsorted(values, values + uniqueLen);
+            for (size_t k = 0; k < uniqueLen; k++) {
+                values[k] = unsorted[order[k]];
             }
+        };
+        if (definedOutputs[FIRST_UNIQUE_IDX]) {
+            permute(firstTmpPtr);
+        }
+        if (definedOutputs[OCCURRENCES_NUM]) {
+            permute(occurTmpPtr);
         }
-
         if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (int b1 = 0; b1 < cmpBlNum; b1++) {
-                auto first1 = srcDataPtr + b1 * elPerPart;
-                auto last1 = srcDataPtr + (b1 + 1) * elPerPart;
-                bool equal = true;
-                for (int b2 = 0; b2 < uniqueLen; b2++) {
-                    auto first2 = uniDataTmpPtr + b2 * elPerPart;
-                    equal = true;
-                    for (int p = 0; p < partsInBl; p++) {
-                        equal = std::equal(first1, last1, first2);
-                        if (!equal) {
-                            break;
-                        }
-                        first2 += dstPrtStep;
-                    }
-                    if (equal) {
-                        inToOutTmpPtr[b1] = b2;
-                    }
-                }
+            for (size_t b1 = 0; b1 < cmpBlNum; b1++) {
+                inToOutTmpPtr[b1] = static_cast<int32_t>(moveTo[inToOutTmpPtr[b1]]);
             }
         }
     }
@@ -144,6 +144,7 @@ Engine::~Engine() {
     executorManager()->clear("CPU");
     executorManager()->clear("CPUStreamsExecutor");
     executorManager()->clear("CPUCallbackExecutor");
+    executorManager()->clear("CPUPreparationExecutor");
 }
 
 static bool streamsSet(const std::map<std::string, std::string>& config) {
@@ -708,7 +709,7 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
     CNNNetworkDeserializer deserializer(networkModel,
         [this](const std::string& model, const Blob::CPtr& weights) {
             return GetCore()->ReadNetwork(model, weights, true);
-        });
+        }, GetVersion().buildNumber);
 
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
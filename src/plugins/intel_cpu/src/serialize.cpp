@@ -4,8 +4,10 @@
 #include "serialize.h"
 
 #include <openvino/pass/serialize.hpp>
+#include "node.h"
 
 #include <pugixml.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
 
 using namespace InferenceEngine;
 
@@ -41,6 +43,86 @@ namespace {
         IE_THROW(NetworkNotRead) << "Unknown layout with name '" << name << "'";
     }
 
+    std::string host_isa() {
+        return std::to_string(static_cast<uint64_t>(dnnl::impl::cpu::x64::get_max_cpu_isa()));
+    }
+
+    // Passes the implementations selected when the blob was exported to the nodes of the imported network, so they
+    // enumerate only the primitive descriptors of these implementations (see Node::exportedImplType).
+    // Hints are applied only if the blob was produced by the same plugin build on a host with the same ISA,
+    // otherwise the primitives are selected from scratch as for a regular compilation.
+    void setCompiledPrimitives(const pugi::xml_node& compiled, const std::string& buildNumber,
+                               InferenceEngine::CNNNetwork& network) {
+        if (!compiled)
+            return;
+        if (host_isa() != compiled.attribute("isa").value() ||
+            buildNumber != compiled.attribute("build").value())
+            return;
+
+        std::unordered_map<std::string, std::string> primitives;
+        for (const auto& node : compiled.children("node")) {
+            primitives.emplace(node.attribute("name").value(), node.attribute("impl").value());
+        }
+
+        for (const auto& op : network.getFunction()->get_ops()) {
+            auto it = primitives.find(op->get_friendly_name());
+            if (it != primitives.end()) {
+                op->get_rt_info()[EXPORTED_IMPL_TYPE] = it->second;
+            }
+        }
+    }
+
+    // The header of the reordered weights, which follow the network in the exported blob
+    struct WeightsHeader {
+        uint64_t magic;
+        uint64_t xml_size;
+        uint64_t data_size;
+    };
+    constexpr uint64_t weightsMagic = 0x0053544847494557;  // "WEIGHTS"
+
+    // Passes the weights reordered when the blob was exported to the nodes of the imported network, under the same
+    // guard as the implementations: the layouts of the weights depend on the ISA and on the plugin build.
+    void setCompiledWeights(std::istream& istream, const std::string& buildNumber, InferenceEngine::CNNNetwork& network) {
+        const auto offset = istream.tellg();
+        WeightsHeader hdr = {};
+        if (!istream.read(reinterpret_cast<char*>(&hdr), sizeof hdr) || hdr.magic != weightsMagic) {
+            // the blob doesn't contain the weights
+            istream.clear();
+            istream.seekg(offset);
+            return;
+        }
+
+        std::string xmlString(hdr.xml_size, '\0');
+        istream.read(&xmlString[0], hdr.xml_size);
+        pugi::xml_document xmlDoc;
+        if (xmlDoc.load_string(xmlString.c_str()).status != pugi::status_ok) {
+            IE_THROW(NetworkNotRead) << "The reordered weights information is invalid.";
+        }
+        pugi::xml_node root = xmlDoc.child("weights");
+        if (host_isa() != root.attribute("isa").value() ||
+            buildNumber != root.attribute("build").value()) {
+            istream.seekg(hdr.data_size, std::ios::cur);
+            return;
+        }
+
+        std::unordered_map<std::string, ExportedWeights> weights;
+        for (const auto& node : root.children("node")) {
+            auto data = std::make_shared<std::vector<uint8_t>>(std::stoull(node.attribute("size").value()));
+            istream.read(reinterpret_cast<char*>(data->data()), data->size());
+            weights[node.attribute("name").value()].emplace(node.attribute("key").value(), std::move(data));
+        }
+        if (!istream) {
+            IE_THROW(NetworkNotRead) << "The reordered weights are invalid.";
+        }
+
+        for (const auto& op : network.getFunction()->get_ops()) {
+            auto it = weights.find(op->get_friendly_name());
+            if (it != weights.end()) {
+                op->get_rt_info()[EXPORTED_WEIGHTS] = it->second;
+            }
+        }
+    }
+
     template <typename T>
     void setInfo(pugi::xml_object_range<pugi::xml_named_node_iterator>&& nodes, T&& info) {
         auto nodes_it = nodes.begin();
@@ -61,9 +143,14 @@ namespace {
     }
 };  // namespace
 
-CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager)
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager,
+                                           std::string buildNumber, CompiledPrimitives primitives,
+                                           CompiledWeights weights)
     : _ostream(ostream)
-    , _extensionManager(extensionManager) {
+    , _extensionManager(extensionManager)
+    , _buildNumber(std::move(buildNumber))
+    , _primitives(std::move(primitives))
+    , _weights(std::move(weights)) {
 }
 
 void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
@@ -109,6 +196,17 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
                     .set_value(to_string(out.second->getLayout()).c_str());
         }
 
+        if (!_primitives.empty()) {
+            pugi::xml_node compiled = root.append_child("compiled");
+            compiled.append_attribute("isa").set_value(host_isa().c_str());
+            compiled.append_attribute("build").set_value(_buildNumber.c_str());
+            for (const auto & primitive : _primitives) {
+                auto node = compiled.append_child("node");
+                node.append_attribute("name").set_value(primitive.first.c_str());
+                node.append_attribute("impl").set_value(primitive.second.c_str());
+            }
+        }
+
         xml_doc.save(stream);
     };
 
@@ -117,11 +215,41 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
     ov::pass::StreamSerialize serializer(_ostream, getCustomOpSets(), serializeInputsAndOutputs);
     OPENVINO_SUPPRESS_DEPRECATED_END
     serializer.run_on_model(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
+
+    if (!_weights.empty()) {
+        pugi::xml_document xml_doc;
+        pugi::xml_node root = xml_doc.append_child("weights");
+        root.append_attribute("isa").set_value(host_isa().c_str());
+        root.append_attribute("build").set_value(_buildNumber.c_str());
+        std::vector<MemoryCPtr> data;
+        size_t data_size = 0;
+        for (const auto & node : _weights) {
+            for (const auto & weights : node.second) {
+                auto weights_node = root.append_child("node");
+                weights_node.append_attribute("name").set_value(node.first.c_str());
+                weights_node.append_attribute("key").set_value(weights.first.c_str());
+                weights_node.append_attribute("size").set_value(std::to_string(weights.second->GetSize()).c_str());
+                data.push_back(weights.second);
+                data_size += weights.second->GetSize();
+            }
+        }
+        std::stringstream xml;
+        xml_doc.save(xml);
+        const auto xml_string = xml.str();
+
+        const WeightsHeader hdr = {weightsMagic, xml_string.size(), data_size};
+        _ostream.write(reinterpret_cast<const char*>(&hdr), sizeof hdr);
+        _ostream.write(xml_string.c_str(), xml_string.size());
+        for (const auto & memory : data) {
+            _ostream.write(static_cast<const char*>(memory->GetPtr()), memory->GetSize());
+        }
+    }
 }
 
-CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn)
+CNNNetworkDeserializer::CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn, std::string buildNumber)
     : _istream(istream)
-    , _cnn_network_builder(fn) {
+    , _cnn_network_builder(fn)
+    , _buildNumber(std::move(buildNumber)) {
 }
 
 void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network) {
@@ -166,6 +294,8 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
 
     setInfo(inputs.children("in"), network.getInputsInfo());
     setInfo(outputs.children("out"), network.getOutputsInfo());
+    setCompiledPrimitives(root.child("compiled"), _buildNumber, network);
+    setCompiledWeights(_istream, _buildNumber, network);
 }
 
 }   // namespace intel_cpu
@@ -3,22 +3,43 @@
 //
 #pragma once
 #include "extension_mngr.h"
+#include "cpu_memory.h"
 
 #include <iostream>
 #include <functional>
+#include <string>
+#include <unordered_map>
 #include <cpp/ie_cnn_network.h>
 
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief Implementation types selected for the nodes of a compiled graph (node name -> impl type name).
+ * Stored in the exported blob together with the host ISA and plugin build, so that on a compatible host the
+ * nodes of the imported graph enumerate only the implementations chosen at compile time.
+ */
+using CompiledPrimitives = std::unordered_map<std::string, std::string>;
+
+/**
+ * @brief Weights reordered by the nodes of a compiled graph (node name -> precision and memory format -> weights).
+ * Stored after the network in the exported blob under the same host ISA and plugin build guard, so that on a
+ * compatible host the nodes of the imported graph copy them instead of reordering the original weights.
+ */
+using CompiledWeights = std::unordered_map<std::string, std::unordered_map<std::string, MemoryCPtr>>;
+
 class CNNNetworkSerializer {
 public:
-    CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager);
+    CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager,
+                         std::string buildNumber = {}, CompiledPrimitives primitives = {}, CompiledWeights weights = {});
     void operator << (const InferenceEngine::CNNNetwork & network);
 
 private:
     std::ostream & _ostream;
     ExtensionManager::Ptr _extensionManager;
+    std::string _buildNumber;
+    CompiledPrimitives _primitives;
+    CompiledWeights _weights;
 };
 
 class CNNNetworkDeserializer {
@@ -27,12 +48,13 @@ public:
                 InferenceEngine::CNNNetwork(
                         const std::string&,
                         const InferenceEngine::Blob::CPtr&)> cnn_network_builder;
-    CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
+    CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn, std::string buildNumber = {});
     void operator >> (InferenceEngine::CNNNetwork & network);
 
 private:
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
+    std::string _buildNumber;
 };
 
 // const std::string& model, const Blob::CPtr& weights
@@ -87,12 +87,14 @@
 
 // CPU specific transformations
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/color_convert_normalize_fusion.hpp"
 #include "ngraph_transformations/snippets_mark_skipped.hpp"
 #include "ngraph_transformations/mha_fusion.hpp"
 #include "ngraph_transformations/convert_to_interaction.hpp"
 #include "ngraph_transformations/convert_fq_rnn_to_quantized_rnn.hpp"
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
 #include "ngraph_transformations/swap_convert_transpose.hpp"
+#include "ngraph_transformations/mark_weights_decompression.hpp"
 
 // Snippets
 #include "snippets/pass/tokenization.hpp"
@@ -180,10 +182,16 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     ov::pass::Manager manager;
     manager.set_per_pass_validation(false);
     manager.register_pass<ov::pass::InitNodeInfo>();
+    // before the preprocessing chain is changed by the common transformations or is marked as dequantization
+    if (config.colorConvertNormalizeFusion)
+        manager.register_pass<ColorConvertNormalizeFusion>();
 
     const bool useLpt = !defaultPrecisions.empty();
     if (useLpt) {
         manager.register_pass<ov::pass::MarkDequantizationSubgraph>(defaultPrecisions);
+    } else if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
+        // FullyConnected decompresses int8 / int4 weights on the fly, so they aren't folded to fp32
+        manager.register_pass<MarkWeightsDecompression>();
     }
 
     auto get_convert_precisions = []() {
@@ -619,6 +627,16 @@ void Transformations::MainSnippets(void) {
                                                                        return ov::is_type<ov::op::v0::Constant>(
                                                                                in.get_source_output().get_node_shared_ptr());
                                                                    });
+                    // weights decompression subgraph is fused into FullyConnected
+                    auto is_weights_decompression = [](std::shared_ptr<const ov::Node> node) {
+                        while (ov::is_type<const ov::op::v1::Subtract>(node) || ov::is_type<const ov::op::v1::Multiply>(node)) {
+                            if (!ov::is_type<ov::op::v0::Constant>(node->get_input_node_shared_ptr(1)))
+                                return false;
+                            node = node->get_input_node_shared_ptr(0);
+                        }
+                        return ov::is_type<const ov::op::v0::Convert>(node) &&
+                               ov::is_type<ov::op::v0::Constant>(node->get_input_node_shared_ptr(0));
+                    };
                     // todo: clarify whether we can evaluate snippets on inputs with larger ranks
                     auto rank_is_too_large = [](const ov::descriptor::Tensor& t) {
                         // callback is called has_supported_in_out(), so it's safe to assume that the shapes are static
@@ -634,7 +652,7 @@ void Transformations::MainSnippets(void) {
                                                                  return rank_is_too_large(out.get_tensor());
                                                              });
                     return has_only_const_inputs || bad_input_rank || bad_output_rank || is_unsupported_swish ||
-                           is_disabled_tokenization;
+                           is_disabled_tokenization || is_weights_decompression(n);
                 });
     }
     snippetsManager.run_passes(model);
@@ -4,13 +4,31 @@
 
 #include "weights_cache.hpp"
 
+#include "ie_parallel.hpp"
+#include "openvino/util/xxhash.hpp"
 #include <ie_system_conf.h>
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
 
-const SimpleDataHash WeightsSharing::simpleCRC;
+uint64_t SimpleDataHash::hash(const unsigned char* data, size_t size) const {
+    if (size <= kChunkSize)
+        return ov::util::xxhash64(data, size, 0);
+
+    const size_t chunks = (size + kChunkSize - 1) / kChunkSize;
+    std::vector<uint64_t> chunkHashes(chunks);
+    parallel_for(chunks, [&](size_t i) {
+        const size_t offset = i * kChunkSize;
+        chunkHashes[i] = ov::util::xxhash64(data + offset, std::min(kChunkSize, size - offset), i);
+    });
+
+    return ov::util::xxhash64(chunkHashes.data(), chunkHashes.size() * sizeof(uint64_t), static_cast<uint64_t>(size));
+}
+
+const SimpleDataHash WeightsSharing::simpleHash;
 
 WeightsSharing::SharedMemory::SharedMemory(
         std::unique_lock<std::mutex> && lock,
@@ -71,6 +89,19 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+size_t WeightsSharing::getTotalSize() const {
+    size_t totalSize = 0;
+    std::unique_lock<std::mutex> lock(guard);
+    for (const auto& item : sharedWeights) {
+        if (!item.second)
+            continue;
+        if (auto memory = item.second->sharedMemory.lock()) {
+            totalSize += memory->getDesc().getCurrentMemSize();
+        }
+    }
+    return totalSize;
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<WeightsSharing>();
@@ -90,5 +121,19 @@ const WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const {
     return found->second;
 }
 
+const WeightsSharing::Ptr& NumaNodesWeights::front() const {
+    if (_cache_map.empty())
+        IE_THROW() << "No numa nodes are available";
+    return _cache_map.begin()->second;
+}
+
+std::map<int, size_t> NumaNodesWeights::getTotalSizePerNode() const {
+    std::map<int, size_t> result;
+    for (const auto& item : _cache_map) {
+        result[item.first] = item.second ? item.second->getTotalSize() : 0;
+    }
+    return result;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -23,28 +23,18 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * Fast non-cryptographic hash of the weights data used to build WeightsSharing keys.
+ * The data is split into fixed size chunks which are hashed in parallel by an xxHash64-like
+ * function (4 independent 64-bit lanes per 32 byte stripe), then the chunk hashes are combined.
+ * The result depends only on the data, not on the number of threads.
+ */
 class SimpleDataHash {
 public:
-    SimpleDataHash() {
-        for (int i = 0; i < kTableSize; i++) {
-            uint64_t c = i;
-            for (int j = 0; j < 8; j++)
-                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
-            table[i] = c;
-        }
-    }
-    // Computes 64-bit "cyclic redundancy check" sum, as specified in ECMA-182
-    uint64_t hash(const unsigned char* data, size_t size) const {
-        uint64_t crc = 0;
-        for (size_t idx = 0; idx < size; idx++)
-            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
-
-        return ~crc;
-    }
+    uint64_t hash(const unsigned char* data, size_t size) const;
 
 protected:
-    static constexpr int kTableSize = 256;
-    uint64_t table[kTableSize];
+    static constexpr size_t kChunkSize = 1 << 20;
 };
 
 /**
@@ -94,12 +84,17 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
-    static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
+    /**
+     * @brief Returns the total size in bytes of the alive memory objects stored in the cache
+     */
+    size_t getTotalSize() const;
+
+    static const SimpleDataHash& GetHashFunc () { return simpleHash; }
 
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
-    static const SimpleDataHash simpleCRC;
+    static const SimpleDataHash simpleHash;
 };
 
 /**
@@ -114,6 +109,16 @@ public:
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
 
+    /**
+     * @brief Returns the memory caching store of the first available NUMA node, used when the weights are not replicated
+     */
+    const WeightsSharing::Ptr& front() const;
+
+    /**
+     * @brief Returns the total size in bytes of the weights cached per NUMA node id
+     */
+    std::map<int, size_t> getTotalSizePerNode() const;
+
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
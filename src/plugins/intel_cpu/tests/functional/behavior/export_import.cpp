@@ -6,6 +6,7 @@
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
+#include <exec_graph_info.hpp>
 #include "common_test_utils/test_common.hpp"
 #include "ngraph_functions/builders.hpp"
 
@@ -13,6 +14,9 @@
 #include <openvino/opsets/opset9.hpp>
 #include <ie/ie_core.hpp>
 
+#include <algorithm>
+#include <cstring>
+
 namespace {
 
 class ExportImportTest : public CommonTestUtils::TestsCommon {};
@@ -62,4 +66,68 @@ TEST(ExportImportTest, ExportOptimalNumStreams) {
         EXPECT_EQ(nstreams_latency_original, nstreams_latency_imported);
     }
 }
+
+TEST(ExportImportTest, ImportKeepsSelectedPrimitives) {
+    auto original_model = MakeMatMulModel();
+    std::string deviceName = "CPU";
+    ov::Core core;
+
+    auto getPrimitiveTypes = [](const ov::CompiledModel& compiled_model) {
+        std::map<std::string, std::string> primitive_types;
+        for (const auto& op : compiled_model.get_runtime_model()->get_ops()) {
+            const auto& rt_info = op->get_rt_info();
+            auto it = rt_info.find(ExecGraphInfoSerialization::IMPL_TYPE);
+            if (it != rt_info.end())
+                primitive_types[op->get_friendly_name()] = it->second.as<std::string>();
+        }
+        return primitive_types;
+    };
+
+    auto original_network = core.compile_model(original_model, deviceName);
+    std::stringstream exported_stream;
+    original_network.export_model(exported_stream);
+
+    auto imported_network = core.import_model(exported_stream, deviceName);
+    EXPECT_EQ(getPrimitiveTypes(original_network), getPrimitiveTypes(imported_network));
+}
+
+TEST(ExportImportTest, ImportUsesReorderedWeights) {
+    auto original_model = MakeMatMulModel();
+    std::string deviceName = "CPU";
+    ov::Core core;
+
+    auto infer = [](ov::CompiledModel& compiled_model, const ov::Tensor& input) {
+        auto request = compiled_model.create_infer_request();
+        request.set_input_tensor(input);
+        request.infer();
+        const auto output = request.get_output_tensor();
+        const auto data = output.data<float>();
+        return std::vector<float>(data, data + output.get_size());
+    };
+
+    auto original_network = core.compile_model(original_model, deviceName);
+    std::stringstream exported_stream;
+    original_network.export_model(exported_stream);
+
+    std::stringstream ss(exported_stream.str());
+    auto imported_network = core.import_model(ss, deviceName);
+
+    ov::Tensor input(ov::element::f32, {1, 4096});
+    std::fill_n(input.data<float>(), input.get_size(), 0.01f);
+    EXPECT_EQ(infer(original_network, input), infer(imported_network, input));
+
+    // the reordered weights follow the network in the blob, the imported FullyConnected copies them instead of
+    // reordering the weights of the network, so zeroing them changes the results
+    auto blob = exported_stream.str();
+    const auto weights_offset = blob.find(std::string("WEIGHTS\0", 8));
+    ASSERT_NE(std::string::npos, weights_offset);
+    uint64_t header[3];  // magic, xml size, weights size
+    std::memcpy(header, &blob[weights_offset], sizeof(header));
+    ASSERT_GT(header[2], 0u);
+    std::fill_n(blob.begin() + weights_offset + sizeof(header) + header[1], header[2], '\0');
+
+    std::stringstream zeroed_stream(blob);
+    auto zeroed_network = core.import_model(zeroed_stream, deviceName);
+    EXPECT_NE(infer(original_network, input), infer(zeroed_network, input));
+}
 }  // namespace
@@ -9,6 +9,9 @@
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "openvino/opsets/opset1.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 
 #include <gtest/gtest.h>
 
@@ -113,6 +116,130 @@ TEST_F(OVClassConfigTestCPU, smoke_CheckModelStreamsHasHigherPriorityThanThrough
     ASSERT_EQ(streams, value);
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CheckMemoryPlanForUpperBoundedShapes) {
+    ov::Core ie;
+
+    auto param = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, {1, 512}, 64});
+    auto relu = std::make_shared<ov::opset1::Relu>(param);
+    auto scale = ov::opset1::Constant::create(ov::element::f32, {1}, {2.f});
+    auto mul = std::make_shared<ov::opset1::Multiply>(relu, scale);
+    auto softmax = std::make_shared<ov::opset1::Softmax>(mul, 2);
+    auto sigmoid = std::make_shared<ov::opset1::Sigmoid>(softmax);
+    auto boundedModel = std::make_shared<ov::Model>(ov::NodeVector{sigmoid}, ov::ParameterVector{param});
+
+    ov::CompiledModel compiledModel = ie.compile_model(boundedModel, deviceName);
+    std::map<std::string, uint64_t> stats;
+    ASSERT_NO_THROW(stats = compiledModel.get_property(ov::intel_cpu::memory_plan_statistics));
+
+    ASSERT_EQ(0u, stats.at("unbounded_tensors"));
+    ASSERT_LT(0u, stats.at("upper_bounded_tensors"));
+    ASSERT_LE(stats.at("planned_bytes"), stats.at("naive_bytes"));
+
+    // the workspace is preallocated, so any shape within the bounds is inferred without reallocation
+    auto inferRequest = compiledModel.create_infer_request();
+    for (size_t len : std::vector<size_t>{1, 512, 17}) {
+        inferRequest.set_input_tensor(ov::Tensor(ov::element::f32, {1, len, 64}));
+        ASSERT_NO_THROW(inferRequest.infer());
+        ASSERT_EQ((ov::Shape{1, len, 64}), inferRequest.get_output_tensor().get_shape());
+    }
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CheckWeightsNumaPolicy) {
+    ov::Core ie;
+    using namespace InferenceEngine;
+
+    for (const auto& policy : {PluginConfigInternalParams::REPLICATE,
+                               PluginConfigInternalParams::REPLICATE_ON_FIRST_USE,
+                               PluginConfigInternalParams::SINGLE_NODE}) {
+        ov::AnyMap config = {ov::num_streams(2), {PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY, policy}};
+        ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, config);
+        auto inferRequest = compiledModel.create_infer_request();
+        ASSERT_NO_THROW(inferRequest.infer());
+
+        std::map<std::string, uint64_t> sizes;
+        ASSERT_NO_THROW(sizes = compiledModel.get_property(ov::intel_cpu::weights_size_per_numa_node)) << policy;
+        uint64_t totalSize = 0;
+        for (const auto& item : sizes) {
+            totalSize += item.second;
+        }
+        ASSERT_LT(0u, totalSize) << policy;
+    }
+
+    ov::AnyMap config = {{PluginConfigInternalParams::KEY_CPU_WEIGHTS_NUMA_POLICY, "INTERLEAVE"}};
+    ASSERT_THROW(ie.compile_model(model, deviceName, config), ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CheckConstantsInPlace) {
+    ov::Core ie;
+    using namespace InferenceEngine;
+
+    const size_t K = 256, N = 128;
+    const size_t weightsSize = K * N * sizeof(float);
+    auto param = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, K});
+    auto weights = ov::opset1::Constant::create(ov::element::f32, ov::Shape{K, N}, std::vector<float>(K * N, 0.5f));
+    auto matMul = std::make_shared<ov::opset1::MatMul>(param, weights);
+    auto matMulModel = std::make_shared<ov::Model>(ov::NodeVector{matMul}, ov::ParameterVector{param});
+
+    auto getSizes = [&](const ov::AnyMap& config) {
+        ov::CompiledModel compiledModel = ie.compile_model(matMulModel, deviceName, config);
+        auto inferRequest = compiledModel.create_infer_request();
+        inferRequest.infer();
+        return std::make_pair(compiledModel.get_property(ov::intel_cpu::shared_weights_size),
+                              compiledModel.get_property(ov::intel_cpu::private_weights_size));
+    };
+
+    // the weights are copied to the weights cache of the NUMA node by default
+    auto sizes = getSizes({ov::num_streams(2)});
+    ASSERT_EQ(0u, sizes.first);
+    ASSERT_LE(weightsSize, sizes.second);
+
+    sizes = getSizes({ov::num_streams(2), {PluginConfigInternalParams::KEY_CPU_CONSTANTS_IN_PLACE, PluginConfigParams::YES}});
+    ASSERT_LE(weightsSize, sizes.first);
+
+    // there is no weights cache for a single stream, so the constants are used in place anyway
+    sizes = getSizes({ov::num_streams(1)});
+    ASSERT_LE(weightsSize, sizes.first);
+
+    ov::AnyMap config = {{PluginConfigInternalParams::KEY_CPU_CONSTANTS_IN_PLACE, "MAYBE"}};
+    ASSERT_THROW(ie.compile_model(matMulModel, deviceName, config), ov::Exception);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CheckAdaptiveStreams) {
+    ov::Core ie;
+    using namespace InferenceEngine;
+
+    for (const auto& adaptive : {PluginConfigParams::NO, PluginConfigParams::YES}) {
+        ov::AnyMap config = {ov::num_streams(2), {PluginConfigInternalParams::KEY_CPU_ADAPTIVE_STREAMS, adaptive}};
+        ov::CompiledModel compiledModel = ie.compile_model(model, deviceName, config);
+        std::vector<ov::InferRequest> inferRequests;
+        for (size_t i = 0; i < 4; i++) {
+            inferRequests.push_back(compiledModel.create_infer_request());
+        }
+        for (size_t iteration = 0; iteration < 10; iteration++) {
+            for (auto& inferRequest : inferRequests) {
+                inferRequest.start_async();
+            }
+            for (auto& inferRequest : inferRequests) {
+                ASSERT_NO_THROW(inferRequest.wait()) << adaptive;
+            }
+        }
+
+        std::map<std::string, uint64_t> streamsInfo;
+        ASSERT_NO_THROW(streamsInfo = compiledModel.get_property(ov::intel_cpu::streams_info)) << adaptive;
+        ASSERT_EQ(2u, streamsInfo["max_streams"]) << adaptive;
+        ASSERT_LE(1u, streamsInfo["streams"]) << adaptive;
+        ASSERT_GE(2u, streamsInfo["streams"]) << adaptive;
+        ASSERT_EQ(streamsInfo["streams"], streamsInfo["main_core_streams"] + streamsInfo["efficient_core_streams"]);
+        if (adaptive == PluginConfigParams::NO) {
+            ASSERT_EQ(2u, streamsInfo["streams"]);
+            ASSERT_EQ(0u, streamsInfo["adaptations"]);
+        }
+    }
+
+    ov::AnyMap config = {{PluginConfigInternalParams::KEY_CPU_ADAPTIVE_STREAMS, "MAYBE"}};
+    ASSERT_THROW(ie.compile_model(model, deviceName, config), ov::Exception);
+}
+
 const std::vector<ov::AnyMap> multiDevicePriorityConfigs = {
         {ov::device::priorities(CommonTestUtils::DEVICE_CPU)}};
 
@@ -2,11 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cmath>
+#include <random>
 #include <string>
 #include <sstream>
 #include <vector>
 
 #include <openvino/core/partial_shape.hpp>
+#include <openvino/pass/constant_folding.hpp>
 #include "ngraph_functions/builders.hpp"
 #include "shared_test_classes/base/layer_test_utils.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
@@ -77,10 +80,15 @@ public:
         selectedType = makeSelectedTypeStr("ref", inType);
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
-        init_input_shapes({ inputShapes });
-
-        auto emb_table_node = std::make_shared<ngraph::opset1::Parameter>(inType, inputShapes.first);
-        ngraph::ParameterVector params = {emb_table_node};
+        std::shared_ptr<ngraph::Node> emb_table_node;
+        ngraph::ParameterVector params;
+        if (constantTable) {
+            emb_table_node = ngraph::builder::makeConstant<float>(inType, inputShapes.second.front(), {}, true);
+        } else {
+            init_input_shapes({ inputShapes });
+            params.push_back(std::make_shared<ngraph::opset1::Parameter>(inType, inputShapes.first));
+            emb_table_node = params.front();
+        }
 
         auto embBag = std::dynamic_pointer_cast<ngraph::opset3::EmbeddingBagOffsetsSum>(ngraph::builder::makeEmbeddingBagOffsetsSum(
             inType,
@@ -91,9 +99,22 @@ public:
             defaultIndex,
             withWeights,
             withDefIndex));
-        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(embBag)};
+        std::shared_ptr<ngraph::Node> output = embBag;
+        if (constantTable) {
+            // the bags of the constant table are computed by the plugin and added to the model input
+            ov::pass::disable_constant_folding(embBag);
+            const auto& outShape = embBag->get_output_shape(0);
+            init_input_shapes({ InputShape{outShape, {outShape}} });
+            params.push_back(std::make_shared<ngraph::opset1::Parameter>(inType, outShape));
+            output = std::make_shared<ngraph::opset1::Add>(embBag, params.back());
+        }
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(output)};
         function = std::make_shared<ngraph::Function>(results, params, "embeddingBagOffsetsSum");
     }
+
+protected:
+    // the constant table is kept in BF16 by the plugin, the Parameter one is converted to FP32
+    bool constantTable = false;
 };
 
 TEST_P(EmbeddingBagOffsetsSumLayerCPUTest, CompareWithRefs) {
@@ -101,6 +122,19 @@ TEST_P(EmbeddingBagOffsetsSumLayerCPUTest, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, "embeddingBagOffsetsSum");
 }
 
+class EmbeddingBagOffsetsSumConstTableLayerCPUTest : public EmbeddingBagOffsetsSumLayerCPUTest {
+protected:
+    void SetUp() override {
+        constantTable = true;
+        EmbeddingBagOffsetsSumLayerCPUTest::SetUp();
+    }
+};
+
+TEST_P(EmbeddingBagOffsetsSumConstTableLayerCPUTest, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "embeddingBagOffsetsSum");
+}
+
 namespace {
 
 const std::vector<ElementType> netPrecisions = {
@@ -163,5 +197,46 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagOffsetsSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
+
+// The rows of a large table picked by power-law distributed indices, the bags have very different sizes
+std::vector<size_t> generateSkewedIndices(size_t count, size_t rows) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    std::vector<size_t> result(count);
+    for (auto& index : result)
+        index = std::min(rows - 1, static_cast<size_t>(rows * std::pow(dist(gen), 4.0)));
+    return result;
+}
+
+// the rows of 300 elements end with a tail shorter than the vector, the rows of 512 elements are whole vectors
+const std::vector<InputShape> large_table_shapes = {
+        {{1000, 3, 100}, {{1000, 3, 100}}},
+        {{1000, 4, 128}, {{1000, 4, 128}}},
+};
+
+const auto embBagOffsetSumSkewedArgSet = ::testing::Combine(
+        ::testing::ValuesIn(large_table_shapes),
+        ::testing::Values(generateSkewedIndices(64, 1000)),
+        ::testing::Values(std::vector<size_t>{0, 1, 1, 40, 41, 43, 60}),
+        ::testing::Values(0),
+        ::testing::ValuesIn(with_weights),
+        ::testing::ValuesIn(with_default_index)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_SkewedBags, EmbeddingBagOffsetsSumLayerCPUTest,
+        ::testing::Combine(
+                embBagOffsetSumSkewedArgSet,
+                ::testing::Values(ElementType::f32, ElementType::bf16),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_SkewedBags, EmbeddingBagOffsetsSumConstTableLayerCPUTest,
+        ::testing::Combine(
+                embBagOffsetSumSkewedArgSet,
+                ::testing::Values(ElementType::f32, ElementType::bf16),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
@@ -7,6 +7,7 @@
 #include <vector>
 
 #include <openvino/core/partial_shape.hpp>
+#include <openvino/pass/constant_folding.hpp>
 #include "ngraph_functions/builders.hpp"
 #include "shared_test_classes/base/layer_test_utils.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
@@ -70,10 +71,15 @@ protected:
         selectedType = makeSelectedTypeStr("ref", inType);
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
-        init_input_shapes({ inputShapes });
-
-        auto emb_table_node = std::make_shared<ngraph::opset1::Parameter>(inType, inputShapes.first);
-        ngraph::ParameterVector params = {emb_table_node};
+        std::shared_ptr<ngraph::Node> emb_table_node;
+        ngraph::ParameterVector params;
+        if (constantTable) {
+            emb_table_node = ngraph::builder::makeConstant<float>(inType, inputShapes.second.front(), {}, true);
+        } else {
+            init_input_shapes({ inputShapes });
+            params.push_back(std::make_shared<ngraph::opset1::Parameter>(inType, inputShapes.first));
+            emb_table_node = params.front();
+        }
 
         auto embBag = std::dynamic_pointer_cast<ngraph::opset3::EmbeddingBagPackedSum>(ngraph::builder::makeEmbeddingBagPackedSum(
             inType,
@@ -81,9 +87,21 @@ protected:
             emb_table_node,
             indices,
             withWeights));
-        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(embBag)};
+        std::shared_ptr<ngraph::Node> output = embBag;
+        if (constantTable) {
+            // the bags of the constant table are computed by the plugin and added to the model input
+            ov::pass::disable_constant_folding(embBag);
+            const auto& outShape = embBag->get_output_shape(0);
+            init_input_shapes({ InputShape{outShape, {outShape}} });
+            params.push_back(std::make_shared<ngraph::opset1::Parameter>(inType, outShape));
+            output = std::make_shared<ngraph::opset1::Add>(embBag, params.back());
+        }
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(output)};
         function = std::make_shared<ngraph::Function>(results, params, "embeddingBagPackedSum");
     }
+
+    // the constant table is kept in BF16 by the plugin, the Parameter one is converted to FP32
+    bool constantTable = false;
 };
 
 TEST_P(EmbeddingBagPackedSumLayerCPUTest, CompareWithRefs) {
@@ -91,6 +109,19 @@ TEST_P(EmbeddingBagPackedSumLayerCPUTest, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, "embeddingBagPackedSum");
 }
 
+class EmbeddingBagPackedSumConstTableLayerCPUTest : public EmbeddingBagPackedSumLayerCPUTest {
+protected:
+    void SetUp() override {
+        constantTable = true;
+        EmbeddingBagPackedSumLayerCPUTest::SetUp();
+    }
+};
+
+TEST_P(EmbeddingBagPackedSumConstTableLayerCPUTest, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "embeddingBagPackedSum");
+}
+
 namespace {
 
 const std::vector<ElementType> netPrecisions = {
@@ -147,5 +178,29 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagPackedSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
+
+// the rows of 300 elements end with a tail shorter than the vector, the rows of 512 elements are whole vectors
+const auto embBagPackedSumLargeTableArgSet = ::testing::Combine(
+        ::testing::Values(InputShape{{1000, 3, 100}, {{1000, 3, 100}}},
+                          InputShape{{1000, 4, 128}, {{1000, 4, 128}}}),
+        ::testing::Values(std::vector<std::vector<size_t>>{{0, 999, 5, 17, 5}, {500, 3, 3, 42, 998}, {1, 2, 998, 7, 0}}),
+        ::testing::ValuesIn(with_weights)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_LargeTable, EmbeddingBagPackedSumLayerCPUTest,
+        ::testing::Combine(
+                embBagPackedSumLargeTableArgSet,
+                ::testing::Values(ElementType::f32, ElementType::bf16),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_LargeTable, EmbeddingBagPackedSumConstTableLayerCPUTest,
+        ::testing::Combine(
+                embBagPackedSumLargeTableArgSet,
+                ::testing::Values(ElementType::f32, ElementType::bf16),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
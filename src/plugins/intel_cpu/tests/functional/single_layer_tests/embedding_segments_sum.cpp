@@ -7,6 +7,7 @@
 #include <vector>
 
 #include <openvino/core/partial_shape.hpp>
+#include <openvino/pass/constant_folding.hpp>
 #include "ngraph_functions/builders.hpp"
 #include "shared_test_classes/base/layer_test_utils.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
@@ -80,10 +81,15 @@ protected:
         selectedType = makeSelectedTypeStr("ref", inType);
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
-        init_input_shapes({ inputShapes });
-
-        auto emb_table_node = std::make_shared<ngraph::opset1::Parameter>(inType, inputShapes.first);
-        ngraph::ParameterVector params = {emb_table_node};
+        std::shared_ptr<ngraph::Node> emb_table_node;
+        ngraph::ParameterVector params;
+        if (constantTable) {
+            emb_table_node = ngraph::builder::makeConstant<float>(inType, inputShapes.second.front(), {}, true);
+        } else {
+            init_input_shapes({ inputShapes });
+            params.push_back(std::make_shared<ngraph::opset1::Parameter>(inType, inputShapes.first));
+            emb_table_node = params.front();
+        }
 
         auto embBag = std::dynamic_pointer_cast<ngraph::opset3::EmbeddingSegmentsSum>(ngraph::builder::makeEmbeddingSegmentsSum(
             inType,
@@ -95,9 +101,21 @@ protected:
             defaultIndex,
             withWeights,
             withDefIndex));
-        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(embBag)};
+        std::shared_ptr<ngraph::Node> output = embBag;
+        if (constantTable) {
+            // the bags of the constant table are computed by the plugin and added to the model input
+            ov::pass::disable_constant_folding(embBag);
+            const auto& outShape = embBag->get_output_shape(0);
+            init_input_shapes({ InputShape{outShape, {outShape}} });
+            params.push_back(std::make_shared<ngraph::opset1::Parameter>(inType, outShape));
+            output = std::make_shared<ngraph::opset1::Add>(embBag, params.back());
+        }
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(output)};
         function = std::make_shared<ngraph::Function>(results, params, "embeddingSegmentsSum");
     }
+
+    // the constant table is kept in BF16 by the plugin, the Parameter one is converted to FP32
+    bool constantTable = false;
 };
 
 TEST_P(EmbeddingSegmentsSumLayerCPUTest, CompareWithRefs) {
@@ -105,6 +123,19 @@ TEST_P(EmbeddingSegmentsSumLayerCPUTest, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, "embeddingSegmentsSum");
 }
 
+class EmbeddingSegmentsSumConstTableLayerCPUTest : public EmbeddingSegmentsSumLayerCPUTest {
+protected:
+    void SetUp() override {
+        constantTable = true;
+        EmbeddingSegmentsSumLayerCPUTest::SetUp();
+    }
+};
+
+TEST_P(EmbeddingSegmentsSumConstTableLayerCPUTest, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "embeddingSegmentsSum");
+}
+
 namespace {
 const std::vector<ElementType> netPrecisions = {
         ElementType::f32,
@@ -168,5 +199,33 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingSegmentsSumLayerCPUTest,
          ::testing::ValuesIn(indPrecisions),
          ::testing::Values(CommonTestUtils::DEVICE_CPU)),
          EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
+
+// the rows of 300 elements end with a tail shorter than the vector, the rows of 512 elements are whole vectors
+const auto embSegmentsSumLargeTableArgSet = ::testing::Combine(
+    ::testing::Values(InputShape{{1000, 3, 100}, {{1000, 3, 100}}},
+                      InputShape{{1000, 4, 128}, {{1000, 4, 128}}}),
+    ::testing::Values(std::vector<size_t>{0, 999, 5, 17, 500, 3, 3, 42, 998}),
+    ::testing::Values(std::vector<size_t>{0, 0, 0, 2, 2, 3, 3, 3, 3}),
+    ::testing::Values(5),
+    ::testing::Values(0),
+    ::testing::ValuesIn(with_weights),
+    ::testing::ValuesIn(with_default_index)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_LargeTable, EmbeddingSegmentsSumLayerCPUTest,
+     ::testing::Combine(
+         embSegmentsSumLargeTableArgSet,
+         ::testing::Values(ElementType::f32, ElementType::bf16),
+         ::testing::Values(ElementType::i32),
+         ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+         EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_LargeTable, EmbeddingSegmentsSumConstTableLayerCPUTest,
+     ::testing::Combine(
+         embSegmentsSumLargeTableArgSet,
+         ::testing::Values(ElementType::f32, ElementType::bf16),
+         ::testing::Values(ElementType::i32),
+         ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+         EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
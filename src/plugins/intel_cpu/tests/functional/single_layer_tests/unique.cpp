@@ -7,6 +7,11 @@
 #include "test_utils/cpu_test_utils.hpp"
 #include <common_test_utils/ov_tensor_utils.hpp>
 
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
 using namespace CPUTestUtils;
 using namespace ov::test;
 
@@ -135,6 +140,211 @@ TEST_P(UniqueLayerTestCPU, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, "Unique");
 }
 
+static std::vector<double> toDoubles(const ov::Tensor& tensor) {
+    std::vector<double> values(tensor.get_size());
+    switch (tensor.get_element_type()) {
+        case ov::element::Type_t::f64:
+            std::copy_n(tensor.data<double>(), values.size(), values.begin());
+            break;
+        case ov::element::Type_t::f32:
+            std::copy_n(tensor.data<float>(), values.size(), values.begin());
+            break;
+        case ov::element::Type_t::i64:
+            std::copy_n(tensor.data<int64_t>(), values.size(), values.begin());
+            break;
+        case ov::element::Type_t::i32:
+            std::copy_n(tensor.data<int32_t>(), values.size(), values.begin());
+            break;
+        case ov::element::Type_t::i8:
+            std::copy_n(tensor.data<int8_t>(), values.size(), values.begin());
+            break;
+        default:
+            throw std::runtime_error("Unexpected element type " + tensor.get_element_type().get_type_name());
+    }
+    return values;
+}
+
+// Large inputs of few unique values: the elements, or the slices along the axis, repeat with a short period. The float
+// inputs contain NaNs and both signs of zero. The reference implementation doesn't define the order of NaNs, so the
+// expected outputs are calculated by the test: every NaN is unique as it isn't equal to itself, -0 and +0 are equal,
+// the sorted unique values are in the ascending order followed by the NaNs.
+class UniqueLargeLayerTestCPU : public UniqueLayerTestCPU {
+protected:
+    // The input is [outer, axis, inner], the slices along the axis are compared (the single elements if flattened)
+    void getSlices(const ov::Shape& shape, size_t& outer, size_t& axisLen, size_t& inner) const {
+        const auto& flatOrAxis = std::get<1>(GetParam());
+        if (std::get<0>(flatOrAxis)) {
+            outer = 1lu;
+            axisLen = ov::shape_size(shape);
+            inner = 1lu;
+            return;
+        }
+        const auto axis = std::get<1>(flatOrAxis) < 0 ? std::get<1>(flatOrAxis) + shape.size() : std::get<1>(flatOrAxis);
+        outer = std::accumulate(shape.begin(), shape.begin() + axis, 1lu, std::multiplies<size_t>());
+        axisLen = shape[axis];
+        inner = std::accumulate(shape.begin() + axis + 1, shape.end(), 1lu, std::multiplies<size_t>());
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInput = function->inputs()[0];
+        const auto& shape = targetInputStaticShapes[0];
+        size_t outer = 0lu, axisLen = 0lu, inner = 0lu;
+        getSlices(shape, outer, axisLen, inner);
+        const size_t period = std::get<0>(std::get<1>(GetParam())) ? 1000lu : 4lu;
+        const bool isFloat = funcInput.get_element_type() == ElementType::f32;
+
+        ov::Tensor tensor(funcInput.get_element_type(), shape);
+        for (size_t o = 0; o < outer; o++) {
+            for (size_t s = 0; s < axisLen; s++) {
+                for (size_t k = 0; k < inner; k++) {
+                    const size_t key = s % period;
+                    const size_t pos = o * inner + k;  // position in the slice
+                    float value = static_cast<float>(static_cast<int>((key * 7919 + pos * 31) % 251) - 125);
+                    if (isFloat && key == 1 && pos % 3 == 0) {
+                        value = std::numeric_limits<float>::quiet_NaN();
+                    } else if (isFloat && key == 2 && pos % 3 == 0) {
+                        value = (s / period) % 2 ? -0.f : 0.f;
+                    }
+
+                    const size_t idx = (o * axisLen + s) * inner + k;
+                    if (funcInput.get_element_type() == ElementType::f32) {
+                        tensor.data<float>()[idx] = value;
+                    } else if (funcInput.get_element_type() == ElementType::i32) {
+                        tensor.data<int32_t>()[idx] = static_cast<int32_t>(value);
+                    } else {
+                        tensor.data<int8_t>()[idx] = static_cast<int8_t>(value);
+                    }
+                }
+            }
+        }
+        inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+    }
+
+    std::vector<ov::Tensor> calculate_refs() override {
+        const auto& input = inputs.begin()->second;
+        const auto values = toDoubles(input);
+        size_t outer = 0lu, axisLen = 0lu, inner = 0lu;
+        getSlices(input.get_shape(), outer, axisLen, inner);
+        const size_t sliceLen = outer * inner;
+        auto at = [&](size_t slice, size_t pos) {
+            return values[((pos / inner) * axisLen + slice) * inner + pos % inner];
+        };
+
+        std::vector<size_t> firsts, inToOut(axisLen);
+        for (size_t s = 0; s < axisLen; s++) {
+            size_t u = 0;
+            for (; u < firsts.size(); u++) {
+                size_t pos = 0;
+                while (pos < sliceLen && at(firsts[u], pos) == at(s, pos))
+                    pos++;
+                if (pos == sliceLen)
+                    break;
+            }
+            if (u == firsts.size())
+                firsts.push_back(s);
+            inToOut[s] = u;
+        }
+
+        std::vector<size_t> order(firsts.size());
+        std::iota(order.begin(), order.end(), 0lu);
+        if (std::get<2>(GetParam())) {
+            auto less = [](double val1, double val2) {
+                return !std::isnan(val1) && (std::isnan(val2) || val1 < val2);
+            };
+            std::stable_sort(order.begin(), order.end(), [&](size_t u1, size_t u2) {
+                for (size_t pos = 0; pos < sliceLen; pos++) {
+                    if (less(at(firsts[u1], pos), at(firsts[u2], pos)))
+                        return true;
+                    if (less(at(firsts[u2], pos), at(firsts[u1], pos)))
+                        return false;
+                }
+                return false;
+            });
+        }
+        std::vector<size_t> outPos(order.size());
+        for (size_t k = 0; k < order.size(); k++)
+            outPos[order[k]] = k;
+
+        std::vector<double> uniqueData, firstIdx, inToOutIdx, counts(order.size(), 0.);
+        for (size_t o = 0; o < outer; o++) {
+            for (const auto u : order) {
+                for (size_t k = 0; k < inner; k++)
+                    uniqueData.push_back(at(firsts[u], o * inner + k));
+            }
+        }
+        for (const auto u : order)
+            firstIdx.push_back(static_cast<double>(firsts[u]));
+        for (size_t s = 0; s < axisLen; s++) {
+            inToOutIdx.push_back(static_cast<double>(outPos[inToOut[s]]));
+            counts[outPos[inToOut[s]]]++;
+        }
+
+        std::vector<ov::Tensor> refs;
+        for (const auto& ref : {uniqueData, firstIdx, inToOutIdx, counts}) {
+            ov::Tensor tensor(ov::element::f64, {ref.size()});
+            std::copy(ref.begin(), ref.end(), tensor.data<double>());
+            refs.push_back(tensor);
+        }
+        return refs;
+    }
+
+    void compare(const std::vector<ov::Tensor>& expected, const std::vector<ov::Tensor>& actual) override {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            const auto expectedValues = toDoubles(expected[i]);
+            const auto actualValues = toDoubles(actual[i]);
+            ASSERT_EQ(expectedValues.size(), actualValues.size()) << "output " << i;
+            for (size_t j = 0; j < expectedValues.size(); j++) {
+                ASSERT_TRUE(expectedValues[j] == actualValues[j] || (std::isnan(expectedValues[j]) && std::isnan(actualValues[j])))
+                    << "output " << i << " at " << j << ": expected " << expectedValues[j] << ", actual " << actualValues[j];
+            }
+        }
+    }
+};
+
+TEST_P(UniqueLargeLayerTestCPU, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckPluginRelatedResults(compiledModel, "Unique");
+}
+
+// Measures the latency of the flattened Unique over large inputs of few unique values with all the threads and with one
+TEST(UniqueBenchmarkCPU, DISABLED_Latency) {
+    ov::Core core;
+    for (const size_t len : {1lu << 16, 1lu << 20, 1lu << 24}) {
+        ov::Tensor input(ov::element::f32, {len});
+        for (size_t i = 0; i < len; i++) {
+            input.data<float>()[i] = static_cast<float>((i * 7919) % 1000);
+        }
+        for (const bool sorted : {true, false}) {
+            auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{len});
+            auto unique = std::make_shared<ov::op::v10::Unique>(param, sorted);
+            auto model = std::make_shared<ov::Model>(unique->outputs(), ov::ParameterVector{param});
+
+            auto latency = [&](const ov::AnyMap& config) {
+                auto compiled = core.compile_model(model, CommonTestUtils::DEVICE_CPU, config);
+                auto request = compiled.create_infer_request();
+                request.set_input_tensor(input);
+                request.infer();
+
+                const size_t iterations = 20;
+                const auto start = std::chrono::steady_clock::now();
+                for (size_t i = 0; i < iterations; i++) {
+                    request.infer();
+                }
+                const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                return elapsed / iterations;
+            };
+            const auto parallel = latency({});
+            const auto serial = latency({ov::inference_num_threads(1)});
+            std::cout << "elements " << len << ", sorted " << sorted << ", latency, ms: parallel " << parallel
+                      << ", one thread " << serial << ", speedup " << serial / parallel << std::endl;
+        }
+    }
+}
+
 namespace {
 
 const std::vector<ElementType> dataPrecisionSmoke = {
@@ -257,5 +467,22 @@ INSTANTIATE_TEST_SUITE_P(nightly_dynamic, UniqueLayerTestCPU,
                                  ::testing::ValuesIn(getCPUInfo()),
                                  ::testing::Values(additionalConfig[0])),
                          UniqueLayerTestCPU::getTestCaseName);
+
+const std::vector<std::vector<InputShape>> largeInShapes = {
+   { { {}, { {256, 256} } } },                                             // Static shapes
+   { { {}, { {64, 32, 32} } } },                                           // Static shapes
+   { { { -1, 256 },                                                        // Dynamic shape
+       { {256, 256}, {300, 256}, {256, 256} } } }                          // Target shapes
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_large, UniqueLargeLayerTestCPU,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(largeInShapes),
+                                 ::testing::ValuesIn(flatOrAxis),
+                                 ::testing::ValuesIn(sorted),
+                                 ::testing::Values(ElementType::f32, ElementType::i32, ElementType::i8),
+                                 ::testing::ValuesIn(getCPUInfo()),
+                                 ::testing::Values(additionalConfig[0])),
+                         UniqueLayerTestCPU::getTestCaseName);
 } // namespace
 } // namespace CPULayerTestsDefinitions
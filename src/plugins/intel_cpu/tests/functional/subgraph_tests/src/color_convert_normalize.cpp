@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <iostream>
+
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+#include "openvino/core/preprocess/pre_post_process.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+// The typical preprocessing of the video frame: NV12/I420 -> RGB/BGR -> f32 -> mean/scale -> NCHW,
+// the CPU plugin executes it as the single ColorConvert node
+using ColorConvertNormalizeParams = std::tuple<ov::preprocess::ColorFormat,  // source color format
+                                               ov::preprocess::ColorFormat,  // destination color format
+                                               bool,                         // convert to f32 before the color conversion
+                                               ov::Shape>;                   // NCHW shape of the model input
+
+class ColorConvertNormalizeCPUTest : public testing::WithParamInterface<ColorConvertNormalizeParams>,
+                                     virtual public SubgraphBaseTest,
+                                     public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ColorConvertNormalizeParams>& obj) {
+        ov::preprocess::ColorFormat srcFormat, dstFormat;
+        bool convertFirst;
+        ov::Shape shape;
+        std::tie(srcFormat, dstFormat, convertFirst, shape) = obj.param;
+        std::ostringstream result;
+        result << "src=" << static_cast<int>(srcFormat) << "_";
+        result << "dst=" << static_cast<int>(dstFormat) << "_";
+        result << "convertFirst=" << convertFirst << "_";
+        result << "IS=" << CommonTestUtils::vec2str(shape);
+        return result.str();
+    }
+
+    static std::shared_ptr<ov::Model> createModel(ov::preprocess::ColorFormat srcFormat,
+                                                  ov::preprocess::ColorFormat dstFormat,
+                                                  bool convertFirst,
+                                                  const ov::Shape& shape) {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto model = std::make_shared<ov::Model>(ov::OutputVector{param}, ov::ParameterVector{param}, "ColorConvertNormalize");
+
+        ov::preprocess::PrePostProcessor ppp(model);
+        ppp.input().tensor().set_element_type(ov::element::u8).set_color_format(srcFormat).set_layout("NHWC");
+        if (convertFirst)
+            ppp.input().preprocess().convert_element_type(ov::element::f32);
+        ppp.input().preprocess().convert_color(dstFormat);
+        if (!convertFirst)
+            ppp.input().preprocess().convert_element_type(ov::element::f32);
+        ppp.input().preprocess().mean({123.675f, 116.28f, 103.53f}).scale({58.395f, 57.12f, 57.375f});
+        ppp.input().model().set_layout("NCHW");
+        return ppp.build();
+    }
+
+protected:
+    void SetUp() override {
+        ov::preprocess::ColorFormat srcFormat, dstFormat;
+        bool convertFirst;
+        ov::Shape shape;
+        std::tie(srcFormat, dstFormat, convertFirst, shape) = this->GetParam();
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // the color conversion may use the different algorithms, the deviation is not increased by the scale
+        abs_threshold = 1.0f;
+
+        function = createModel(srcFormat, dstFormat, convertFirst, shape);
+        std::vector<ov::Shape> planeShapes;
+        for (const auto& param : function->get_parameters())
+            planeShapes.push_back(param->get_shape());
+        init_input_shapes(static_shapes_to_test_representation(planeShapes));
+    }
+};
+
+TEST_P(ColorConvertNormalizeCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "ColorConvert", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Transpose", 0);
+}
+
+// Measures the throughput of the preprocessing of the video frames fused into the single ColorConvert node and of the
+// same preprocessing executed by the separate nodes
+class ColorConvertNormalizeThroughputCPUTest : public ColorConvertNormalizeCPUTest {
+protected:
+    double framesPerSecond(bool fusion) {
+        ov::Core core;
+        auto compiled = core.compile_model(function, targetDevice,
+                                           {{PluginConfigInternalParams::KEY_CPU_COLOR_CONVERT_NORMALIZE_FUSION,
+                                             fusion ? PluginConfigParams::YES : PluginConfigParams::NO}});
+        auto request = compiled.create_infer_request();
+        request.infer();
+
+        const size_t iterations = 100;
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+            request.infer();
+        const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return iterations * 1000.0 / elapsed;
+    }
+};
+
+TEST_P(ColorConvertNormalizeThroughputCPUTest, DISABLED_Throughput) {
+    const auto fused = framesPerSecond(true);
+    const auto unfused = framesPerSecond(false);
+    std::cout << "frames per second: fused " << fused << ", unfused " << unfused
+              << ", speedup " << fused / unfused << std::endl;
+}
+
+namespace {
+
+using ov::preprocess::ColorFormat;
+
+const std::vector<ov::Shape> shapes = {
+    {1, 3, 16, 16},
+    {2, 3, 6, 34},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ColorConvertNormalize, ColorConvertNormalizeCPUTest,
+                         ::testing::Combine(::testing::Values(ColorFormat::NV12_SINGLE_PLANE, ColorFormat::NV12_TWO_PLANES,
+                                                              ColorFormat::I420_SINGLE_PLANE, ColorFormat::I420_THREE_PLANES),
+                                            ::testing::Values(ColorFormat::RGB, ColorFormat::BGR),
+                                            ::testing::Values(true, false),
+                                            ::testing::ValuesIn(shapes)),
+                         ColorConvertNormalizeCPUTest::getTestCaseName);
+
+const std::vector<ov::Shape> videoShapes = {
+    {1, 3, 720, 1280},
+    {1, 3, 1080, 1920},
+    {1, 3, 2160, 3840},
+};
+
+INSTANTIATE_TEST_SUITE_P(ColorConvertNormalizeVideo, ColorConvertNormalizeThroughputCPUTest,
+                         ::testing::Combine(::testing::Values(ColorFormat::NV12_TWO_PLANES),
+                                            ::testing::Values(ColorFormat::RGB),
+                                            ::testing::Values(false),
+                                            ::testing::ValuesIn(videoShapes)),
+                         ColorConvertNormalizeCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
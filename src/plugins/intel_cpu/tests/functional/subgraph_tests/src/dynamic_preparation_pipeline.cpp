@@ -0,0 +1,143 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <ngraph/opsets/opset7.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include <common_test_utils/ov_tensor_utils.hpp>
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ov::test;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+namespace {
+std::shared_ptr<ngraph::Node> makeDense(const ngraph::Output<ngraph::Node>& in, size_t inputSize, size_t outputSize) {
+    const auto ngPrc = ngraph::element::f32;
+    auto weights = ngraph::builder::makeConstant<float>(ngPrc, {inputSize, outputSize}, {}, true, 0.1f, -0.1f);
+    auto matMul = std::make_shared<ngraph::opset1::MatMul>(in, weights);
+    auto bias = ngraph::builder::makeConstant<float>(ngPrc, {outputSize}, {}, true, 0.1f, -0.1f);
+    return std::make_shared<ngraph::opset1::Add>(matMul, bias);
+}
+
+std::shared_ptr<ngraph::Node> makeLayerNorm(const ngraph::Output<ngraph::Node>& in) {
+    auto axes = ngraph::builder::makeConstant<int>(ngraph::element::i32, {1}, {-1});
+    return std::make_shared<ngraph::opset7::MVN>(in, axes, true, 1e-5f, ngraph::op::MVNEpsMode::INSIDE_SQRT);
+}
+
+// BERT-like encoder over [batch, sequence length, hidden size] input
+std::shared_ptr<ngraph::Function> makeEncoder(const ov::PartialShape& inputShape, size_t hidden, size_t heads, size_t layers) {
+    auto params = ngraph::builder::makeDynamicParams(ngraph::element::f32, {inputShape});
+    const size_t headSize = hidden / heads;
+    auto splitHeads = ngraph::builder::makeConstant<int>(ngraph::element::i32, {4},
+                                                         {0, 0, static_cast<int>(heads), static_cast<int>(headSize)});
+    auto mergeHeads = ngraph::builder::makeConstant<int>(ngraph::element::i32, {3}, {0, 0, static_cast<int>(hidden)});
+    auto toHeads = ngraph::builder::makeConstant<int>(ngraph::element::i32, {4}, {0, 2, 1, 3});
+    auto scale = ngraph::builder::makeConstant<float>(ngraph::element::f32, {1}, {1.f / std::sqrt(static_cast<float>(headSize))});
+
+    ngraph::Output<ngraph::Node> hiddenState = params[0];
+    for (size_t i = 0; i < layers; i++) {
+        auto attentionHead = [&](const ngraph::Output<ngraph::Node>& in) {
+            auto reshape = std::make_shared<ngraph::opset1::Reshape>(makeDense(in, hidden, hidden), splitHeads, true);
+            return std::make_shared<ngraph::opset1::Transpose>(reshape, toHeads);
+        };
+        auto query = attentionHead(hiddenState);
+        auto key = attentionHead(hiddenState);
+        auto value = attentionHead(hiddenState);
+        auto scores = std::make_shared<ngraph::opset1::MatMul>(query, key, false, true);
+        auto scaled = std::make_shared<ngraph::opset1::Multiply>(scores, scale);
+        auto probs = std::make_shared<ngraph::opset1::Softmax>(scaled, 3);
+        auto context = std::make_shared<ngraph::opset1::MatMul>(probs, value);
+        auto transpose = std::make_shared<ngraph::opset1::Transpose>(context, toHeads);
+        auto merged = std::make_shared<ngraph::opset1::Reshape>(transpose, mergeHeads, true);
+        auto attention = makeLayerNorm(std::make_shared<ngraph::opset1::Add>(makeDense(merged, hidden, hidden), hiddenState));
+
+        auto intermediate = std::make_shared<ngraph::opset7::Gelu>(makeDense(attention, hidden, 4 * hidden));
+        hiddenState = makeLayerNorm(std::make_shared<ngraph::opset1::Add>(makeDense(intermediate, 4 * hidden, hidden), attention));
+    }
+
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(hiddenState)};
+    return std::make_shared<ngraph::Function>(results, params, "dynamicEncoder");
+}
+} // namespace
+
+// The sequence length changes every inference, so the shapes and the params of the nodes are prepared every time,
+// either overlapped with each other (YES) or node by node (NO).
+using DynamicPreparationPipelineTestParams = std::string;
+
+class DynamicPreparationPipelineTest : public testing::WithParamInterface<DynamicPreparationPipelineTestParams>,
+                                       virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DynamicPreparationPipelineTestParams>& obj) {
+        std::ostringstream result;
+        result << "pipeline=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_DYNAMIC_PREPARATION_PIPELINE, GetParam()});
+
+        const std::vector<InputShape> inputShapes = {
+            {{1, -1, 64}, {{1, 10, 64}, {1, 33, 64}, {1, 10, 64}, {1, 17, 64}}}
+        };
+        init_input_shapes(inputShapes);
+        function = makeEncoder(inputDynamicShapes[0], 64, 4, 2);
+    }
+};
+
+TEST_P(DynamicPreparationPipelineTest, CompareWithRefs) {
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicPreparationPipeline, DynamicPreparationPipelineTest,
+                         ::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         DynamicPreparationPipelineTest::getTestCaseName);
+
+// Measures the latency of the BERT-base sized encoder, whose sequence length changes every inference, with the pipelined
+// and with the serial preparation of the nodes
+class DynamicPreparationPipelineBenchmarkTest : public testing::Test {
+protected:
+    double latency(const std::shared_ptr<ngraph::Function>& function, bool pipeline) {
+        ov::Core core;
+        auto compiled = core.compile_model(function, CommonTestUtils::DEVICE_CPU,
+                                           {{PluginConfigInternalParams::KEY_CPU_DYNAMIC_PREPARATION_PIPELINE,
+                                             pipeline ? PluginConfigParams::YES : PluginConfigParams::NO},
+                                            {PluginConfigInternalParams::KEY_CPU_SHAPES_PLAN_CACHE_CAPACITY, "0"}});
+        auto request = compiled.create_infer_request();
+
+        const size_t iterations = 100;
+        std::vector<ov::Tensor> inputs;
+        for (size_t i = 0; i < iterations; i++) {
+            inputs.push_back(utils::create_and_fill_tensor(ov::element::f32, {1, 16 + (i * 37) % 368, 768}));
+        }
+        request.set_input_tensor(inputs.back());
+        request.infer();
+
+        const auto start = std::chrono::steady_clock::now();
+        for (const auto& input : inputs) {
+            request.set_input_tensor(input);
+            request.infer();
+        }
+        const auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        return elapsed / iterations;
+    }
+};
+
+TEST_F(DynamicPreparationPipelineBenchmarkTest, DISABLED_Latency) {
+    const auto function = makeEncoder({1, -1, 768}, 768, 12, 12);
+    const auto pipelined = latency(function, true);
+    const auto serial = latency(function, false);
+    std::cout << "latency, ms: pipelined " << pipelined << ", serial " << serial
+              << ", speedup " << serial / pipelined << std::endl;
+}
+
+} // namespace SubgraphTestsDefinitions
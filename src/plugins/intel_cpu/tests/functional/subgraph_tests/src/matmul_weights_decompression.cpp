@@ -0,0 +1,140 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using MatMulWeightsDecompressionParams = std::tuple<SizeVector,        // input shape
+                                                    size_t,            // output channels
+                                                    size_t,            // group size, 0 for the scales per output channel
+                                                    element::Type,     // weights precision
+                                                    bool>;             // with zero points
+
+class MatMulWeightsDecompression : public testing::WithParamInterface<MatMulWeightsDecompressionParams>,
+                                   public CPUTestsBase,
+                                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatMulWeightsDecompressionParams> obj) {
+        SizeVector inputShape;
+        size_t outputChannels, groupSize;
+        element::Type weightsPrecision;
+        bool withZeroPoints;
+        std::tie(inputShape, outputChannels, groupSize, weightsPrecision, withZeroPoints) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OC=" << outputChannels << "_";
+        result << "groupSize=" << groupSize << "_";
+        result << "weightsPRC=" << weightsPrecision << "_";
+        result << "withZeroPoints=" << withZeroPoints;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        size_t OC, groupSize;
+        element::Type weightsPrecision;
+        bool withZeroPoints;
+        std::tie(inputShape, OC, groupSize, weightsPrecision, withZeroPoints) = this->GetParam();
+        const size_t IC = inputShape.back();
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+
+        const bool grouped = groupSize != 0;
+        // [IC, OC] weights with the scales per output channel or [OC, groups, group size] weights with the scales per group
+        const SizeVector weightsShape = grouped ? SizeVector{OC, IC / groupSize, groupSize} : SizeVector{IC, OC};
+        const SizeVector scalesShape = grouped ? SizeVector{OC, IC / groupSize, 1} : SizeVector{1, OC};
+        const bool isSigned = weightsPrecision == element::i8 || weightsPrecision == element::i4;
+        // the weights of the full 8 bits range aren't packed by FullyConnected into 4 bits
+        const int32_t maxValue = weightsPrecision.bitwidth() == 4 ? (isSigned ? 7 : 15) : (isSigned ? 127 : 255);
+        const int32_t minValue = isSigned ? -maxValue - 1 : 0;
+
+        const auto weightsData = NGraphFunctions::Utils::generateVector<element::Type_t::i32>(shape_size(weightsShape), maxValue, minValue);
+        auto weights = std::make_shared<opset1::Constant>(weightsPrecision, weightsShape, weightsData);
+        std::shared_ptr<Node> decompressed = std::make_shared<opset1::Convert>(weights, element::f32);
+        if (withZeroPoints) {
+            const float zeroPoint = isSigned ? 0.f : static_cast<float>(maxValue / 2);
+            auto zeroPoints = builder::makeConstant<float>(element::f32, scalesShape, {}, true, zeroPoint + 1.f, zeroPoint - 1.f);
+            decompressed = std::make_shared<opset1::Subtract>(decompressed, zeroPoints);
+        }
+        auto scales = builder::makeConstant<float>(element::f32, scalesShape, {}, true, 0.1f, 0.01f);
+        decompressed = std::make_shared<opset1::Multiply>(decompressed, scales);
+        if (grouped) {
+            auto shape = opset1::Constant::create(element::i64, Shape{2}, {OC, IC});
+            decompressed = std::make_shared<opset1::Reshape>(decompressed, shape, false);
+        }
+        auto matMul = builder::makeMatMul(params[0], decompressed, false, grouped);
+
+        function = makeNgraphFunction(element::f32, params, matMul, "MatMulWeightsDecompression");
+    }
+};
+
+/* The weights decompression subgraph is fused into FullyConnected, which keeps the weights in int8
+
+           Constant[U8 / I8 / U4 / I4]
+                    |
+               Convert[FP32]
+                    |
+      Subtract(zero points) (optional)
+                    |
+            Multiply(scales)
+                    |
+          Reshape (scales per group)
+                    |
+      Input         |
+          \         |
+           \        |
+             MatMul
+               |
+             Output
+*/
+
+TEST_P(MatMulWeightsDecompression, CompareWithRefs) {
+    Run();
+    CheckNumberOfNodesWithType(executableNetwork, "FullyConnected", 1);
+    CheckNumberOfNodesWithType(executableNetwork, "Convert", 0);
+    CheckNumberOfNodesWithType(executableNetwork, "Eltwise", 0);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression, MatMulWeightsDecompression,
+                         ::testing::Combine(::testing::Values(SizeVector{1, 64}, SizeVector{3, 5, 64}),
+                                            ::testing::Values(35, 64),
+                                            ::testing::Values(0, 16),
+                                            ::testing::Values(element::u8, element::i8),
+                                            ::testing::Values(true, false)),
+                         MatMulWeightsDecompression::getTestCaseName);
+
+// the activations with many rows are multiplied by oneDNN with the weights decompressed once
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression_LargeM, MatMulWeightsDecompression,
+                         ::testing::Combine(::testing::Values(SizeVector{80, 64}, SizeVector{2, 40, 64}),
+                                            ::testing::Values(35, 64),
+                                            ::testing::Values(0, 16),
+                                            ::testing::Values(element::u8, element::i8),
+                                            ::testing::Values(true, false)),
+                         MatMulWeightsDecompression::getTestCaseName);
+
+// the int4 weights are unpacked to int8 when the model is loaded
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression_4bit, MatMulWeightsDecompression,
+                         ::testing::Combine(::testing::Values(SizeVector{1, 64}, SizeVector{3, 5, 64}, SizeVector{80, 64}),
+                                            ::testing::Values(35),
+                                            ::testing::Values(0, 16),
+                                            ::testing::Values(element::u4, element::i4),
+                                            ::testing::Values(true, false)),
+                         MatMulWeightsDecompression::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
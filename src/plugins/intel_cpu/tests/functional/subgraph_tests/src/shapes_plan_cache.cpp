@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include <common_test_utils/ov_tensor_utils.hpp>
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace ov::test;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+
+// The input shapes are repeated to check that the output shapes resolved for the input shapes seen before are reused properly,
+// including the cases when the cache is disabled or has to evict the records.
+using ShapesPlanCacheTestParams = std::string;
+
+class ShapesPlanCacheTest : public testing::WithParamInterface<ShapesPlanCacheTestParams>, virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ShapesPlanCacheTestParams>& obj) {
+        std::ostringstream result;
+        result << "capacity=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_SHAPES_PLAN_CACHE_CAPACITY, GetParam()});
+
+        const std::vector<InputShape> inputShapes = {
+            {{-1, -1, 16}, {{1, 10, 16}, {2, 32, 16}, {1, 10, 16}, {4, 7, 16}, {2, 32, 16}, {1, 10, 16}}},
+            {{-1, 16, -1}, {{1, 16, 8}, {2, 16, 8}, {1, 16, 8}, {4, 16, 3}, {2, 16, 8}, {1, 16, 8}}}
+        };
+        init_input_shapes(inputShapes);
+
+        const auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+        auto matMul = std::make_shared<ngraph::opset1::MatMul>(inputParams[0], inputParams[1]);
+        auto addConst = ngraph::builder::makeConstant<float>(ngPrc, {1}, {}, true);
+        auto add = std::make_shared<ngraph::opset1::Add>(matMul, addConst);
+        auto softMax = std::make_shared<ngraph::opset1::Softmax>(add, 2);
+        auto reshapeConst = ngraph::builder::makeConstant<int>(ngraph::element::i32, {2}, {0, -1});
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(softMax, reshapeConst, true);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(reshape)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "shapesPlanCache");
+    }
+};
+
+TEST_P(ShapesPlanCacheTest, CompareWithRefs) {
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ShapesPlanCache, ShapesPlanCacheTest,
+                         ::testing::Values("0", "1", "64"),
+                         ShapesPlanCacheTest::getTestCaseName);
+
+// The target shape of Reshape is a model input, so the output shapes differ for the same input shapes and must not be
+// taken from the cache.
+class ShapesPlanCacheReshapePatternTest : public ShapesPlanCacheTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_SHAPES_PLAN_CACHE_CAPACITY, GetParam()});
+
+        const std::vector<InputShape> inputShapes = {
+            {{-1, -1}, {{4, 6}, {4, 6}, {4, 6}, {4, 6}, {4, 6}}},
+            {{2}, {{2}, {2}, {2}, {2}, {2}}}
+        };
+        init_input_shapes(inputShapes);
+
+        const auto ngPrc = ngraph::element::f32;
+        auto data = ngraph::builder::makeDynamicParams(ngPrc, {inputDynamicShapes[0]}).front();
+        auto pattern = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::i32, inputDynamicShapes[1]);
+        auto addConst = ngraph::builder::makeConstant<float>(ngPrc, {1}, {}, true);
+        auto add = std::make_shared<ngraph::opset1::Add>(data, addConst);
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(add, pattern, false);
+        auto softMax = std::make_shared<ngraph::opset1::Softmax>(reshape, 1);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(softMax)};
+        function = std::make_shared<ngraph::Function>(results, ngraph::ParameterVector{data, pattern}, "shapesPlanCacheReshapePattern");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        inputs.insert({funcInputs[0].get_node_shared_ptr(),
+                       utils::create_and_fill_tensor(funcInputs[0].get_element_type(), targetInputStaticShapes[0])});
+
+        ov::Tensor tensor{ov::element::i32, targetInputStaticShapes[1]};
+        const auto& values = patterns[inferNum++ % patterns.size()];
+        std::copy(values.begin(), values.end(), tensor.data<int32_t>());
+        inputs.insert({funcInputs[1].get_node_shared_ptr(), tensor});
+    }
+
+private:
+    const std::vector<std::vector<int32_t>> patterns = {{4, 6}, {2, 12}, {24, 1}, {4, 6}, {2, 12}};
+    size_t inferNum = 0;
+};
+
+TEST_P(ShapesPlanCacheReshapePatternTest, CompareWithRefs) {
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ShapesPlanCache, ShapesPlanCacheReshapePatternTest,
+                         ::testing::Values("0", "64"),
+                         ShapesPlanCacheTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
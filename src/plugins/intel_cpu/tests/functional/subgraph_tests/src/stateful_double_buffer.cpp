@@ -0,0 +1,146 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ov;
+
+namespace SubgraphTestsDefinitions {
+
+// The state of ReadValue/Assign pairs is kept in two swapped buffers when the graph allows to bind them to the
+// ReadValue output and the Assign input directly. The topologies below check both the bound state buffers and the
+// fallback to copying, the state is accumulated through several inferences and modified via the state API.
+enum class StateTopology {
+    Accumulate,         // ReadValue -> Add -> Assign, the sum is also a result
+    ReadAfterAssign,    // ReadValue has one more consumer, which doesn't depend on Assign
+    InPlacePassThrough  // the state is passed from ReadValue to Assign through in-place nodes only
+};
+
+std::ostream& operator<<(std::ostream& os, StateTopology topology) {
+    switch (topology) {
+    case StateTopology::Accumulate: return os << "Accumulate";
+    case StateTopology::ReadAfterAssign: return os << "ReadAfterAssign";
+    case StateTopology::InPlacePassThrough: return os << "InPlacePassThrough";
+    }
+    return os;
+}
+
+class StatefulDoubleBufferTest : public testing::WithParamInterface<StateTopology>, public ::testing::Test {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<StateTopology>& obj) {
+        std::ostringstream result;
+        result << "topology=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        const Shape shape{1, 4, 16};
+        auto param = std::make_shared<opset8::Parameter>(element::f32, shape);
+        auto variable = std::make_shared<op::util::Variable>(op::util::VariableInfo{shape, element::f32, "state"});
+        auto init = opset8::Constant::create(element::f32, shape, {0.f});
+        auto readValue = std::make_shared<opset8::ReadValue>(init, variable);
+
+        ResultVector results;
+        std::shared_ptr<Node> newState;
+        switch (GetParam()) {
+        case StateTopology::Accumulate:
+            newState = std::make_shared<opset8::Add>(readValue, param);
+            results.push_back(std::make_shared<opset8::Result>(newState));
+            break;
+        case StateTopology::ReadAfterAssign:
+            newState = std::make_shared<opset8::Add>(readValue, param);
+            results.push_back(std::make_shared<opset8::Result>(
+                std::make_shared<opset8::Multiply>(readValue, opset8::Constant::create(element::f32, {1}, {2.f}))));
+            break;
+        case StateTopology::InPlacePassThrough: {
+            auto flat = std::make_shared<opset8::Reshape>(readValue, opset8::Constant::create(element::i64, {1}, {-1}), false);
+            newState = std::make_shared<opset8::Reshape>(flat, opset8::Constant::create(element::i64, {3}, shape), false);
+            results.push_back(std::make_shared<opset8::Result>(std::make_shared<opset8::Add>(newState, param)));
+            break;
+        }
+        }
+        auto assign = std::make_shared<opset8::Assign>(newState, variable);
+        model = std::make_shared<Model>(results, SinkVector{assign}, ParameterVector{param}, "StatefulDoubleBuffer");
+    }
+
+    std::shared_ptr<Model> model;
+};
+
+TEST_P(StatefulDoubleBufferTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Core core;
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+    auto request = compiledModel.create_infer_request();
+
+    const size_t size = shape_size(model->input().get_shape());
+    std::vector<float> state(size, 0.f);
+
+    auto checkState = [&]() {
+        auto states = request.query_state();
+        ASSERT_EQ(1u, states.size());
+        auto actual = states.front().get_state();
+        ASSERT_EQ(size, actual.get_size());
+        for (size_t i = 0; i < size; i++) {
+            ASSERT_EQ(state[i], actual.data<float>()[i]) << "at " << i;
+        }
+    };
+
+    auto infer = [&](size_t iteration) {
+        Tensor input(element::f32, model->input().get_shape());
+        for (size_t i = 0; i < size; i++) {
+            input.data<float>()[i] = static_cast<float>((i + iteration) % 7);
+        }
+        request.set_input_tensor(input);
+        request.infer();
+
+        const auto output = request.get_output_tensor();
+        for (size_t i = 0; i < size; i++) {
+            const float value = input.data<float>()[i];
+            float expected = 0.f;
+            switch (GetParam()) {
+            case StateTopology::Accumulate: expected = state[i] + value; break;
+            case StateTopology::ReadAfterAssign: expected = state[i] * 2.f; break;
+            case StateTopology::InPlacePassThrough: expected = state[i] + value; break;
+            }
+            ASSERT_EQ(expected, output.data<float>()[i]) << "iteration " << iteration << " at " << i;
+            if (GetParam() != StateTopology::InPlacePassThrough) {
+                state[i] += value;
+            }
+        }
+        checkState();
+    };
+
+    for (size_t iteration = 0; iteration < 5; iteration++) {
+        infer(iteration);
+    }
+
+    request.query_state().front().reset();
+    std::fill(state.begin(), state.end(), 0.f);
+    infer(5);
+
+    Tensor newState(element::f32, model->input().get_shape());
+    for (size_t i = 0; i < size; i++) {
+        newState.data<float>()[i] = state[i] = static_cast<float>(i);
+    }
+    request.query_state().front().set_state(newState);
+    for (size_t iteration = 6; iteration < 9; iteration++) {
+        infer(iteration);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_StatefulDoubleBuffer, StatefulDoubleBufferTest,
+                         ::testing::Values(StateTopology::Accumulate,
+                                           StateTopology::ReadAfterAssign,
+                                           StateTopology::InPlacePassThrough),
+                         StatefulDoubleBufferTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
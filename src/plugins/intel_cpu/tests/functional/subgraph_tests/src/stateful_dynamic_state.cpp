@@ -0,0 +1,172 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace ov;
+
+namespace SubgraphTestsDefinitions {
+
+// The state with dynamic shape changes its shape from inference to inference. The growing state is appended with
+// the new part in place, both when the appended part is contiguous in memory and when it is strided, the state is also
+// checked when it is replaced as a whole.
+enum class DynamicStateTopology {
+    AppendInnerAxis,    // state [1, T, 16], ReadValue -> Concat(axis 1) -> Assign
+    AppendOuterAxis,    // state [1, 2, T, 8], ReadValue -> Concat(axis 2) -> Assign, like the keys/values of a decoder
+    Delay               // state [T, 16], the input is stored and returned by the next inference
+};
+
+std::ostream& operator<<(std::ostream& os, DynamicStateTopology topology) {
+    switch (topology) {
+    case DynamicStateTopology::AppendInnerAxis: return os << "AppendInnerAxis";
+    case DynamicStateTopology::AppendOuterAxis: return os << "AppendOuterAxis";
+    case DynamicStateTopology::Delay: return os << "Delay";
+    }
+    return os;
+}
+
+class StatefulDynamicStateTest : public testing::WithParamInterface<DynamicStateTopology>, public ::testing::Test {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DynamicStateTopology>& obj) {
+        std::ostringstream result;
+        result << "topology=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        switch (GetParam()) {
+        case DynamicStateTopology::AppendInnerAxis: shape = {1, -1, 16}; axis = 1; break;
+        case DynamicStateTopology::AppendOuterAxis: shape = {1, 2, -1, 8}; axis = 2; break;
+        case DynamicStateTopology::Delay: shape = {-1, 16}; axis = 0; break;
+        }
+
+        auto param = std::make_shared<opset8::Parameter>(element::f32, shape);
+        auto variable = std::make_shared<op::util::Variable>(op::util::VariableInfo{shape, element::f32, "state"});
+        auto initShape = shape.get_min_shape();
+        auto init = opset8::Constant::create(element::f32, initShape, std::vector<float>{});
+        auto readValue = std::make_shared<opset8::ReadValue>(init, variable);
+
+        std::shared_ptr<Node> newState;
+        std::shared_ptr<Node> result;
+        if (GetParam() == DynamicStateTopology::Delay) {
+            newState = param;
+            result = readValue;
+        } else {
+            newState = std::make_shared<opset8::Concat>(OutputVector{readValue, param}, axis);
+            result = newState;
+        }
+        auto assign = std::make_shared<opset8::Assign>(newState, variable);
+        model = std::make_shared<Model>(ResultVector{std::make_shared<opset8::Result>(result)}, SinkVector{assign},
+                                        ParameterVector{param}, "StatefulDynamicState");
+    }
+
+    Shape getShape(size_t length) const {
+        Shape result = shape.get_min_shape();
+        result[axis] = length;
+        return result;
+    }
+
+    // concatenates the tensors of the given shapes along the axis
+    std::vector<float> concat(const std::vector<float>& lhs, size_t lhsLength,
+                              const std::vector<float>& rhs, size_t rhsLength) const {
+        const auto dims = getShape(1);
+        const size_t outer = shape_size(Shape(dims.begin(), dims.begin() + axis));
+        const size_t inner = shape_size(Shape(dims.begin() + axis + 1, dims.end()));
+        std::vector<float> result;
+        for (size_t i = 0; i < outer; i++) {
+            result.insert(result.end(), lhs.begin() + i * lhsLength * inner, lhs.begin() + (i + 1) * lhsLength * inner);
+            result.insert(result.end(), rhs.begin() + i * rhsLength * inner, rhs.begin() + (i + 1) * rhsLength * inner);
+        }
+        return result;
+    }
+
+    PartialShape shape;
+    size_t axis = 0;
+    std::shared_ptr<Model> model;
+};
+
+TEST_P(StatefulDynamicStateTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Core core;
+    auto compiledModel = core.compile_model(model, CommonTestUtils::DEVICE_CPU);
+    auto request = compiledModel.create_infer_request();
+
+    std::vector<float> state;
+    size_t stateLength = 0;
+
+    auto checkTensor = [](const Tensor& actual, const Shape& expectedShape, const std::vector<float>& expected) {
+        ASSERT_EQ(expectedShape, actual.get_shape());
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(expected[i], actual.data<float>()[i]) << "at " << i;
+        }
+    };
+
+    auto infer = [&](size_t length, size_t iteration) {
+        Tensor input(element::f32, getShape(length));
+        std::vector<float> inputData(input.get_size());
+        for (size_t i = 0; i < inputData.size(); i++) {
+            input.data<float>()[i] = inputData[i] = static_cast<float>((i + iteration * 31) % 97);
+        }
+        request.set_input_tensor(input);
+        request.infer();
+
+        if (GetParam() == DynamicStateTopology::Delay) {
+            checkTensor(request.get_output_tensor(), getShape(stateLength), state);
+            state = inputData;
+            stateLength = length;
+        } else {
+            state = concat(state, stateLength, inputData, length);
+            stateLength += length;
+            checkTensor(request.get_output_tensor(), getShape(stateLength), state);
+        }
+
+        auto states = request.query_state();
+        ASSERT_EQ(1u, states.size());
+        checkTensor(states.front().get_state(), getShape(stateLength), state);
+    };
+
+    // the prompt is followed by the steps of a single token, the reserve of the state is exhausted several times
+    const std::vector<size_t> lengths = {5, 1, 1, 1, 3, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1};
+    for (size_t i = 0; i < lengths.size(); i++) {
+        infer(lengths[i], i);
+    }
+
+    request.query_state().front().reset();
+    state.clear();
+    stateLength = 0;
+    checkTensor(request.query_state().front().get_state(), getShape(0), state);
+    infer(4, lengths.size());
+    infer(1, lengths.size() + 1);
+
+    Tensor newState(element::f32, getShape(3));
+    state.resize(newState.get_size());
+    for (size_t i = 0; i < state.size(); i++) {
+        newState.data<float>()[i] = state[i] = static_cast<float>(i);
+    }
+    stateLength = 3;
+    request.query_state().front().set_state(newState);
+    for (size_t i = 0; i < 4; i++) {
+        infer(1, lengths.size() + 2 + i);
+    }
+
+    // the state of another request is independent
+    auto otherRequest = compiledModel.create_infer_request();
+    checkTensor(otherRequest.query_state().front().get_state(), getShape(0), {});
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_StatefulDynamicState, StatefulDynamicStateTest,
+                         ::testing::Values(DynamicStateTopology::AppendInnerAxis,
+                                           DynamicStateTopology::AppendOuterAxis,
+                                           DynamicStateTopology::Delay),
+                         StatefulDynamicStateTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,166 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_system_conf.h>
+
+#include <common_test_utils/test_common.hpp>
+
+#include "cpu_streams_calculation.hpp"
+
+using namespace testing;
+using namespace InferenceEngine;
+using namespace ov;
+
+namespace {
+
+struct AdaptiveStreamsTestCase {
+    std::vector<std::vector<int>> streams_info_table;
+    std::vector<std::vector<int>> active_streams_table;
+    std::vector<float> stream_slowdown;
+    int available_processors;
+    std::vector<std::vector<int>> adaptive_streams_table;
+};
+
+class AdaptiveStreamsTests : public CommonTestUtils::TestsCommon,
+                             public testing::WithParamInterface<std::tuple<AdaptiveStreamsTestCase>> {
+public:
+    void SetUp() override {
+        const auto& test_data = std::get<0>(GetParam());
+
+        std::vector<std::vector<int>> test_adaptive_streams_table =
+            ov::intel_cpu::get_adaptive_streams_info_table(test_data.streams_info_table,
+                                                           test_data.active_streams_table,
+                                                           test_data.stream_slowdown,
+                                                           test_data.available_processors);
+
+        ASSERT_EQ(test_data.adaptive_streams_table, test_adaptive_streams_table);
+    }
+};
+
+const std::vector<std::vector<int>> _hybrid_streams = {{4, MAIN_CORE_PROC, 4}, {4, EFFICIENT_CORE_PROC, 2}};
+
+AdaptiveStreamsTestCase _hybrid_no_contention = {
+    _hybrid_streams,
+    {{4, MAIN_CORE_PROC, 4}, {4, EFFICIENT_CORE_PROC, 2}},
+    {1.0f, 1.0f},
+    24,
+    {{4, MAIN_CORE_PROC, 4}, {4, EFFICIENT_CORE_PROC, 2}},
+};
+
+AdaptiveStreamsTestCase _hybrid_oversubscribed_1 = {
+    _hybrid_streams,
+    {{4, MAIN_CORE_PROC, 4}, {4, EFFICIENT_CORE_PROC, 2}},
+    {1.3f, 1.1f},
+    20,
+    {{3, MAIN_CORE_PROC, 4}, {4, EFFICIENT_CORE_PROC, 2}},
+};
+
+AdaptiveStreamsTestCase _hybrid_oversubscribed_2 = {
+    _hybrid_streams,
+    {{4, MAIN_CORE_PROC, 4}, {4, EFFICIENT_CORE_PROC, 2}},
+    {0.0f, 0.0f},
+    20,
+    {{4, MAIN_CORE_PROC, 4}, {3, EFFICIENT_CORE_PROC, 2}},
+};
+
+AdaptiveStreamsTestCase _hybrid_contended_main_core = {
+    _hybrid_streams,
+    {{4, MAIN_CORE_PROC, 4}, {4, EFFICIENT_CORE_PROC, 2}},
+    {2.0f, 1.0f},
+    24,
+    {{3, MAIN_CORE_PROC, 4}, {4, EFFICIENT_CORE_PROC, 2}},
+};
+
+AdaptiveStreamsTestCase _hybrid_move_to_main_core = {
+    _hybrid_streams,
+    {{3, MAIN_CORE_PROC, 4}, {2, EFFICIENT_CORE_PROC, 2}},
+    {1.0f, 1.8f},
+    24,
+    {{4, MAIN_CORE_PROC, 4}, {1, EFFICIENT_CORE_PROC, 2}},
+};
+
+AdaptiveStreamsTestCase _hybrid_move_to_efficient_core = {
+    _hybrid_streams,
+    {{4, MAIN_CORE_PROC, 4}, {2, EFFICIENT_CORE_PROC, 2}},
+    {1.7f, 1.0f},
+    24,
+    {{3, MAIN_CORE_PROC, 4}, {3, EFFICIENT_CORE_PROC, 2}},
+};
+
+AdaptiveStreamsTestCase _hybrid_grow_1 = {
+    _hybrid_streams,
+    {{2, MAIN_CORE_PROC, 4}, {4, EFFICIENT_CORE_PROC, 2}},
+    {1.1f, 1.0f},
+    24,
+    {{3, MAIN_CORE_PROC, 4}, {4, EFFICIENT_CORE_PROC, 2}},
+};
+
+AdaptiveStreamsTestCase _hybrid_grow_2 = {
+    _hybrid_streams,
+    {{2, MAIN_CORE_PROC, 4}, {2, EFFICIENT_CORE_PROC, 2}},
+    {1.0f, 1.0f},
+    14,
+    {{2, MAIN_CORE_PROC, 4}, {3, EFFICIENT_CORE_PROC, 2}},
+};
+
+AdaptiveStreamsTestCase _hybrid_no_free_processors = {
+    _hybrid_streams,
+    {{2, MAIN_CORE_PROC, 4}, {4, EFFICIENT_CORE_PROC, 2}},
+    {1.0f, 1.0f},
+    18,
+    {{2, MAIN_CORE_PROC, 4}, {4, EFFICIENT_CORE_PROC, 2}},
+};
+
+AdaptiveStreamsTestCase _hybrid_hysteresis = {
+    _hybrid_streams,
+    {{3, MAIN_CORE_PROC, 4}, {4, EFFICIENT_CORE_PROC, 2}},
+    {1.3f, 1.0f},
+    24,
+    {{3, MAIN_CORE_PROC, 4}, {4, EFFICIENT_CORE_PROC, 2}},
+};
+
+AdaptiveStreamsTestCase _1sockets_8cores_contended = {
+    {{4, MAIN_CORE_PROC, 2}},
+    {{4, MAIN_CORE_PROC, 2}},
+    {1.6f},
+    8,
+    {{3, MAIN_CORE_PROC, 2}},
+};
+
+AdaptiveStreamsTestCase _1sockets_8cores_last_stream = {
+    {{4, MAIN_CORE_PROC, 2}},
+    {{1, MAIN_CORE_PROC, 2}},
+    {3.0f},
+    1,
+    {{1, MAIN_CORE_PROC, 2}},
+};
+
+AdaptiveStreamsTestCase _1sockets_8cores_unknown_latency = {
+    {{4, MAIN_CORE_PROC, 2}},
+    {{2, MAIN_CORE_PROC, 2}},
+    {0.0f},
+    8,
+    {{3, MAIN_CORE_PROC, 2}},
+};
+
+TEST_P(AdaptiveStreamsTests, AdaptiveStreams) {}
+
+INSTANTIATE_TEST_SUITE_P(AdaptiveStreamsInfoTable,
+                         AdaptiveStreamsTests,
+                         testing::Values(_hybrid_no_contention,
+                                         _hybrid_oversubscribed_1,
+                                         _hybrid_oversubscribed_2,
+                                         _hybrid_contended_main_core,
+                                         _hybrid_move_to_main_core,
+                                         _hybrid_move_to_efficient_core,
+                                         _hybrid_grow_1,
+                                         _hybrid_grow_2,
+                                         _hybrid_no_free_processors,
+                                         _hybrid_hysteresis,
+                                         _1sockets_8cores_contended,
+                                         _1sockets_8cores_last_stream,
+                                         _1sockets_8cores_unknown_latency));
+
+}  // namespace
@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <ngraph_transformations/color_convert_normalize_fusion.hpp>
+#include <ngraph_transformations/op/color_convert_normalize.hpp>
+#include <transformations/init_node_info.hpp>
+#include <ngraph/pass/manager.hpp>
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+
+TEST(TransformationTests, ColorConvertNormalizeFusionNV12ToPlanar) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto y = std::make_shared<ov::opset8::Parameter>(ov::element::u8, ov::Shape{ 1, 480, 640, 1 });
+        auto uv = std::make_shared<ov::opset8::Parameter>(ov::element::u8, ov::Shape{ 1, 240, 320, 2 });
+        auto rgb = std::make_shared<ov::opset8::NV12toRGB>(y, uv);
+        auto convert = std::make_shared<ov::opset8::Convert>(rgb, ov::element::f32);
+        auto mean = ov::opset8::Constant::create(ov::element::f32, ov::Shape{ 1, 1, 1, 3 }, { 123.f, 117.f, 104.f });
+        auto sub = std::make_shared<ov::opset8::Subtract>(convert, mean);
+        auto scale = ov::opset8::Constant::create(ov::element::f32, ov::Shape{ 3 }, { 2.f, 4.f, 8.f });
+        auto div = std::make_shared<ov::opset8::Divide>(sub, scale);
+        auto order = ov::opset8::Constant::create(ov::element::i64, ov::Shape{ 4 }, { 0, 3, 1, 2 });
+        auto transpose = std::make_shared<ov::opset8::Transpose>(div, order);
+
+        f = std::make_shared<ov::Model>(ov::NodeVector{ transpose }, ov::ParameterVector{ y, uv });
+        ngraph::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<ColorConvertNormalizeFusion>();
+        m.run_passes(f);
+    }
+
+    {
+        auto y = std::make_shared<ov::opset8::Parameter>(ov::element::u8, ov::Shape{ 1, 480, 640, 1 });
+        auto uv = std::make_shared<ov::opset8::Parameter>(ov::element::u8, ov::Shape{ 1, 240, 320, 2 });
+        auto normalize = std::make_shared<ColorConvertNormalizeNode>(ov::OutputVector{ y, uv }, "NV12", "RGB",
+                                                                     std::vector<float>{ 123.f, 117.f, 104.f },
+                                                                     std::vector<float>{ 0.5f, 0.25f, 0.125f },
+                                                                     true, true);
+
+        f_ref = std::make_shared<ov::Model>(ov::NodeVector{ normalize }, ov::ParameterVector{ y, uv });
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ColorConvertNormalizeFusionI420ConvertedPlanes) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        auto y = std::make_shared<ov::opset8::Parameter>(ov::element::u8, ov::Shape{ 1, 720, 1280, 1 });
+        auto u = std::make_shared<ov::opset8::Parameter>(ov::element::u8, ov::Shape{ 1, 360, 640, 1 });
+        auto v = std::make_shared<ov::opset8::Parameter>(ov::element::u8, ov::Shape{ 1, 360, 640, 1 });
+        auto yf = std::make_shared<ov::opset8::Convert>(y, ov::element::f32);
+        auto uf = std::make_shared<ov::opset8::Convert>(u, ov::element::f32);
+        auto vf = std::make_shared<ov::opset8::Convert>(v, ov::element::f32);
+        auto bgr = std::make_shared<ov::opset8::I420toBGR>(yf, uf, vf);
+        auto scale = ov::opset8::Constant::create(ov::element::f32, ov::Shape{ 1 }, { 2.f });
+        auto mul = std::make_shared<ov::opset8::Multiply>(scale, bgr);
+        auto shift = ov::opset8::Constant::create(ov::element::f32, ov::Shape{ 1, 1, 1, 3 }, { -2.f, -4.f, -6.f });
+        auto add = std::make_shared<ov::opset8::Add>(mul, shift);
+
+        f = std::make_shared<ov::Model>(ov::NodeVector{ add }, ov::ParameterVector{ y, u, v });
+        ngraph::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<ColorConvertNormalizeFusion>();
+        m.run_passes(f);
+    }
+
+    {
+        auto y = std::make_shared<ov::opset8::Parameter>(ov::element::u8, ov::Shape{ 1, 720, 1280, 1 });
+        auto u = std::make_shared<ov::opset8::Parameter>(ov::element::u8, ov::Shape{ 1, 360, 640, 1 });
+        auto v = std::make_shared<ov::opset8::Parameter>(ov::element::u8, ov::Shape{ 1, 360, 640, 1 });
+        auto normalize = std::make_shared<ColorConvertNormalizeNode>(ov::OutputVector{ y, u, v }, "I420", "BGR",
+                                                                     std::vector<float>{ 1.f, 2.f, 3.f },
+                                                                     std::vector<float>{ 2.f, 2.f, 2.f },
+                                                                     false, false);
+
+        f_ref = std::make_shared<ov::Model>(ov::NodeVector{ normalize }, ov::ParameterVector{ y, u, v });
+    }
+
+    auto res = compare_functions(f, f_ref, false, false, false, true, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ColorConvertNormalizeFusionNotChannelWise) {
+    std::shared_ptr<ov::Model> f(nullptr);
+    {
+        auto y = std::make_shared<ov::opset8::Parameter>(ov::element::u8, ov::Shape{ 1, 4, 4, 1 });
+        auto uv = std::make_shared<ov::opset8::Parameter>(ov::element::u8, ov::Shape{ 1, 2, 2, 2 });
+        auto rgb = std::make_shared<ov::opset8::NV12toRGB>(y, uv);
+        auto convert = std::make_shared<ov::opset8::Convert>(rgb, ov::element::f32);
+        auto mean = ov::opset8::Constant::create(ov::element::f32, ov::Shape{ 1, 1, 4, 1 }, { 1.f, 2.f, 3.f, 4.f });
+        auto sub = std::make_shared<ov::opset8::Subtract>(mean, convert);
+
+        f = std::make_shared<ov::Model>(ov::NodeVector{ sub }, ov::ParameterVector{ y, uv });
+        ngraph::pass::Manager m;
+        m.register_pass<ov::pass::InitNodeInfo>();
+        m.register_pass<ColorConvertNormalizeFusion>();
+        m.run_passes(f);
+    }
+
+    // the Convert alone is fused, the Subtract isn't
+    ASSERT_EQ(count_ops_of_type<ov::opset8::Subtract>(f), 1u);
+    ASSERT_EQ(count_ops_of_type<ov::opset8::NV12toRGB>(f), 0u);
+    ASSERT_EQ(count_ops_of_type<ColorConvertNormalizeNode>(f), 1u);
+}
@@ -14,7 +14,10 @@
 #include <ngraph_transformations/op/fully_connected.hpp>
 #include <ngraph_transformations/convert_matmul_to_fc.hpp>
 #include <ngraph_transformations/fc_bias_fusion.hpp>
+#include <ngraph_transformations/mark_weights_decompression.hpp>
 #include <transformations/init_node_info.hpp>
+#include <transformations/rt_info/dequantization_node.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ngraph/pass/manager.hpp>
 #include <ov_ops/type_relaxed.hpp>
@@ -426,3 +429,127 @@ TEST_F(TransformationTestsF, ConvertMatMulToFCTest_second_input_rank_adj_3) {
         function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
     }
 }
+
+TEST_F(TransformationTestsF, ConvertMatMulToFCTest_decompression_per_channel) {
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 3, 2, 16 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 16, 32 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        ov::disable_constant_folding(convert);
+        auto zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 32 }, { 8 });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zero_point);
+        ov::mark_as_dequantization_node(subtract);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 32 }, { 0.5 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+        ov::mark_as_dequantization_node(multiply);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, multiply, false, false);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+        manager.register_pass<ConvertMatMulToFC>();
+    }
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 3, 2, 16 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 32, 16 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        ov::disable_constant_folding(convert);
+        auto zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 32, 1 }, { 8 });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zero_point);
+        ov::mark_as_dequantization_node(subtract);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 32, 1 }, { 0.5 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+        ov::mark_as_dequantization_node(multiply);
+        auto matmul = std::make_shared<FullyConnectedNode>(input1, multiply, ngraph::Rank(3));
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+    }
+}
+
+TEST_F(TransformationTestsF, ConvertMatMulToFCTest_decompression_per_group) {
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 16 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::i8, ngraph::Shape{ 32, 4, 4 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        ov::disable_constant_folding(convert);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 32, 4, 1 }, { 0.5 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scale);
+        ov::mark_as_dequantization_node(multiply);
+        auto reshape_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 32, 16 });
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(multiply, reshape_const, false);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, reshape, false, true);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+        manager.register_pass<ConvertMatMulToFC>();
+    }
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 16 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::i8, ngraph::Shape{ 32, 4, 4 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        ov::disable_constant_folding(convert);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 32, 4, 1 }, { 0.5 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scale);
+        ov::mark_as_dequantization_node(multiply);
+        auto reshape_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 32, 16 });
+        auto reshape = std::make_shared<ngraph::opset1::Reshape>(multiply, reshape_const, false);
+        auto matmul = std::make_shared<FullyConnectedNode>(input1, reshape, ngraph::Rank(2));
+
+        function_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+    }
+}
+
+TEST_F(TransformationTestsF, ConvertMatMulToFCTest_decompression_per_input_channel_is_not_converted) {
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 16 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 16, 32 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 16, 1 }, { 0.5 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scale);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, multiply, false, false);
+
+        function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+        manager.register_pass<ConvertMatMulToFC>();
+    }
+}
+
+// MarkWeightsDecompression keeps unfolded only the decompression subgraphs which are converted to FullyConnected
+TEST(TransformationTests, MarkWeightsDecompressionOnlyForConvertedMatMul) {
+    auto make_convert = [](const ngraph::Shape& scale_shape, bool transpose_b) {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 16 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u4, transpose_b ? ngraph::Shape{ 32, 16 } : ngraph::Shape{ 16, 32 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, scale_shape, { 0.5 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scale);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, multiply, false, transpose_b);
+        auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<MarkWeightsDecompression>();
+        manager.run_passes(function);
+        return convert;
+    };
+
+    EXPECT_TRUE(ov::pass::constant_folding_is_disabled(make_convert(ngraph::Shape{ 1, 32 }, false)));
+    EXPECT_TRUE(ov::pass::constant_folding_is_disabled(make_convert(ngraph::Shape{ 32, 1 }, true)));
+    // per input channel scales
+    EXPECT_FALSE(ov::pass::constant_folding_is_disabled(make_convert(ngraph::Shape{ 16, 1 }, false)));
+    // scalar decompression
+    EXPECT_FALSE(ov::pass::constant_folding_is_disabled(make_convert(ngraph::Shape{ 1 }, false)));
+}
+
+TEST(TransformationTests, MarkWeightsDecompressionGroupedWithoutTransposeB) {
+    auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 2, 16 });
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::i8, ngraph::Shape{ 4, 4, 32 }, { 1 });
+    auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+    auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 4, 1, 32 }, { 0.5 });
+    auto multiply = std::make_shared<ngraph::opset1::Multiply>(convert, scale);
+    auto reshape_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { 16, 32 });
+    auto reshape = std::make_shared<ngraph::opset1::Reshape>(multiply, reshape_const, false);
+    auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, reshape, false, false);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<MarkWeightsDecompression>();
+    manager.run_passes(function);
+
+    EXPECT_FALSE(ov::pass::constant_folding_is_disabled(convert));
+    EXPECT_FALSE(ov::is_dequantization_node(multiply));
+}
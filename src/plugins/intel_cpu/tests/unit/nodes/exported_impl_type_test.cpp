@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <edge.h>
+#include <node.h>
+#include <nodes/conv.h>
+#include <nodes/input.h>
+
+#include <ngraph/opsets/opset1.hpp>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// Implementation types of the primitive descriptors enumerated by a convolution node
+std::vector<impl_desc_type> convolutionImplTypes(const std::string& exportedImpl) {
+    auto param = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{1, 16, 28, 28});
+    auto weights = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{32, 16, 3, 3},
+                                                    std::vector<float>(32 * 16 * 3 * 3, 0.1f));
+    auto conv = std::make_shared<ngraph::opset1::Convolution>(param, weights,
+                                                              ngraph::Strides{1, 1},
+                                                              ngraph::CoordinateDiff{1, 1},
+                                                              ngraph::CoordinateDiff{1, 1},
+                                                              ngraph::Strides{1, 1});
+    auto result = std::make_shared<ngraph::opset1::Result>(conv);
+    if (!exportedImpl.empty())
+        conv->get_rt_info()[EXPORTED_IMPL_TYPE] = exportedImpl;
+
+    Config conf;
+    auto context = std::make_shared<GraphContext>(conf,
+                                                  nullptr,
+                                                  std::make_shared<WeightsSharing>(),
+                                                  std::make_shared<std::mutex>(),
+                                                  false);
+    auto inputNode = std::make_shared<node::Input>(param, context);
+    auto weightsNode = std::make_shared<node::Input>(weights, context);
+    auto convNode = std::make_shared<node::Convolution>(conv, context);
+    auto outputNode = std::make_shared<node::Input>(result, context);
+
+    std::vector<EdgePtr> edges = {std::make_shared<Edge>(inputNode, convNode, 0, 0),
+                                  std::make_shared<Edge>(weightsNode, convNode, 0, 1),
+                                  std::make_shared<Edge>(convNode, outputNode, 0, 0)};
+    for (const auto& edge : edges)
+        convNode->addEdge(edge);
+
+    convNode->getSupportedDescriptors();
+    convNode->initSupportedPrimitiveDescriptors();
+
+    std::vector<impl_desc_type> implTypes;
+    for (const auto& pd : convNode->getSupportedPrimitiveDescriptors())
+        implTypes.push_back(pd.getImplementationType());
+    return implTypes;
+}
+
+}  // namespace
+
+TEST(ExportedImplTypeTest, OnlyExportedImplementationIsEnumerated) {
+    const auto allImplTypes = convolutionImplTypes("");
+    ASSERT_FALSE(allImplTypes.empty());
+
+    // the first enumerated implementation is the one of the highest priority
+    const auto exported = allImplTypes.front();
+    const auto importedImplTypes = convolutionImplTypes(impl_type_to_string(exported));
+    ASSERT_FALSE(importedImplTypes.empty());
+    for (const auto& implType : importedImplTypes)
+        EXPECT_EQ(exported, implType);
+
+    const auto exportedNum = static_cast<size_t>(std::count(allImplTypes.begin(), allImplTypes.end(), exported));
+    EXPECT_LE(importedImplTypes.size(), exportedNum);
+    EXPECT_LT(importedImplTypes.size(), allImplTypes.size());
+}
+
+TEST(ExportedImplTypeTest, FallbackIfExportedImplementationIsNotAvailable) {
+    const auto allImplTypes = convolutionImplTypes("");
+    ASSERT_EQ(0, std::count(allImplTypes.begin(), allImplTypes.end(), impl_desc_type::gemm_blas));
+
+    EXPECT_EQ(allImplTypes, convolutionImplTypes(impl_type_to_string(impl_desc_type::gemm_blas)));
+}
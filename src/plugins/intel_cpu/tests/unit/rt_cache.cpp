@@ -2,12 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <thread>
 
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
 #include "cache/lru_cache.h"
+#include "cache/concurrent_lru_cache.h"
 #include "cache/multi_cache.h"
 
 using namespace ov::intel_cpu;
@@ -379,3 +381,89 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(ConcurrentLruCacheTests, PutGet) {
+    constexpr size_t capacity = 64;
+    ConcurrentLruCache<IntKey, int> cache(capacity);
+    ASSERT_EQ(cache.getCapacity(), capacity);
+    for (int i = 0; i < 16; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i + 1));
+    }
+    for (int i = 0; i < 16; ++i) {
+        ASSERT_EQ(cache.get({i}), i + 1);
+    }
+    ASSERT_NO_THROW(cache.evict(capacity));
+    for (int i = 0; i < 16; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(ConcurrentLruCacheTests, Empty) {
+    ConcurrentLruCache<IntKey, int> cache(0);
+    ASSERT_FALSE(cache.put({1}, 1));
+    ASSERT_EQ(cache.get({1}), int());
+}
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr size_t capacity = 10;
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    for (bool threadSafe : {false, true}) {
+        MultiCache cache(capacity, threadSafe);
+        ASSERT_EQ(cache.isThreadSafe(), threadSafe);
+        for (int i = 0; i < capacity; ++i) {
+            cache.getOrCreate(IntKey{i}, intBuilder);
+            cache.getOrCreate(IntKey{i}, intBuilder);
+        }
+        const auto& stats = cache.getStatistics();
+        ASSERT_EQ(stats.hits.load(), capacity);
+        ASSERT_EQ(stats.misses.load(), capacity);
+        ASSERT_EQ(stats.evictions.load(), 0);
+
+        // the LRU order is maintained per shard for the thread safe cache,
+        // so it is only guaranteed that the overflow causes evictions
+        for (int i = capacity; i < 3 * capacity; ++i) {
+            cache.getOrCreate(IntKey{i}, intBuilder);
+        }
+        ASSERT_EQ(stats.misses.load(), 3 * capacity);
+        ASSERT_GE(stats.evictions.load(), capacity);
+    }
+}
+
+TEST(MultiCacheTests, SharedStress) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 100;
+    constexpr size_t numThreads = 16;
+    constexpr int numKeys = 150;
+    constexpr int iterations = 20000;
+
+    MultiCache cache(capacity, true);
+    std::atomic<size_t> builds{0};
+
+    auto intBuilder = [&](const IntKey& key) {
+        builds.fetch_add(1);
+        return std::make_shared<int>(key.data);
+    };
+
+    auto testRoutine = [&](size_t seed) {
+        for (int i = 0; i < iterations; ++i) {
+            const int key = static_cast<int>((i * 7 + seed * 13) % numKeys);
+            auto intResult = cache.getOrCreate(IntKey{key}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, key);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine, i));
+        }
+    }
+
+    const auto& stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits.load() + stats.misses.load(), numThreads * iterations);
+    ASSERT_EQ(stats.misses.load(), builds.load());
+}
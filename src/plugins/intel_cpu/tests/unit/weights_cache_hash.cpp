@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+std::vector<unsigned char> makeData(size_t size) {
+    std::vector<unsigned char> data(size);
+    for (size_t i = 0; i < size; i++)
+        data[i] = static_cast<unsigned char>((i * 31 + 7) ^ (i >> 8));
+    return data;
+}
+} // namespace
+
+TEST(WeightsHashTests, Deterministic) {
+    const auto& hashFunc = WeightsSharing::GetHashFunc();
+    for (size_t size : {0ul, 1ul, 31ul, 32ul, 1000ul, (1ul << 20) + 17, 5ul << 20}) {
+        const auto data = makeData(size);
+        ASSERT_EQ(hashFunc.hash(data.data(), data.size()), hashFunc.hash(data.data(), data.size())) << size;
+    }
+}
+
+TEST(WeightsHashTests, SensitiveToContentAndSize) {
+    const auto& hashFunc = WeightsSharing::GetHashFunc();
+    for (size_t size : {64ul, (1ul << 20) + 17, 3ul << 20}) {
+        auto data = makeData(size);
+        const auto reference = hashFunc.hash(data.data(), data.size());
+
+        ASSERT_NE(reference, hashFunc.hash(data.data(), data.size() - 1)) << size;
+
+        // change a single byte in the last chunk
+        data[size - 1] ^= 1;
+        ASSERT_NE(reference, hashFunc.hash(data.data(), data.size())) << size;
+        data[size - 1] ^= 1;
+
+        // swap two bytes
+        std::swap(data[1], data[size / 2]);
+        ASSERT_NE(reference, hashFunc.hash(data.data(), data.size())) << size;
+    }
+}
+
+namespace {
+// The byte-wise CRC64 (ECMA-182) previously used to build the keys of the internal blobs
+class Crc64DataHash {
+public:
+    Crc64DataHash() {
+        for (int i = 0; i < kTableSize; i++) {
+            uint64_t c = i;
+            for (int j = 0; j < 8; j++)
+                c = ((c & 1) ? 0xc96c5795d7870f42 : 0) ^ (c >> 1);
+            table[i] = c;
+        }
+    }
+
+    uint64_t hash(const unsigned char* data, size_t size) const {
+        uint64_t crc = 0;
+        for (size_t idx = 0; idx < size; idx++)
+            crc = table[(unsigned char)crc ^ data[idx]] ^ (crc >> 8);
+
+        return ~crc;
+    }
+
+private:
+    static constexpr int kTableSize = 256;
+    uint64_t table[kTableSize];
+};
+} // namespace
+
+// Compares the throughput of the weights hash with the CRC64 it replaced
+TEST(WeightsHashTests, DISABLED_Throughput) {
+    const Crc64DataHash crc64;
+    const auto& hashFunc = WeightsSharing::GetHashFunc();
+    for (size_t size : {4ul << 10, 1ul << 20, 64ul << 20, 256ul << 20}) {
+        const auto data = makeData(size);
+        auto measure = [&](const std::function<uint64_t()>& func) {
+            const size_t iterations = std::max<size_t>(1, (256ul << 20) / size);
+            volatile uint64_t sink = 0;
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < iterations; i++)
+                sink = sink ^ func();
+            const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            return iterations * size / elapsed / (1 << 30);
+        };
+        const auto crc64Throughput = measure([&] { return crc64.hash(data.data(), data.size()); });
+        const auto hashThroughput = measure([&] { return hashFunc.hash(data.data(), data.size()); });
+        std::cout << size << " bytes: CRC64 " << crc64Throughput << " GB/s, xxHash64 " << hashThroughput
+                  << " GB/s, speedup " << hashThroughput / crc64Throughput << std::endl;
+    }
+}
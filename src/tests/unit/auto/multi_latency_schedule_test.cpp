@@ -0,0 +1,214 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+#include <cmath>
+#include <common_test_utils/test_constants.hpp>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <thread>
+#include "multi_schedule.hpp"
+#include "unit_test_utils/mocks/cpp_interfaces/interface/mock_iexecutable_network_internal.hpp"
+#include "utils/plugin_config.hpp"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::SaveArg;
+using ::testing::StrEq;
+
+using namespace MockMultiDevicePlugin;
+
+namespace {
+DeviceLatencyStats makeStats(double latency, size_t samples, size_t workers, size_t inflight, size_t pending = 0) {
+    DeviceLatencyStats stats;
+    stats.latency = latency;
+    stats.samples = samples;
+    stats.workers = workers;
+    stats.inflight = inflight;
+    stats.pending = pending;
+    return stats;
+}
+}  // namespace
+
+class MultiLatencySchedule : public ::testing::Test {
+public:
+    std::vector<DeviceInformation> devices = {{CommonTestUtils::DEVICE_GPU, {}, -1},
+                                              {CommonTestUtils::DEVICE_CPU, {}, -1}};
+    DeviceMap<DeviceLatencyStats> stats;
+};
+
+TEST_F(MultiLatencySchedule, latencyMovingAverage) {
+    DeviceLatencyStats device;
+    device.Update(10.0);
+    EXPECT_DOUBLE_EQ(10.0, device.latency);
+    device.Update(20.0);
+    EXPECT_DOUBLE_EQ(12.0, device.latency);
+    EXPECT_EQ(2u, device.samples);
+}
+
+TEST_F(MultiLatencySchedule, expectedCompletionTimeAccountsForBusyWorkers) {
+    EXPECT_DOUBLE_EQ(10.0, makeStats(10.0, 5, 2, 1).ExpectedCompletionTime());
+    // both workers are busy, one of them is released in 5 ms on average
+    EXPECT_DOUBLE_EQ(15.0, makeStats(10.0, 5, 2, 2).ExpectedCompletionTime());
+    // and two more tasks are waiting for the workers
+    EXPECT_DOUBLE_EQ(25.0, makeStats(10.0, 5, 2, 2, 2).ExpectedCompletionTime());
+    // the latency of the busy device isn't known yet
+    EXPECT_TRUE(std::isinf(makeStats(0.0, 0, 2, 2).ExpectedCompletionTime()));
+}
+
+TEST_F(MultiLatencySchedule, devicesWithoutMeasurementsAreTriedFirst) {
+    stats[CommonTestUtils::DEVICE_GPU] = makeStats(2.0, 10, 4, 0);
+    stats[CommonTestUtils::DEVICE_CPU] = makeStats(0.0, 0, 2, 0);
+    EXPECT_EQ(CommonTestUtils::DEVICE_CPU, SelectFastestDevice(devices, stats));
+}
+
+TEST_F(MultiLatencySchedule, tiesAreResolvedByPriority) {
+    stats[CommonTestUtils::DEVICE_GPU] = makeStats(0.0, 0, 4, 0);
+    stats[CommonTestUtils::DEVICE_CPU] = makeStats(0.0, 0, 2, 0);
+    EXPECT_EQ(CommonTestUtils::DEVICE_GPU, SelectFastestDevice(devices, stats));
+}
+
+TEST_F(MultiLatencySchedule, busyFastDeviceIsPreferredToIdleSlowDevice) {
+    // all workers of GPU are busy, but it completes the request in 2 + 4 * 2 / 4 = 4 ms, while CPU needs 20 ms
+    stats[CommonTestUtils::DEVICE_GPU] = makeStats(2.0, 10, 4, 4, 3);
+    stats[CommonTestUtils::DEVICE_CPU] = makeStats(20.0, 10, 2, 0);
+    EXPECT_EQ(CommonTestUtils::DEVICE_GPU, SelectFastestDevice(devices, stats));
+}
+
+TEST_F(MultiLatencySchedule, loadedFastDeviceGivesWayToSlowDevice) {
+    stats[CommonTestUtils::DEVICE_GPU] = makeStats(2.0, 10, 4, 4, 40);
+    stats[CommonTestUtils::DEVICE_CPU] = makeStats(20.0, 10, 2, 1);
+    EXPECT_EQ(CommonTestUtils::DEVICE_CPU, SelectFastestDevice(devices, stats));
+}
+
+TEST_F(MultiLatencySchedule, unknownWhenAllDevicesAreBusyWithoutMeasurements) {
+    stats[CommonTestUtils::DEVICE_GPU] = makeStats(0.0, 0, 4, 4);
+    stats[CommonTestUtils::DEVICE_CPU] = makeStats(0.0, 0, 2, 2);
+    EXPECT_TRUE(SelectFastestDevice(devices, stats).empty());
+}
+
+TEST_F(MultiLatencySchedule, schedulePolicyProperty) {
+    PluginConfig config;
+    EXPECT_EQ(ov::intel_auto::SchedulePolicy::DEVICE_PRIORITY, config.get_property(ov::intel_auto::schedule_policy));
+    ASSERT_NO_THROW(config.set_user_property({{ov::intel_auto::schedule_policy.name(), "LATENCY_AWARE"}}));
+    EXPECT_EQ(ov::intel_auto::SchedulePolicy::LATENCY_AWARE, config.get_property(ov::intel_auto::schedule_policy));
+    EXPECT_THROW(config.set_user_property({{ov::intel_auto::schedule_policy.name(), "FASTEST"}}), ov::Exception);
+}
+
+namespace {
+class LatencyAwareMultiSchedule : public MultiSchedule {
+public:
+    bool Schedule(IE::Task task) {
+        return ScheduleToWorkerInferRequest(std::move(task));
+    }
+    DeviceLatencyStats Stats(const DeviceName& device) {
+        std::lock_guard<std::mutex> lock(_latencyMutex);
+        return _latencyStats[device];
+    }
+};
+}  // namespace
+
+// GPU and CPU with a single worker infer request each, the requests don't complete until the test calls their callbacks
+class MultiLatencyScheduleRequests : public ::testing::Test {
+public:
+    std::shared_ptr<LatencyAwareMultiSchedule> schedule;
+    DeviceMap<std::shared_ptr<NiceMock<MockIExecutableNetworkInternal>>> networks;
+    DeviceMap<std::shared_ptr<NiceMock<MockIInferRequestInternal>>> requests;
+    DeviceMap<std::function<void(std::exception_ptr)>> callbacks;
+    std::vector<DeviceName> started;
+
+    void SetUp() override {
+        auto context = std::make_shared<MultiScheduleContext>();
+        context->_schedulePolicy = ov::intel_auto::SchedulePolicy::LATENCY_AWARE;
+        context->_devicePriorities = {{CommonTestUtils::DEVICE_GPU, {}, -1}, {CommonTestUtils::DEVICE_CPU, {}, -1}};
+        context->_devicePrioritiesInitial = context->_devicePriorities;
+        for (auto&& device : context->_devicePriorities) {
+            const auto name = device.deviceName;
+            auto request = std::make_shared<NiceMock<MockIInferRequestInternal>>();
+            ON_CALL(*request, SetCallback(_)).WillByDefault(SaveArg<0>(&callbacks[name]));
+            ON_CALL(*request, StartAsync()).WillByDefault([this, name]() {
+                started.push_back(name);
+            });
+            auto network = std::make_shared<NiceMock<MockIExecutableNetworkInternal>>();
+            ON_CALL(*network, GetMetric(StrEq(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS))))
+                .WillByDefault(Return("1"));
+            ON_CALL(*network, CreateInferRequest()).WillByDefault(Return(request));
+            context->_networksPerDevice[name] = {network, {}};
+            networks[name] = network;
+            requests[name] = request;
+        }
+        schedule = std::make_shared<LatencyAwareMultiSchedule>();
+        schedule->init(context);
+    }
+
+    void TearDown() override {
+        schedule.reset();
+    }
+
+    // the task started by the worker infer request, as the last stage of the MULTI pipeline does
+    static IE::Task startRequest() {
+        return [] {
+            ThisRequestExecutor{&MultiSchedule::_thisWorkerInferRequest}.run([] {});
+        };
+    }
+
+    void checkIdle(const DeviceName& device) {
+        const auto stats = schedule->Stats(device);
+        EXPECT_EQ(0u, stats.inflight) << device;
+        EXPECT_EQ(0u, stats.pending) << device;
+    }
+};
+
+TEST_F(MultiLatencyScheduleRequests, requestsAreDispatchedToFastestDevice) {
+    // no measurements yet, the tie is resolved by the priority, then the idle device is taken
+    EXPECT_TRUE(schedule->Schedule(startRequest()));
+    EXPECT_TRUE(schedule->Schedule(startRequest()));
+    ASSERT_EQ((std::vector<DeviceName>{CommonTestUtils::DEVICE_GPU, CommonTestUtils::DEVICE_CPU}), started);
+    EXPECT_EQ(1u, schedule->Stats(CommonTestUtils::DEVICE_GPU).inflight);
+    EXPECT_EQ(1u, schedule->Stats(CommonTestUtils::DEVICE_CPU).inflight);
+
+    // GPU completes the request at once, CPU takes much longer
+    callbacks[CommonTestUtils::DEVICE_GPU](nullptr);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    callbacks[CommonTestUtils::DEVICE_CPU](nullptr);
+    checkIdle(CommonTestUtils::DEVICE_GPU);
+    checkIdle(CommonTestUtils::DEVICE_CPU);
+
+    // both requests go to GPU, the second one waits for its worker rather than takes the idle CPU one
+    started.clear();
+    EXPECT_TRUE(schedule->Schedule(startRequest()));
+    EXPECT_FALSE(schedule->Schedule(startRequest()));
+    ASSERT_EQ((std::vector<DeviceName>{CommonTestUtils::DEVICE_GPU}), started);
+    EXPECT_EQ(1u, schedule->Stats(CommonTestUtils::DEVICE_GPU).inflight);
+    EXPECT_EQ(1u, schedule->Stats(CommonTestUtils::DEVICE_GPU).pending);
+
+    // the completion of the first request starts the waiting one
+    callbacks[CommonTestUtils::DEVICE_GPU](nullptr);
+    ASSERT_EQ((std::vector<DeviceName>{CommonTestUtils::DEVICE_GPU, CommonTestUtils::DEVICE_GPU}), started);
+    EXPECT_EQ(1u, schedule->Stats(CommonTestUtils::DEVICE_GPU).inflight);
+    EXPECT_EQ(0u, schedule->Stats(CommonTestUtils::DEVICE_GPU).pending);
+    callbacks[CommonTestUtils::DEVICE_GPU](nullptr);
+    checkIdle(CommonTestUtils::DEVICE_GPU);
+    checkIdle(CommonTestUtils::DEVICE_CPU);
+    EXPECT_EQ(3u, schedule->Stats(CommonTestUtils::DEVICE_GPU).samples);
+    EXPECT_EQ(1u, schedule->Stats(CommonTestUtils::DEVICE_CPU).samples);
+}
+
+TEST_F(MultiLatencyScheduleRequests, countersAreReleasedOnErrors) {
+    // the task fails before the infer request is started
+    EXPECT_THROW(schedule->Schedule([] {
+        IE_THROW() << "failed to start";
+    }), IE::Exception);
+    checkIdle(CommonTestUtils::DEVICE_GPU);
+    EXPECT_TRUE(started.empty());
+
+    // the worker is returned to the idle ones and the infer request completes with an error
+    EXPECT_TRUE(schedule->Schedule(startRequest()));
+    ASSERT_EQ((std::vector<DeviceName>{CommonTestUtils::DEVICE_GPU}), started);
+    callbacks[CommonTestUtils::DEVICE_GPU](std::make_exception_ptr(IE::GeneralError{"failed to infer"}));
+    checkIdle(CommonTestUtils::DEVICE_GPU);
+    checkIdle(CommonTestUtils::DEVICE_CPU);
+    EXPECT_EQ(1u, schedule->Stats(CommonTestUtils::DEVICE_GPU).samples);
+}